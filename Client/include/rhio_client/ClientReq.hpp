@@ -9,6 +9,8 @@
 #include "rhio_common/Value.hpp"
 #include "rhio_common/Stream.hpp"
 #include "rhio_common/Frame.hpp"
+#include "rhio_common/Snapshot.hpp"
+#include "rhio_common/CommandArgs.hpp"
 
 namespace RhIO {
 
@@ -47,6 +49,8 @@ class ClientReq
             (const std::string& name);
         std::vector<std::string> listValuesStr
             (const std::string& name);
+        std::vector<std::string> listValuesFloatArray
+            (const std::string& name);
 
         /**
          * Return the list of available commands on 
@@ -75,6 +79,27 @@ class ClientReq
         std::string call(const std::string& name, 
             const std::vector<std::string>& arguments);
 
+        /**
+         * Call the given server side absolute name command
+         * binary signature with given encoded arguments
+         * (see CommandArgs) and return the encoded result
+         */
+        CommandData callBinary(const std::string& name, 
+            const CommandData& arguments);
+
+        /**
+         * Call the given server side absolute name command
+         * with given typed arguments through its binary
+         * signature and return the decoded typed result.
+         * Ret is the command return type.
+         */
+        template <typename Ret, typename ... Args>
+        Ret callTyped(const std::string& name, const Args& ... args)
+        {
+            return CommandResult<Ret>::unpack(
+                callBinary(name, commandArgsPack(args...)));
+        }
+
         /**
          * Ask and return the value of given 
          * absolute name for each type
@@ -83,6 +108,7 @@ class ClientReq
         int64_t getInt(const std::string& name);
         double getFloat(const std::string& name);
         std::string getStr(const std::string& name);
+        std::vector<double> getFloatArray(const std::string& name);
 
         /**
          * Update with given values the given
@@ -93,6 +119,8 @@ class ClientReq
         void setFloat(const std::string& name, double val);
         void setStr(const std::string& name, 
             const std::string& val);
+        void setFloatArray(const std::string& name, 
+            const std::vector<double>& val);
 
         /**
          * Retrieve value meta information for each type 
@@ -104,6 +132,7 @@ class ClientReq
         ValueInt metaValueInt(const std::string& name);
         ValueFloat metaValueFloat(const std::string& name);
         ValueStr metaValueStr(const std::string& name);
+        ValueFloatArray metaValueFloatArray(const std::string& name);
 
         /**
          * Enable and disable streaming for given
@@ -117,6 +146,13 @@ class ClientReq
         void disableStreamingValue(const std::string& name);
         void checkStreamingValue(const std::string& name);
 
+        /**
+         * Set the streaming filter policy
+         * of given absolute value name
+         */
+        void setStreamFilter(const std::string& name,
+            const StreamFilter& filter);
+
         /**
          * Return the list of available streams on 
          * a given absolute node name
@@ -177,6 +213,13 @@ class ClientReq
         void load(const std::string& name, 
             const std::string& serverPath);
 
+        /**
+         * Return a consistent copy of all values
+         * under given absolute node name
+         * fetched in one request
+         */
+        Snapshot snapshot(const std::string& name);
+
     private:
 
         /**
@@ -2,10 +2,15 @@
 #define RHIO_CLIENTSUB_HPP
 
 #include <string>
+#include <vector>
 #include <functional>
 #include <thread>
 #include <mutex>
+#include <map>
+#include <chrono>
 #include <zmq.hpp>
+#include "rhio_common/Protocol.hpp"
+#include "rhio_common/DataBuffer.hpp"
 
 namespace RhIO {
 
@@ -32,11 +37,41 @@ class ClientSub
         typedef std::function<void
             (const std::string& name, int64_t timestamp, const std::string& val)> 
             StreamStrHandler;
+        typedef std::function<void
+            (const std::string& name, int64_t timestamp, 
+            const std::vector<double>& val)> 
+            StreamFloatArrayHandler;
         typedef std::function<void
             (const std::string& name, int64_t timestamp, 
             size_t width, size_t height, unsigned char* data, size_t size)> 
             StreamFrameHandler;
         
+        /**
+         * Reception statistics of a frame stream.
+         * Number of completely received frames, of
+         * incomplete dropped frames, of received 
+         * chunks and of missing chunks of dropped frames.
+         */
+        struct FrameStats {
+            uint64_t countFrames;
+            uint64_t countDropped;
+            uint64_t countChunks;
+            uint64_t countChunksLost;
+            FrameStats() :
+                countFrames(0),
+                countDropped(0),
+                countChunks(0),
+                countChunksLost(0)
+            {
+            }
+        };
+
+        /**
+         * Frames not completely received after
+         * this delay in milliseconds are dropped
+         */
+        static const int FrameTimeout = 500;
+        
         /**
          * Initialization with the bind
          * endpoint string
@@ -51,7 +86,7 @@ class ClientSub
 
         /**
          * Setup custom handler for value streaming of each
-         * type Bool, Int, Float, Str, Stream
+         * type Bool, Int, Float, Str, FloatArray, Stream
          * Default argument is an empty handler
          */
         void setHandlerBool(
@@ -62,13 +97,61 @@ class ClientSub
             StreamFloatHandler handler = StreamFloatHandler());
         void setHandlerStr(
             StreamStrHandler handler = StreamStrHandler());
+        void setHandlerFloatArray(
+            StreamFloatArrayHandler handler = StreamFloatArrayHandler());
         void setHandlerStream(
             StreamStrHandler handler = StreamStrHandler());
         void setHandlerFrame(
             StreamFrameHandler handler = StreamFrameHandler());
 
+        /**
+         * Return the reception statistics 
+         * of given absolute frame name
+         */
+        FrameStats getFrameStats(const std::string& name);
+
     private:
         
+        /**
+         * Sequence numbers window in which
+         * chunks of older frames are ignored
+         */
+        static const uint64_t FrameSeqWindow = 16;
+
+        /**
+         * Frame being reassembled from chunks
+         */
+        struct FrameAssembly {
+            //Frame sequence number, meta 
+            //information and data
+            uint64_t seq;
+            int64_t timestamp;
+            size_t width;
+            size_t height;
+            std::vector<unsigned char> data;
+            //Received chunks and number of chunks
+            std::vector<bool> isReceived;
+            size_t count;
+            size_t countReceived;
+            //True if forwarded or dropped
+            bool isDone;
+            //Reception time of the first chunk
+            std::chrono::steady_clock::time_point timeStart;
+            FrameAssembly() :
+                seq(0),
+                timestamp(0),
+                width(0),
+                height(0),
+                data(),
+                isReceived(),
+                count(0),
+                countReceived(0),
+                isDone(false),
+                timeStart()
+            {
+            }
+        };
+        
         /**
          * Mutex protecting update on
          * handler function
@@ -87,8 +170,45 @@ class ClientSub
         StreamIntHandler _handlerInt;
         StreamFloatHandler _handlerFloat;
         StreamStrHandler _handlerStr;
+        StreamFloatArrayHandler _handlerFloatArray;
         StreamStrHandler _handlerStream;
         StreamFrameHandler _handlerFrame;
+
+        /**
+         * Value dictionary entry 
+         * for compact samples
+         */
+        struct DictionaryEntry {
+            //Sample type (zero if not announced)
+            uint8_t type;
+            //Absolute value name
+            std::string name;
+            DictionaryEntry() :
+                type(0),
+                name()
+            {
+            }
+        };
+
+        /**
+         * Announced value dictionary indexed by id,
+         * server session id it belongs to and 
+         * reused decoding buffers for Str and
+         * FloatArray compact samples.
+         * Only accessed by the subscriber thread.
+         */
+        std::vector<DictionaryEntry> _dictionary;
+        uint64_t _dictionarySession;
+        std::string _decodeStr;
+        std::vector<double> _decodeFloatArray;
+
+        /**
+         * Frames being reassembled by absolute name
+         * (only accessed by the subscriber thread)
+         * and reception statistics by absolute name
+         */
+        std::map<std::string, FrameAssembly> _frameAssemblies;
+        std::map<std::string, FrameStats> _frameStats;
         
         /**
          * Receiver thread
@@ -99,6 +219,52 @@ class ClientSub
          * Receiver thread main loop
          */
         void subscriberThread(const std::string& endpoint);
+
+        /**
+         * Decode the sample of given type at
+         * given buffer cursor and call its handler
+         */
+        void processSample(MsgType type, DataBuffer& sub);
+
+        /**
+         * Update the value dictionary from given 
+         * MsgStreamDictionary datagram
+         */
+        void processDictionary(DataBuffer& sub);
+
+        /**
+         * Decode all samples of given MsgStreamCompact
+         * datagram and call their handlers.
+         * No allocation once the buffers have grown.
+         * The rest of the datagram is dropped from the
+         * first sample that can not be decoded.
+         */
+        void processCompact(DataBuffer& sub);
+
+        /**
+         * Clear the dictionary if given server
+         * session id differs from its session.
+         * Return false if the dictionary was cleared.
+         */
+        bool checkSession(uint64_t session);
+
+        /**
+         * Store given MsgStreamFrameChunk chunk and
+         * forward the frame when complete
+         */
+        void processFrameChunk(DataBuffer& sub);
+
+        /**
+         * Drop incomplete frames older than
+         * FrameTimeout
+         */
+        void checkFrameTimeout();
+
+        /**
+         * Count given frame as dropped 
+         * if it is not complete
+         */
+        void dropFrame(const std::string& name, FrameAssembly& frame);
 };
 
 }
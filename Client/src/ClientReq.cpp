@@ -36,6 +36,11 @@ std::vector<std::string> ClientReq::listValuesStr
 {
     return listNames(MsgAskValuesStr, name);
 }
+std::vector<std::string> ClientReq::listValuesFloatArray
+    (const std::string& name)
+{
+    return listNames(MsgAskValuesFloatArray, name);
+}
 
 std::vector<std::string> ClientReq::listCommands
     (const std::string& name)
@@ -115,6 +120,29 @@ std::string ClientReq::call(const std::string& name,
     return rep.readStr();
 }
 
+CommandData ClientReq::callBinary(const std::string& name, 
+    const CommandData& arguments)
+{
+    //Allocate message data
+    zmq::message_t request(
+        sizeof(MsgType) + sizeof(int64_t) + name.length()
+        + sizeof(int64_t) + arguments.size());
+    DataBuffer req(request.data(), request.size());
+    //Build data message
+    req.writeType(MsgAskCallBinary);
+    req.writeStr(name);
+    req.writeData(arguments.data(), arguments.size());
+    //Send it
+    _socket.send(request);
+
+    //Wait for server answer
+    zmq::message_t reply;
+    DataBuffer rep = waitReply(reply, MsgCallResultBinary);
+    size_t size;
+    unsigned char* data = rep.readData(size);
+    return CommandData(data, data + size);
+}
+
 bool ClientReq::getBool(const std::string& name)
 {
     //Allocate message data
@@ -183,6 +211,23 @@ std::string ClientReq::getStr(const std::string& name)
     DataBuffer rep = waitReply(reply, MsgValStr);
     return rep.readStr();
 }
+std::vector<double> ClientReq::getFloatArray(const std::string& name)
+{
+    //Allocate message data
+    zmq::message_t request(
+        sizeof(MsgType) + sizeof(int64_t) + name.length());
+    DataBuffer req(request.data(), request.size());
+    //Build data message
+    req.writeType(MsgGetFloatArray);
+    req.writeStr(name);
+    //Send it
+    _socket.send(request);
+
+    //Wait for server answer
+    zmq::message_t reply;
+    DataBuffer rep = waitReply(reply, MsgValFloatArray);
+    return rep.readFloatArray();
+}
 
 void ClientReq::setBool(const std::string& name, bool val)
 {
@@ -257,6 +302,25 @@ void ClientReq::setStr(const std::string& name,
     zmq::message_t reply;
     waitReply(reply, MsgSetOk);
 }
+void ClientReq::setFloatArray(const std::string& name, 
+    const std::vector<double>& val)
+{
+    //Allocate message data
+    zmq::message_t request(
+        sizeof(MsgType) + sizeof(int64_t) 
+        + name.length() + sizeof(int64_t) + val.size()*sizeof(double));
+    DataBuffer req(request.data(), request.size());
+    //Build data message
+    req.writeType(MsgSetFloatArray);
+    req.writeStr(name);
+    req.writeFloatArray(val);
+    //Send it
+    _socket.send(request);
+
+    //Wait for server answer
+    zmq::message_t reply;
+    waitReply(reply, MsgSetOk);
+}
 
 ValueBool ClientReq::metaValueBool(const std::string& name)
 {
@@ -374,6 +438,35 @@ ValueStr ClientReq::metaValueStr(const std::string& name)
 
     return val;
 }
+ValueFloatArray ClientReq::metaValueFloatArray(const std::string& name)
+{
+    //Allocate message data
+    zmq::message_t request(
+        sizeof(MsgType) + sizeof(int64_t) + name.length());
+    DataBuffer req(request.data(), request.size());
+    //Build data message
+    req.writeType(MsgAskMetaFloatArray);
+    req.writeStr(name);
+    //Send it
+    _socket.send(request);
+
+    //Wait for server answer
+    zmq::message_t reply;
+    DataBuffer rep = waitReply(reply, MsgValMetaFloatArray);
+    //Parse reply
+    ValueFloatArray val;
+    val.name = name;
+    val.comment = rep.readStr();
+    val.hasMin = rep.readBool();
+    val.hasMax = rep.readBool();
+    val.persisted = rep.readBool();
+    val.streamWatchers = rep.readInt();
+    val.min = rep.readFloatArray();
+    val.max = rep.readFloatArray();
+    val.valuePersisted = rep.readFloatArray();
+
+    return val;
+}
         
 void ClientReq::enableStreamingValue(const std::string& name)
 {
@@ -423,6 +516,31 @@ void ClientReq::checkStreamingValue(const std::string& name)
     zmq::message_t reply;
     waitReply(reply, MsgStreamingOK);
 }
+
+void ClientReq::setStreamFilter(const std::string& name,
+    const StreamFilter& filter)
+{
+    //Allocate message data
+    zmq::message_t request(
+        sizeof(MsgType) + sizeof(int64_t) + name.length()
+        + sizeof(uint8_t) + 2*sizeof(double) + sizeof(int64_t)
+        + sizeof(uint8_t));
+    DataBuffer req(request.data(), request.size());
+    //Build data message
+    req.writeType(MsgSetStreamFilter);
+    req.writeStr(name);
+    req.writeBool(filter.onChange);
+    req.writeFloat(filter.deadbandAbs);
+    req.writeFloat(filter.deadbandRel);
+    req.writeInt(filter.periodMin);
+    req.writeBool(filter.latestOnly);
+    //Send it
+    _socket.send(request);
+
+    //Wait for server answer
+    zmq::message_t reply;
+    waitReply(reply, MsgStreamingOK);
+}
         
 std::vector<std::string> ClientReq::listStreams
     (const std::string& name)
@@ -478,6 +596,58 @@ Frame ClientReq::metaValueFrame(const std::string& name)
 
     return frame;
 }
+
+Snapshot ClientReq::snapshot(const std::string& name)
+{
+    //Allocate message data
+    zmq::message_t request(
+        sizeof(MsgType) + sizeof(int64_t) + name.length());
+    DataBuffer req(request.data(), request.size());
+    //Build data message
+    req.writeType(MsgAskSnapshot);
+    req.writeStr(name);
+    //Send it
+    _socket.send(request);
+
+    //Wait for server answer
+    zmq::message_t reply;
+    DataBuffer rep = waitReply(reply, MsgSnapshot);
+    //Parse reply
+    Snapshot snapshot;
+    snapshot.isConsistent = rep.readBool();
+    snapshot.valuesBool.resize(rep.readInt());
+    for (SnapshotBool& val : snapshot.valuesBool) {
+        val.name = rep.readStr();
+        val.timestamp = rep.readInt();
+        val.value = rep.readBool();
+    }
+    snapshot.valuesInt.resize(rep.readInt());
+    for (SnapshotInt& val : snapshot.valuesInt) {
+        val.name = rep.readStr();
+        val.timestamp = rep.readInt();
+        val.value = rep.readInt();
+    }
+    snapshot.valuesFloat.resize(rep.readInt());
+    for (SnapshotFloat& val : snapshot.valuesFloat) {
+        val.name = rep.readStr();
+        val.timestamp = rep.readInt();
+        val.value = rep.readFloat();
+    }
+    snapshot.valuesStr.resize(rep.readInt());
+    for (SnapshotStr& val : snapshot.valuesStr) {
+        val.name = rep.readStr();
+        val.timestamp = rep.readInt();
+        val.value = rep.readStr();
+    }
+    snapshot.valuesFloatArray.resize(rep.readInt());
+    for (SnapshotFloatArray& val : snapshot.valuesFloatArray) {
+        val.name = rep.readStr();
+        val.timestamp = rep.readInt();
+        val.value = rep.readFloatArray();
+    }
+
+    return snapshot;
+}
         
 void ClientReq::enableStreamingStream(const std::string& name)
 {
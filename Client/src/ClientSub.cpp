@@ -1,10 +1,13 @@
 #include <stdexcept>
 #include <chrono>
+#include <cstring>
 #include "rhio_client/ClientSub.hpp"
 #include "rhio_common/Protocol.hpp"
 #include "rhio_common/DataBuffer.hpp"
 
 namespace RhIO {
+
+const int ClientSub::FrameTimeout;
         
 ClientSub::ClientSub(const std::string& endpoint) :
     _mutex(),
@@ -13,8 +16,15 @@ ClientSub::ClientSub(const std::string& endpoint) :
     _handlerInt(StreamIntHandler()),
     _handlerFloat(StreamFloatHandler()),
     _handlerStr(StreamStrHandler()),
+    _handlerFloatArray(StreamFloatArrayHandler()),
     _handlerStream(StreamStrHandler()),
     _handlerFrame(StreamFrameHandler()),
+    _dictionary(),
+    _dictionarySession(0),
+    _decodeStr(),
+    _decodeFloatArray(),
+    _frameAssemblies(),
+    _frameStats(),
     //Starting receiver thread
     _thread(&ClientSub::subscriberThread, this, endpoint)
 {
@@ -48,6 +58,11 @@ void ClientSub::setHandlerStr(StreamStrHandler handler)
     std::lock_guard<std::mutex> lock(_mutex);
     _handlerStr = handler;
 }
+void ClientSub::setHandlerFloatArray(StreamFloatArrayHandler handler)
+{
+    std::lock_guard<std::mutex> lock(_mutex);
+    _handlerFloatArray = handler;
+}
 void ClientSub::setHandlerStream(StreamStrHandler handler)
 {
     std::lock_guard<std::mutex> lock(_mutex);
@@ -71,6 +86,8 @@ void ClientSub::subscriberThread(const std::string& endpoint)
     socket.join("rhio");
 
     while (_isContinue) {
+        //Drop too old incomplete frames
+        checkFrameTimeout();
         //Wait for Server next packet
         zmq::message_t packet;
         if (!socket.recv(&packet, ZMQ_NOBLOCK)) {
@@ -88,73 +105,337 @@ void ClientSub::subscriberThread(const std::string& endpoint)
         }
         //Retrieve message type
         MsgType type = (MsgType)sub.readType();
-        if (type == MsgStreamBool) {
-            //Stream Bool value
-            std::string name = sub.readStr();
-            int64_t timestamp = sub.readInt();
-            bool val = sub.readBool();
-            std::lock_guard<std::mutex> lock(_mutex);
+        if (type == MsgStreamBatch) {
+            //Unpack all samples of packed datagram
+            while (sub.offset() < sub.size()) {
+                processSample((MsgType)sub.readType(), sub);
+            }
+        } else if (type == MsgStreamDictionary) {
+            processDictionary(sub);
+        } else if (type == MsgStreamCompact) {
+            processCompact(sub);
+        } else if (type == MsgStreamFrameChunk) {
+            processFrameChunk(sub);
+        } else {
+            processSample(type, sub);
+        }
+    }
+}
+
+ClientSub::FrameStats ClientSub::getFrameStats(const std::string& name)
+{
+    std::lock_guard<std::mutex> lock(_mutex);
+    if (_frameStats.count(name) > 0) {
+        return _frameStats.at(name);
+    } else {
+        return FrameStats();
+    }
+}
+
+void ClientSub::processFrameChunk(DataBuffer& sub)
+{
+    //Decode chunk header
+    size_t length = sub.readVarInt();
+    const unsigned char* name = sub.readRaw(length);
+    _decodeStr.assign((const char*)name, length);
+    uint64_t seq = sub.readVarInt();
+    int64_t timestamp = sub.readVarIntSigned();
+    size_t width = sub.readVarInt();
+    size_t height = sub.readVarInt();
+    size_t size = sub.readVarInt();
+    size_t index = sub.readVarInt();
+    size_t count = sub.readVarInt();
+    size_t sizeChunk = sub.size() - sub.offset();
+    const unsigned char* data = sub.readRaw(sizeChunk);
+    //Check chunk bounds (all chunks but
+    //the last one have the same size)
+    if (
+        index >= count || 
+        (index+1 < count && (index+1)*sizeChunk > size) ||
+        (index+1 == count && size < sizeChunk)
+    ) {
+        throw std::logic_error(
+            "RhIOClient invalid frame chunk");
+    }
+    
+    //Start the assembly of a newer frame.
+    //Chunks of slightly older frames are late 
+    //and ignored while a large gap means 
+    //that the server has been restarted.
+    FrameAssembly& frame = _frameAssemblies[_decodeStr];
+    if (frame.count == 0 || seq != frame.seq) {
+        if (
+            frame.count != 0 && 
+            seq < frame.seq && 
+            frame.seq - seq < FrameSeqWindow
+        ) {
+            return;
+        }
+        dropFrame(_decodeStr, frame);
+        frame.seq = seq;
+        frame.timestamp = timestamp;
+        frame.width = width;
+        frame.height = height;
+        frame.data.resize(size);
+        frame.isReceived.assign(count, false);
+        frame.count = count;
+        frame.countReceived = 0;
+        frame.isDone = false;
+        frame.timeStart = std::chrono::steady_clock::now();
+    }
+    if (
+        frame.isDone || 
+        frame.isReceived[index] || 
+        count != frame.count || 
+        size != frame.data.size()
+    ) {
+        return;
+    }
+
+    //Copy chunk data at its 
+    //offset in the frame
+    size_t offset = (index+1 == count) ? 
+        size - sizeChunk : index*sizeChunk;
+    std::memcpy(frame.data.data() + offset, data, sizeChunk);
+    frame.isReceived[index] = true;
+    frame.countReceived++;
+
+    //Forward complete frame
+    if (frame.countReceived == frame.count) {
+        frame.isDone = true;
+        std::lock_guard<std::mutex> lock(_mutex);
+        _frameStats[_decodeStr].countFrames++;
+        _frameStats[_decodeStr].countChunks += frame.count;
+        if (_handlerFrame) {
+            _handlerFrame(_decodeStr, frame.timestamp, 
+                frame.width, frame.height, 
+                frame.data.data(), frame.data.size());
+        }
+    }
+}
+
+void ClientSub::checkFrameTimeout()
+{
+    auto now = std::chrono::steady_clock::now();
+    for (auto& it : _frameAssemblies) {
+        if (
+            !it.second.isDone && 
+            it.second.count != 0 &&
+            now - it.second.timeStart > 
+                std::chrono::milliseconds(FrameTimeout)
+        ) {
+            dropFrame(it.first, it.second);
+        }
+    }
+}
+
+void ClientSub::dropFrame(const std::string& name, FrameAssembly& frame)
+{
+    if (frame.isDone || frame.count == 0) {
+        return;
+    }
+    frame.isDone = true;
+    std::lock_guard<std::mutex> lock(_mutex);
+    _frameStats[name].countDropped++;
+    _frameStats[name].countChunks += frame.countReceived;
+    _frameStats[name].countChunksLost += frame.count - frame.countReceived;
+}
+
+void ClientSub::processDictionary(DataBuffer& sub)
+{
+    try {
+        checkSession(sub.readVarInt());
+        while (sub.offset() < sub.size()) {
+            size_t id = sub.readVarInt();
+            MsgType type = (MsgType)sub.readType();
+            size_t length = sub.readVarInt();
+            const unsigned char* name = sub.readRaw(length);
+            if (id >= _dictionary.size()) {
+                _dictionary.resize(id + 1);
+            }
+            _dictionary[id].type = type;
+            _dictionary[id].name.assign((const char*)name, length);
+        }
+    } catch (const std::logic_error&) {
+        //Truncated datagram, the entries 
+        //already read are kept
+    }
+}
+
+void ClientSub::processCompact(DataBuffer& sub)
+{
+    int64_t timestamp = 0;
+    bool valBool = false;
+    int64_t valInt = 0;
+    double valFloat = 0.0;
+    try {
+        //Samples of another server session can not
+        //be decoded with the current dictionary
+        if (!checkSession(sub.readVarInt())) {
+            return;
+        }
+    } catch (const std::logic_error&) {
+        return;
+    }
+    while (sub.offset() < sub.size()) {
+        //Decode the sample. Samples of not yet 
+        //announced values or not matching their 
+        //announced type can not be decoded and 
+        //the rest of the datagram is dropped
+        const DictionaryEntry* entry = nullptr;
+        try {
+            size_t id = sub.readVarInt();
+            timestamp += sub.readVarIntSigned();
+            if (id >= _dictionary.size() || _dictionary[id].type == 0) {
+                return;
+            }
+            entry = &_dictionary[id];
+            if (entry->type == MsgStreamBool) {
+                valBool = sub.readBool();
+            } else if (entry->type == MsgStreamInt) {
+                valInt = sub.readVarIntSigned();
+            } else if (entry->type == MsgStreamFloat) {
+                valFloat = sub.readFloat();
+            } else if (entry->type == MsgStreamStr) {
+                //Decode into reused buffer
+                size_t length = sub.readVarInt();
+                const unsigned char* data = sub.readRaw(length);
+                _decodeStr.assign((const char*)data, length);
+            } else if (entry->type == MsgStreamFloatArray) {
+                //Decode into reused buffer
+                size_t size = sub.readVarInt();
+                if (size > (sub.size() - sub.offset())/sizeof(double)) {
+                    return;
+                }
+                const unsigned char* data = 
+                    sub.readRaw(size*sizeof(double));
+                _decodeFloatArray.resize(size);
+                std::memcpy(_decodeFloatArray.data(), 
+                    data, size*sizeof(double));
+            } else {
+                return;
+            }
+        } catch (const std::logic_error&) {
+            return;
+        }
+        //Call the sample handler
+        std::lock_guard<std::mutex> lock(_mutex);
+        if (entry->type == MsgStreamBool) {
             if (_handlerBool) {
-                _handlerBool(name, timestamp, val);
+                _handlerBool(entry->name, timestamp, valBool);
             }
-            continue;
-        } else if (type == MsgStreamInt) {
-            //Stream Int value
-            std::string name = sub.readStr();
-            int64_t timestamp = sub.readInt();
-            int64_t val = sub.readInt();
-            std::lock_guard<std::mutex> lock(_mutex);
+        } else if (entry->type == MsgStreamInt) {
             if (_handlerInt) {
-                _handlerInt(name, timestamp, val);
+                _handlerInt(entry->name, timestamp, valInt);
             }
-            continue;
-        } else if (type == MsgStreamFloat) {
-            //Stream Float value
-            std::string name = sub.readStr();
-            int64_t timestamp = sub.readInt();
-            double val = sub.readFloat();
-            std::lock_guard<std::mutex> lock(_mutex);
+        } else if (entry->type == MsgStreamFloat) {
             if (_handlerFloat) {
-                _handlerFloat(name, timestamp, val);
+                _handlerFloat(entry->name, timestamp, valFloat);
             }
-            continue;
-        } else if (type == MsgStreamStr) {
-            //Stream Str value
-            std::string name = sub.readStr();
-            int64_t timestamp = sub.readInt();
-            std::string val = sub.readStr();
-            std::lock_guard<std::mutex> lock(_mutex);
+        } else if (entry->type == MsgStreamStr) {
             if (_handlerStr) {
-                _handlerStr(name, timestamp, val);
+                _handlerStr(entry->name, timestamp, _decodeStr);
             }
-            continue;
-        } else if (type == MsgStreamStream) {
-            //Stream Stream value
-            std::string name = sub.readStr();
-            int64_t timestamp = sub.readInt();
-            std::string val = sub.readStr();
-            std::lock_guard<std::mutex> lock(_mutex);
-            if (_handlerStream) {
-                _handlerStream(name, timestamp, val);
-            }
-            continue;
-        } else if (type == MsgStreamFrame) {
-            //Stream Frame value
-            std::string name = sub.readStr();
-            int64_t timestamp = sub.readInt();
-            int64_t width = sub.readInt();
-            int64_t height = sub.readInt();
-            size_t size;
-            unsigned char* data = sub.readData(size);
-            std::lock_guard<std::mutex> lock(_mutex);
-            if (_handlerFrame) {
-                _handlerFrame(name, timestamp, width, height, data, size);
-            }
-            continue;
         } else {
-            throw std::logic_error(
-                "RhIOClient invalid stream message type");
+            if (_handlerFloatArray) {
+                _handlerFloatArray(entry->name, 
+                    timestamp, _decodeFloatArray);
+            }
+        }
+    }
+}
+
+bool ClientSub::checkSession(uint64_t session)
+{
+    if (session == _dictionarySession) {
+        return true;
+    }
+    //The server has been restarted and
+    //its value ids may have changed
+    _dictionary.clear();
+    _dictionarySession = session;
+
+    return false;
+}
+
+void ClientSub::processSample(MsgType type, DataBuffer& sub)
+{
+    if (type == MsgStreamBool) {
+        //Stream Bool value
+        std::string name = sub.readStr();
+        int64_t timestamp = sub.readInt();
+        bool val = sub.readBool();
+        std::lock_guard<std::mutex> lock(_mutex);
+        if (_handlerBool) {
+            _handlerBool(name, timestamp, val);
+        }
+        return;
+    } else if (type == MsgStreamInt) {
+        //Stream Int value
+        std::string name = sub.readStr();
+        int64_t timestamp = sub.readInt();
+        int64_t val = sub.readInt();
+        std::lock_guard<std::mutex> lock(_mutex);
+        if (_handlerInt) {
+            _handlerInt(name, timestamp, val);
+        }
+        return;
+    } else if (type == MsgStreamFloat) {
+        //Stream Float value
+        std::string name = sub.readStr();
+        int64_t timestamp = sub.readInt();
+        double val = sub.readFloat();
+        std::lock_guard<std::mutex> lock(_mutex);
+        if (_handlerFloat) {
+            _handlerFloat(name, timestamp, val);
+        }
+        return;
+    } else if (type == MsgStreamStr) {
+        //Stream Str value
+        std::string name = sub.readStr();
+        int64_t timestamp = sub.readInt();
+        std::string val = sub.readStr();
+        std::lock_guard<std::mutex> lock(_mutex);
+        if (_handlerStr) {
+            _handlerStr(name, timestamp, val);
+        }
+        return;
+    } else if (type == MsgStreamFloatArray) {
+        //Stream FloatArray value
+        std::string name = sub.readStr();
+        int64_t timestamp = sub.readInt();
+        std::vector<double> val = sub.readFloatArray();
+        std::lock_guard<std::mutex> lock(_mutex);
+        if (_handlerFloatArray) {
+            _handlerFloatArray(name, timestamp, val);
+        }
+        return;
+    } else if (type == MsgStreamStream) {
+        //Stream Stream value
+        std::string name = sub.readStr();
+        int64_t timestamp = sub.readInt();
+        std::string val = sub.readStr();
+        std::lock_guard<std::mutex> lock(_mutex);
+        if (_handlerStream) {
+            _handlerStream(name, timestamp, val);
+        }
+        return;
+    } else if (type == MsgStreamFrame) {
+        //Stream Frame value
+        std::string name = sub.readStr();
+        int64_t timestamp = sub.readInt();
+        int64_t width = sub.readInt();
+        int64_t height = sub.readInt();
+        size_t size;
+        unsigned char* data = sub.readData(size);
+        std::lock_guard<std::mutex> lock(_mutex);
+        if (_handlerFrame) {
+            _handlerFrame(name, timestamp, width, height, data, size);
         }
+        return;
+    } else {
+        throw std::logic_error(
+            "RhIOClient invalid stream message type");
     }
 }
 
@@ -0,0 +1,257 @@
+#ifndef RHIO_COMMANDARGS_HPP
+#define RHIO_COMMANDARGS_HPP
+
+#include <string>
+#include <vector>
+#include <stdexcept>
+#include <cstdint>
+#include "rhio_common/DataBuffer.hpp"
+
+namespace RhIO {
+
+/**
+ * Binary command argument type tag
+ * written before each argument
+ */
+enum CommandArgType : uint8_t {
+    ArgBool = 1,
+    ArgInt = 2,
+    ArgFloat = 3,
+    ArgStr = 4,
+    ArgFloatArray = 5,
+    ArgData = 6
+};
+
+/**
+ * Typedef for binary command arguments
+ * and result raw bytes (and raw byte
+ * blob argument type)
+ */
+typedef std::vector<unsigned char> CommandData;
+
+/**
+ * Generic binary encoding of typed command
+ * argument (only for typical type): tag,
+ * encoded size, write and read
+ */
+//Used to fail static_assert
+template<typename T>
+struct CommandArgError : std::false_type {};
+//Default (not implemented) implemented case
+template <typename T>
+struct CommandArg {
+    inline static size_t size(const T& val) {
+        static_assert(CommandArgError<T>::value,
+            "RhIO type used is unsupported by binary command arguments");
+        (void)val;
+        return 0;
+    }
+    inline static void write(DataBuffer& buffer, const T& val) {
+        (void)buffer;
+        (void)val;
+    }
+    inline static T read(DataBuffer& buffer) {
+        (void)buffer;
+        return T();
+    }
+};
+/**
+ * Check that the next argument
+ * in given buffer has given tag
+ */
+inline void commandArgCheck(DataBuffer& buffer, uint8_t tag)
+{
+    if (buffer.readType() != tag) {
+        throw std::runtime_error(
+            "RhIO binary argument type mismatch");
+    }
+}
+//Type specialization
+template <>
+struct CommandArg<bool> {
+    inline static size_t size(const bool& val) {
+        (void)val;
+        return sizeof(uint8_t) + sizeof(uint8_t);
+    }
+    inline static void write(DataBuffer& buffer, const bool& val) {
+        buffer.writeType(ArgBool);
+        buffer.writeBool(val);
+    }
+    inline static bool read(DataBuffer& buffer) {
+        commandArgCheck(buffer, ArgBool);
+        return buffer.readBool();
+    }
+};
+/**
+ * All integer types are
+ * transmitted as int64_t
+ */
+template <typename T>
+struct CommandArgInt {
+    inline static size_t size(const T& val) {
+        (void)val;
+        return sizeof(uint8_t) + sizeof(int64_t);
+    }
+    inline static void write(DataBuffer& buffer, const T& val) {
+        buffer.writeType(ArgInt);
+        buffer.writeInt((int64_t)val);
+    }
+    inline static T read(DataBuffer& buffer) {
+        commandArgCheck(buffer, ArgInt);
+        return (T)buffer.readInt();
+    }
+};
+template <>
+struct CommandArg<int> : public CommandArgInt<int> {};
+template <>
+struct CommandArg<unsigned int> : public CommandArgInt<unsigned int> {};
+template <>
+struct CommandArg<long> : public CommandArgInt<long> {};
+template <>
+struct CommandArg<unsigned long> : public CommandArgInt<unsigned long> {};
+template <>
+struct CommandArg<char> : public CommandArgInt<char> {};
+template <>
+struct CommandArg<unsigned char> : public CommandArgInt<unsigned char> {};
+/**
+ * All floating point types are
+ * transmitted as double
+ */
+template <typename T>
+struct CommandArgFloat {
+    inline static size_t size(const T& val) {
+        (void)val;
+        return sizeof(uint8_t) + sizeof(double);
+    }
+    inline static void write(DataBuffer& buffer, const T& val) {
+        buffer.writeType(ArgFloat);
+        buffer.writeFloat((double)val);
+    }
+    inline static T read(DataBuffer& buffer) {
+        commandArgCheck(buffer, ArgFloat);
+        return (T)buffer.readFloat();
+    }
+};
+template <>
+struct CommandArg<float> : public CommandArgFloat<float> {};
+template <>
+struct CommandArg<double> : public CommandArgFloat<double> {};
+template <>
+struct CommandArg<std::string> {
+    inline static size_t size(const std::string& val) {
+        return sizeof(uint8_t) + sizeof(int64_t) + val.length();
+    }
+    inline static void write(DataBuffer& buffer, const std::string& val) {
+        buffer.writeType(ArgStr);
+        buffer.writeStr(val);
+    }
+    inline static std::string read(DataBuffer& buffer) {
+        commandArgCheck(buffer, ArgStr);
+        return buffer.readStr();
+    }
+};
+template <>
+struct CommandArg<std::vector<double>> {
+    inline static size_t size(const std::vector<double>& val) {
+        return sizeof(uint8_t) + sizeof(int64_t)
+            + val.size()*sizeof(double);
+    }
+    inline static void write(DataBuffer& buffer,
+        const std::vector<double>& val)
+    {
+        buffer.writeType(ArgFloatArray);
+        buffer.writeFloatArray(val);
+    }
+    inline static std::vector<double> read(DataBuffer& buffer) {
+        commandArgCheck(buffer, ArgFloatArray);
+        return buffer.readFloatArray();
+    }
+};
+template <>
+struct CommandArg<CommandData> {
+    inline static size_t size(const CommandData& val) {
+        return sizeof(uint8_t) + sizeof(int64_t) + val.size();
+    }
+    inline static void write(DataBuffer& buffer, const CommandData& val) {
+        buffer.writeType(ArgData);
+        buffer.writeData(val.data(), val.size());
+    }
+    inline static CommandData read(DataBuffer& buffer) {
+        commandArgCheck(buffer, ArgData);
+        size_t size;
+        unsigned char* data = buffer.readData(size);
+        return CommandData(data, data + size);
+    }
+};
+
+/**
+ * Return the encoded size and write
+ * given arguments list
+ */
+inline size_t commandArgsSize()
+{
+    return 0;
+}
+template <typename Arg, typename ... Args>
+size_t commandArgsSize(const Arg& arg, const Args& ... args)
+{
+    return CommandArg<Arg>::size(arg) + commandArgsSize(args...);
+}
+inline void commandArgsWrite(DataBuffer& buffer)
+{
+    (void)buffer;
+}
+template <typename Arg, typename ... Args>
+void commandArgsWrite(DataBuffer& buffer,
+    const Arg& arg, const Args& ... args)
+{
+    CommandArg<Arg>::write(buffer, arg);
+    commandArgsWrite(buffer, args...);
+}
+
+/**
+ * Encode given typed arguments into binary
+ * command arguments (or result) raw bytes.
+ * Format:
+ * Int: number of arguments
+ * Type: argument 1 tag
+ * argument 1 value
+ * ...
+ */
+template <typename ... Args>
+CommandData commandArgsPack(const Args& ... args)
+{
+    CommandData data(sizeof(int64_t) + commandArgsSize(args...));
+    DataBuffer buffer(data.data(), data.size());
+    buffer.writeInt(sizeof...(Args));
+    commandArgsWrite(buffer, args...);
+    return data;
+}
+
+/**
+ * Decode the single typed value of given binary
+ * command result. Throw std::runtime_error if the
+ * result does not hold exactly one value of given type.
+ */
+template <typename T>
+struct CommandResult {
+    inline static T unpack(const CommandData& data) {
+        DataBuffer buffer((void*)data.data(), data.size());
+        if (buffer.readInt() != 1) {
+            throw std::runtime_error(
+                "RhIO binary result invalid count");
+        }
+        return CommandArg<T>::read(buffer);
+    }
+};
+template <>
+struct CommandResult<void> {
+    inline static void unpack(const CommandData& data) {
+        (void)data;
+    }
+};
+
+}
+
+#endif
+
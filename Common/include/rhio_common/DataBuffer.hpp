@@ -2,6 +2,7 @@
 #define RHIO_DATABUFFER_HPP
 
 #include <string>
+#include <vector>
 
 namespace RhIO {
 
@@ -35,6 +36,18 @@ class DataBuffer
         void writeFloat(double val);
         void writeStr(const std::string& val);
         void writeData(const unsigned char* data, size_t size);
+        void writeFloatArray(const std::vector<double>& val);
+
+        /**
+         * Write given unsigned integer as a variable 
+         * length integer (7 bits per byte, little endian), 
+         * given signed integer as a zigzag encoded variable
+         * length integer and given raw bytes 
+         * (without size prefix) and update cursor
+         */
+        void writeVarInt(uint64_t val);
+        void writeVarIntSigned(int64_t val);
+        void writeRaw(const void* data, size_t size);
 
         /**
          * Read each type into data buffer
@@ -46,6 +59,16 @@ class DataBuffer
         double readFloat();
         std::string readStr();
         unsigned char* readData(size_t& size);
+        std::vector<double> readFloatArray();
+
+        /**
+         * Read variable length unsigned and signed 
+         * integer and return the pointer to given 
+         * size raw bytes (no copy) and update cursor
+         */
+        uint64_t readVarInt();
+        int64_t readVarIntSigned();
+        const unsigned char* readRaw(size_t size);
 
         /**
          * Return internal data pointer
@@ -0,0 +1,170 @@
+#ifndef RHIO_LOCKFREECOUNTERS_HPP
+#define RHIO_LOCKFREECOUNTERS_HPP
+
+#include <atomic>
+#include <memory>
+#include <cstdint>
+
+namespace RhIO {
+
+/**
+ * LockFreeCounters
+ *
+ * Table of counters indexed by value id
+ * incremented by multiple RealTime (RT) writers
+ * and read by a non RT reader. Counters are stored
+ * in fixed size chunks allocated by the reader
+ * (see reserve()) so that the table grows with
+ * the value id space without moving counters
+ * and writers never allocate.
+ * Counts of ids without allocated counter
+ * (not yet reserved or beyond ChunkSize*MaxChunks)
+ * are aggregated in a single other counter.
+ */
+class LockFreeCounters
+{
+    public:
+
+        /**
+         * Number of counters per chunk
+         * and maximum number of chunks
+         */
+        static const size_t ChunkSize = 4096;
+        static const size_t MaxChunks = 4096;
+
+        /**
+         * Initialization with the number
+         * of pre-allocated counters
+         * (maximum value id plus one)
+         */
+        LockFreeCounters(size_t size) :
+            _size(0),
+            _chunks(new std::atomic<std::atomic<uint64_t>*>[MaxChunks]),
+            _countOther(0)
+        {
+            for (size_t i=0;i<MaxChunks;i++) {
+                _chunks[i].store(nullptr);
+            }
+            reserve(size);
+        }
+
+        /**
+         * Free allocated chunks
+         */
+        ~LockFreeCounters()
+        {
+            for (size_t i=0;i<MaxChunks;i++) {
+                delete[] _chunks[i].load();
+            }
+        }
+
+        /**
+         * Copy is forbidden
+         */
+        LockFreeCounters(const LockFreeCounters&) = delete;
+        LockFreeCounters& operator=(const LockFreeCounters&) = delete;
+
+        /**
+         * Return the number of allocated counters
+         */
+        size_t size() const
+        {
+            return _size.load(std::memory_order_acquire);
+        }
+
+        /**
+         * Allocate the counters of ids lower
+         * than given size (up to ChunkSize*MaxChunks).
+         * Only called by the reader (not RT),
+         * no allocation if already reserved.
+         */
+        void reserve(size_t size)
+        {
+            size_t current = _size.load(std::memory_order_relaxed);
+            if (size <= current) {
+                return;
+            }
+            size_t countChunks = (size + ChunkSize - 1)/ChunkSize;
+            if (countChunks > MaxChunks) {
+                countChunks = MaxChunks;
+            }
+            for (size_t i=current/ChunkSize;i<countChunks;i++) {
+                std::atomic<uint64_t>* chunk =
+                    new std::atomic<uint64_t>[ChunkSize];
+                for (size_t j=0;j<ChunkSize;j++) {
+                    chunk[j].store(0, std::memory_order_relaxed);
+                }
+                _chunks[i].store(chunk, std::memory_order_release);
+            }
+            _size.store(countChunks*ChunkSize, std::memory_order_release);
+        }
+
+        /**
+         * Increase the counter of given id by given count.
+         * RT, thread safe, no dynamic allocation.
+         */
+        void add(size_t id, uint64_t count = 1)
+        {
+            size_t index = id/ChunkSize;
+            if (index < MaxChunks) {
+                std::atomic<uint64_t>* chunk =
+                    _chunks[index].load(std::memory_order_acquire);
+                if (chunk != nullptr) {
+                    chunk[id%ChunkSize].fetch_add(
+                        count, std::memory_order_relaxed);
+                    return;
+                }
+            }
+            _countOther.fetch_add(count, std::memory_order_relaxed);
+        }
+
+        /**
+         * Return the counter of given id
+         */
+        uint64_t get(size_t id) const
+        {
+            size_t index = id/ChunkSize;
+            if (index < MaxChunks) {
+                std::atomic<uint64_t>* chunk =
+                    _chunks[index].load(std::memory_order_acquire);
+                if (chunk != nullptr) {
+                    return chunk[id%ChunkSize].load(
+                        std::memory_order_relaxed);
+                }
+            }
+            return 0;
+        }
+
+        /**
+         * Return the aggregated count of
+         * ids without allocated counter
+         */
+        uint64_t getOther() const
+        {
+            return _countOther.load(std::memory_order_relaxed);
+        }
+
+    private:
+
+        /**
+         * Number of allocated counters
+         */
+        std::atomic<size_t> _size;
+
+        /**
+         * Fixed size directory of counters
+         * chunks (null if not allocated)
+         */
+        std::unique_ptr<std::atomic<std::atomic<uint64_t>*>[]> _chunks;
+
+        /**
+         * Aggregated counter of ids
+         * without allocated counter
+         */
+        std::atomic<uint64_t> _countOther;
+};
+
+}
+
+#endif
+
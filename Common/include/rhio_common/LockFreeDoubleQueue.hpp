@@ -3,6 +3,7 @@
 
 #include <vector>
 #include <atomic>
+#include <cstdint>
 
 namespace RhIO {
 
@@ -15,6 +16,9 @@ namespace RhIO {
  * The writer operation is lock free with
  * no dynamic allocation (with potentially exceptions
  * due to given template type).
+ * Appended and dropped values and the buffer high
+ * water mark are mostly accounted by the reader at 
+ * swap so that writers pay no extra cost.
  */
 template <typename T>
 class LockFreeDoubleQueue
@@ -29,7 +33,10 @@ class LockFreeDoubleQueue
             _maxSize(maxSize),
             _state1(true),
             _state2(false),
-            _statePtr(nullptr)
+            _statePtr(nullptr),
+            _countAppended(0),
+            _countDropped(0),
+            _highWater(0)
         {
             //State initialization
             _statePtr.store(&_state1);
@@ -63,6 +70,15 @@ class LockFreeDoubleQueue
             while (stateOld->stillWriting.load() != 0) {
                 //Wait
             }
+            //Account the swapped buffer. Writers increase 
+            //the length even when the value is dropped.
+            size_t length = stateOld->length.load();
+            size_t used = (length > _maxSize) ? _maxSize : length;
+            _countAppended.fetch_add(used, std::memory_order_relaxed);
+            _countDropped.fetch_add(length - used, std::memory_order_relaxed);
+            if (used > _highWater.load(std::memory_order_relaxed)) {
+                _highWater.store(used, std::memory_order_relaxed);
+            }
         }
 
         /**
@@ -107,9 +123,8 @@ class LockFreeDoubleQueue
         {
             bool isOk = false;
             //Retrieve current writting buffer state
-            State_t* state = _statePtr.load();
-            //Take writing lock on buffer (wait in swapBuffer)
-            state->stillWriting.fetch_add(1);
+            //and take writing lock on buffer
+            State_t* state = lockFromWriter();
             //Retrieve next to write index and
             //atomically increase it (after reading)
             size_t index = state->length.fetch_add(1);
@@ -124,6 +139,77 @@ class LockFreeDoubleQueue
             return isOk;
         }
 
+        /**
+         * Append to internal queue a contiguous block
+         * of given count values. The given function
+         * func(i, cell) is called to write the i-th value
+         * of the block into its reserved buffer cell.
+         * RT, thread safe, no dynamic allocation.
+         * The block is either fully appended or fully
+         * dropped if the internal buffer has not enough room.
+         * Return false if the block has been dropped.
+         */
+        template <typename Func>
+        bool appendBlockFromWriter(size_t count, Func func)
+        {
+            bool isOk = false;
+            //Retrieve current writting buffer state
+            //and take writing lock on buffer
+            State_t* state = lockFromWriter();
+            //Reserve the whole block only if it fits
+            //in the buffer so that no partially written
+            //cells are ever exposed to the reader
+            size_t index = state->length.load();
+            while (index + count <= _maxSize) {
+                if (state->length.compare_exchange_weak(
+                    index, index + count)
+                ) {
+                    isOk = true;
+                    break;
+                }
+            }
+            //Write the block
+            if (isOk) {
+                for (size_t i=0;i<count;i++) {
+                    func(i, state->buffer[index + i]);
+                }
+            } else {
+                _countDropped.fetch_add(count, std::memory_order_relaxed);
+            }
+            //Release the lock
+            state->stillWriting.fetch_sub(1);
+
+            return isOk;
+        }
+
+        /**
+         * Return the buffer capacity
+         */
+        size_t getCapacity() const
+        {
+            return _maxSize;
+        }
+
+        /**
+         * Return the total number of values appended
+         * and dropped (buffer full) and the maximum
+         * buffer length reached, as accounted at
+         * last swap (dropped blocks are accounted
+         * by their writer). Thread safe.
+         */
+        uint64_t getCountAppended() const
+        {
+            return _countAppended.load(std::memory_order_relaxed);
+        }
+        uint64_t getCountDropped() const
+        {
+            return _countDropped.load(std::memory_order_relaxed);
+        }
+        size_t getHighWater() const
+        {
+            return _highWater.load(std::memory_order_relaxed);
+        }
+
     private:
 
         /**
@@ -163,6 +249,27 @@ class LockFreeDoubleQueue
             }
         };
         
+        /**
+         * Return the current writing buffer state
+         * with its writing lock taken (wait in swapBuffer).
+         * The state is checked again once locked since
+         * the reader may have swapped the buffers and 
+         * stopped waiting for its writers meanwhile.
+         */
+        State_t* lockFromWriter()
+        {
+            State_t* state = _statePtr.load();
+            while (true) {
+                state->stillWriting.fetch_add(1);
+                State_t* stateCurrent = _statePtr.load();
+                if (stateCurrent == state) {
+                    return state;
+                }
+                state->stillWriting.fetch_sub(1);
+                state = stateCurrent;
+            }
+        }
+
         /**
          * Maximum data contained by each buffers.
          * Use for pre-dynamic allocation.
@@ -180,6 +287,14 @@ class LockFreeDoubleQueue
          * buffer currently used for writting
          */
         std::atomic<State_t*> _statePtr;
+
+        /**
+         * Total appended and dropped values
+         * and buffer length high water mark
+         */
+        std::atomic<uint64_t> _countAppended;
+        std::atomic<uint64_t> _countDropped;
+        std::atomic<size_t> _highWater;
 };
 
 }
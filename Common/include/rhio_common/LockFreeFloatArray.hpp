@@ -0,0 +1,109 @@
+#ifndef RHIO_LOCKFREEFLOATARRAY_HPP
+#define RHIO_LOCKFREEFLOATARRAY_HPP
+
+#include <vector>
+#include <cstdint>
+#include <atomic>
+#include <memory>
+#include <ostream>
+
+namespace RhIO {
+
+/**
+ * LockFreeFloatArray
+ *
+ * Fixed length array of double protected
+ * by a sequence lock. Readers never lock nor 
+ * block writers, they retry their copy if a 
+ * write occurred meanwhile. Concurrent writers
+ * are serialized by spinning on the sequence
+ * counter (no system lock). Elements are stored
+ * contiguously.
+ */
+class LockFreeFloatArray
+{
+    public:
+
+        /**
+         * Initialization with empty
+         * or given array
+         */
+        LockFreeFloatArray();
+        LockFreeFloatArray(const std::vector<double>& vect);
+
+        /**
+         * Copy constructor and assignment
+         * (deep copy of the current array)
+         */
+        LockFreeFloatArray(const LockFreeFloatArray& vect);
+        LockFreeFloatArray& operator=(const LockFreeFloatArray& vect);
+
+        /**
+         * Replace the array and its length.
+         * No concurrent access is assumed.
+         */
+        LockFreeFloatArray& operator=(const std::vector<double>& vect);
+
+        /**
+         * Return the fixed array length
+         */
+        size_t size() const;
+
+        /**
+         * Return a copy of the current array.
+         * The non allocating version copies 
+         * the array into given buffer of 
+         * size() length.
+         * Lock free and thread safe.
+         */
+        std::vector<double> load() const;
+        void load(double* data) const;
+        operator std::vector<double>() const;
+
+        /**
+         * Return the element at given index.
+         * The element is read atomically but not
+         * consistently with other elements.
+         * No bound checking.
+         */
+        double at(size_t index) const;
+
+        /**
+         * Atomically replace the array content
+         * with given data of size() length.
+         * Lock free for readers, no allocation.
+         * The vector version throws std::logic_error
+         * if the vector length is not size().
+         */
+        void store(const double* data);
+        void store(const std::vector<double>& vect);
+
+    private:
+
+        /**
+         * Sequence counter, odd 
+         * while a write is in progress
+         */
+        std::atomic<uint64_t> _seq;
+
+        /**
+         * Array length and elements
+         */
+        size_t _size;
+        std::unique_ptr<std::atomic<double>[]> _data;
+};
+
+/**
+ * Comparison and stream operators
+ * with standard vectors
+ */
+bool operator==(const LockFreeFloatArray& vect1, const std::vector<double>& vect2);
+bool operator==(const std::vector<double>& vect1, const LockFreeFloatArray& vect2);
+bool operator!=(const LockFreeFloatArray& vect1, const std::vector<double>& vect2);
+bool operator!=(const std::vector<double>& vect1, const LockFreeFloatArray& vect2);
+std::ostream& operator<<(std::ostream& os, const LockFreeFloatArray& vect);
+
+}
+
+#endif
+
@@ -0,0 +1,186 @@
+#ifndef RHIO_LOCKFREELATESTSLOTS_HPP
+#define RHIO_LOCKFREELATESTSLOTS_HPP
+
+#include <vector>
+#include <atomic>
+#include <memory>
+#include "rhio_common/LockFreeDoubleQueue.hpp"
+
+namespace RhIO {
+
+/**
+ * LockFreeLatestSlots
+ *
+ * Multiple RealTime (RT) writers storing
+ * the latest sample of each value in a fixed
+ * slot indexed by value id while a non RT
+ * reader collects the slots updated since
+ * its last swap. Older samples are overwritten
+ * so that the reader load is bounded by the
+ * number of values instead of the update rate.
+ * The writer operation is lock free with
+ * no dynamic allocation: a writer never waits
+ * for another writer of the same slot and 
+ * rather reports the sample as not stored.
+ * T must be a type supported by std::atomic.
+ */
+template <typename T>
+class LockFreeLatestSlots
+{
+    public:
+
+        /**
+         * Initialization with the number
+         * of pre-allocated slots
+         * (maximum value id plus one)
+         */
+        LockFreeLatestSlots(size_t maxSize) :
+            _maxSize(maxSize),
+            _slots(new Slot_t[maxSize]),
+            _updated(maxSize)
+        {
+        }
+
+        /**
+         * Return the number of slots
+         */
+        size_t size() const
+        {
+            return _maxSize;
+        }
+
+        /**
+         * Store given sample into the slot
+         * of given value id.
+         * RT, thread safe, no dynamic allocation.
+         * Return false if the id is out of range or
+         * if the slot is being written by another
+         * writer and the sample has not been stored.
+         */
+        bool writeFromWriter(size_t id, T val, int64_t timestamp)
+        {
+            if (id >= _maxSize) {
+                return false;
+            }
+            Slot_t& slot = _slots[id];
+            //Try to take the slot sequence lock
+            //(odd while writing) without waiting
+            //for a concurrent writer
+            uint64_t seq = slot.seq.load();
+            if (
+                (seq & 1) != 0 ||
+                !slot.seq.compare_exchange_strong(seq, seq + 1)
+            ) {
+                return false;
+            }
+            slot.value.store(val, std::memory_order_relaxed);
+            slot.timestamp.store(timestamp, std::memory_order_relaxed);
+            slot.seq.store(seq + 2);
+            //Only the first update since last
+            //read announces the slot to the reader
+            if (!slot.isUpdated.exchange(true)) {
+                _updated.appendFromWriter(id);
+            }
+
+            return true;
+        }
+
+        /**
+         * Swap reading and writing list
+         * of updated slots
+         */
+        void swapBufferFromReader()
+        {
+            _updated.swapBufferFromReader();
+        }
+
+        /**
+         * Return the number of updated
+         * slots owned by the reader
+         */
+        size_t getSizeFromReader() const
+        {
+            return _updated.getSizeFromReader();
+        }
+
+        /**
+         * Read the latest sample of the given
+         * index-th updated slot owned by the reader.
+         * Later writes to the slot are announced
+         * for the next swap.
+         */
+        void readFromReader(size_t index,
+            size_t& id, T& val, int64_t& timestamp)
+        {
+            id = _updated.getBufferFromReader()[index];
+            Slot_t& slot = _slots[id];
+            //Clear the flag before reading so that
+            //no later update is missed
+            slot.isUpdated.store(false);
+            uint64_t seq;
+            do {
+                seq = slot.seq.load();
+                val = slot.value.load(std::memory_order_relaxed);
+                timestamp = slot.timestamp.load(std::memory_order_relaxed);
+                std::atomic_thread_fence(std::memory_order_acquire);
+            } while ((seq & 1) != 0 || seq != slot.seq.load());
+        }
+
+    private:
+
+        /**
+         * Structure for one value slot
+         */
+        struct Slot_t {
+            /**
+             * Sequence lock counter,
+             * odd while being written
+             */
+            std::atomic<uint64_t> seq;
+            /**
+             * Latest sample value
+             * and timestamp
+             */
+            std::atomic<T> value;
+            std::atomic<int64_t> timestamp;
+            /**
+             * True if the slot has been
+             * updated since last read
+             */
+            std::atomic<bool> isUpdated;
+
+            /**
+             * Initialization
+             */
+            Slot_t() :
+                seq(0),
+                value(T()),
+                timestamp(0),
+                isUpdated(false)
+            {
+            }
+        };
+
+        /**
+         * Number of slots
+         */
+        const size_t _maxSize;
+
+        /**
+         * Pre-allocated slots
+         * indexed by value id
+         */
+        std::unique_ptr<Slot_t[]> _slots;
+
+        /**
+         * Double buffered list of ids of
+         * slots updated since last read
+         * (a slot is listed at most once)
+         */
+        LockFreeDoubleQueue<size_t> _updated;
+};
+
+}
+
+#endif
+
@@ -0,0 +1,632 @@
+#ifndef RHIO_LOCKFREERINGQUEUE_HPP
+#define RHIO_LOCKFREERINGQUEUE_HPP
+
+#include <vector>
+#include <atomic>
+#include <memory>
+#include <mutex>
+#include <set>
+#include <utility>
+#include <algorithm>
+#include <cstdint>
+
+namespace RhIO {
+
+/**
+ * LockFreeRingQueue
+ *
+ * Multiple RealTime (RT) writers appending to
+ * their own single producer ring while a non RT
+ * reader drains all rings into its privately
+ * owned buffer. Writers do not share any written
+ * cache line and the reader never waits for writers.
+ * Each writer thread ring is allocated and registered
+ * on its first append. The ring is released when
+ * its thread exits and reused by a next new writer
+ * thread. Later writer operations are
+ * lock free with no dynamic allocation (with potentially
+ * exceptions due to given template type).
+ * Values order is preserved for each writer thread.
+ * Rings are stored in fixed size segments. Only
+ * a head can be pre-allocated, the reader then grows
+ * the rings (outside of the RT path) ahead of the
+ * drained values and recycles the segments it has read.
+ * Same interface than LockFreeDoubleQueue.
+ */
+template <typename T>
+class LockFreeRingQueue
+{
+    public:
+
+        /**
+         * Number of values of a ring segment
+         */
+        static const size_t SegmentSize = 1024;
+
+        /**
+         * Initialization with maximum reader
+         * buffer size, the maximum size of each
+         * writer ring (reader size if zero) and
+         * the number of values pre-allocated
+         * for each ring (ring size if zero)
+         */
+        LockFreeRingQueue(size_t maxSize,
+            size_t ringSize = 0, size_t initSize = 0) :
+            _maxSize(maxSize),
+            _ringSize(ringSize == 0 ? maxSize : ringSize),
+            _segmentSize(std::min((size_t)SegmentSize, _ringSize)),
+            _initSize(initSize == 0 ? _ringSize : initSize),
+            _uid(nextUid()),
+            _rings(nullptr),
+            _buffer(),
+            _length(0),
+            _countAppended(0),
+            _highWater(0)
+        {
+            Registry_t& registry = getRegistry();
+            std::lock_guard<std::mutex> lock(registry.mutex);
+            registry.uids.insert(_uid);
+        }
+
+        /**
+         * Free all registered rings
+         */
+        ~LockFreeRingQueue()
+        {
+            //Exiting writer threads no
+            //longer release their rings
+            {
+                Registry_t& registry = getRegistry();
+                std::lock_guard<std::mutex> lock(registry.mutex);
+                registry.uids.erase(_uid);
+            }
+            Ring_t* ring = _rings.load();
+            while (ring != nullptr) {
+                Ring_t* next = ring->next;
+                delete ring;
+                ring = next;
+            }
+        }
+
+        /**
+         * Drain all writer rings into the reading
+         * buffer (up to its maximum size, remaining
+         * values are drained at next swap) and
+         * grow the rings if needed.
+         * Never wait for the writers.
+         */
+        void swapBufferFromReader()
+        {
+            _length = 0;
+            Ring_t* ring = _rings.load();
+            while (ring != nullptr) {
+                size_t tail = ring->tail.load(std::memory_order_relaxed);
+                size_t head = ring->head.load(std::memory_order_acquire);
+                size_t count = 0;
+                while (tail != head && _length < _maxSize) {
+                    //Go to the next segment (always written
+                    //before the head) and recycle the read one
+                    if (ring->readIndex == _segmentSize) {
+                        Segment_t* segment = ring->readSegment;
+                        ring->readSegment = segment->next;
+                        ring->readIndex = 0;
+                        recycleSegment(ring, segment);
+                    }
+                    //Grow the reader buffer by segment
+                    if (_length == _buffer.size()) {
+                        _buffer.resize(std::min(
+                            _maxSize, _length + _segmentSize));
+                    }
+                    //Swap instead of copy so that cells
+                    //allocated storage is reused
+                    std::swap(_buffer[_length],
+                        ring->readSegment->cells[ring->readIndex]);
+                    ring->readIndex++;
+                    _length++;
+                    tail++;
+                    count++;
+                }
+                ring->tail.store(tail, std::memory_order_release);
+                growRing(ring, count);
+                ring = ring->next;
+            }
+            _countAppended.fetch_add(_length, std::memory_order_relaxed);
+            if (_length > _highWater.load(std::memory_order_relaxed)) {
+                _highWater.store(_length, std::memory_order_relaxed);
+            }
+        }
+
+        /**
+         * Direct access to reading (privately own) buffer
+         */
+        const std::vector<T>& getBufferFromReader() const
+        {
+            return _buffer;
+        }
+
+        /**
+         * Return the size of currently own by reader buffer
+         */
+        size_t getSizeFromReader() const
+        {
+            return _length;
+        }
+
+        /**
+         * Append to the calling thread ring the given value.
+         * RT, thread safe, no dynamic allocation
+         * (except the ring first registration).
+         * If the ring is full, given data is dropped.
+         * Return false if the value has to be dropped.
+         */
+        bool appendFromWriter(const T& val)
+        {
+            return appendBlockFromWriter(1,
+                [&val](size_t i, T& cell) {
+                    (void)i;
+                    cell = val;
+                });
+        }
+
+        /**
+         * Append to the calling thread ring a contiguous
+         * block of given count values. The given function
+         * func(i, cell) is called to write the i-th value
+         * of the block into its reserved ring cell.
+         * RT, thread safe, no dynamic allocation
+         * (except the ring first registration).
+         * The block is either fully appended or fully
+         * dropped if the ring is full or has not yet
+         * been grown enough by the reader.
+         * Return false if the block has been dropped.
+         */
+        template <typename Func>
+        bool appendBlockFromWriter(size_t count, Func func)
+        {
+            if (count == 0) {
+                return true;
+            }
+            Ring_t* ring = writerRing();
+            size_t head = ring->head.load(std::memory_order_relaxed);
+            size_t tail = ring->tail.load(std::memory_order_acquire);
+            //Check ring size and the number of
+            //free segments needed by the block
+            size_t needed = (ring->writeIndex + count - 1)/_segmentSize;
+            size_t poolTail = ring->poolTail.load(std::memory_order_relaxed);
+            size_t poolHead = ring->poolHead.load(std::memory_order_acquire);
+            if (
+                head - tail + count > _ringSize ||
+                poolHead - poolTail < needed
+            ) {
+                ring->dropped.fetch_add(count, std::memory_order_relaxed);
+                return false;
+            }
+            for (size_t i=0;i<count;i++) {
+                //Link a free segment
+                if (ring->writeIndex == _segmentSize) {
+                    Segment_t* segment =
+                        ring->pool[poolTail % ring->countSegmentsMax];
+                    poolTail++;
+                    segment->next = nullptr;
+                    ring->writeSegment->next = segment;
+                    ring->writeSegment = segment;
+                    ring->writeIndex = 0;
+                }
+                func(i, ring->writeSegment->cells[ring->writeIndex]);
+                ring->writeIndex++;
+            }
+            ring->poolTail.store(poolTail, std::memory_order_release);
+            //Publish the whole block to the reader
+            ring->head.store(head + count, std::memory_order_release);
+
+            return true;
+        }
+
+        /**
+         * Return the reader buffer capacity
+         */
+        size_t getCapacity() const
+        {
+            return _maxSize;
+        }
+
+        /**
+         * Return the total number of values drained
+         * by the reader, dropped (ring full) and the
+         * maximum reader buffer length reached.
+         * Thread safe.
+         */
+        uint64_t getCountAppended() const
+        {
+            return _countAppended.load(std::memory_order_relaxed);
+        }
+        uint64_t getCountDropped() const
+        {
+            uint64_t count = 0;
+            Ring_t* ring = _rings.load();
+            while (ring != nullptr) {
+                count += ring->dropped.load(std::memory_order_relaxed);
+                ring = ring->next;
+            }
+            return count;
+        }
+        size_t getHighWater() const
+        {
+            return _highWater.load(std::memory_order_relaxed);
+        }
+
+        /**
+         * Return the number of registered writer
+         * rings (used or released by exited threads)
+         */
+        size_t getCountRings() const
+        {
+            size_t count = 0;
+            Ring_t* ring = _rings.load();
+            while (ring != nullptr) {
+                count++;
+                ring = ring->next;
+            }
+            return count;
+        }
+
+        /**
+         * Return the number of values allocated
+         * by all rings. Not thread safe with
+         * the reader.
+         */
+        size_t getCountAllocated() const
+        {
+            size_t count = 0;
+            Ring_t* ring = _rings.load();
+            while (ring != nullptr) {
+                count += ring->segments.size()*_segmentSize;
+                ring = ring->next;
+            }
+            return count;
+        }
+
+    private:
+
+        /**
+         * Cache line size in bytes
+         */
+        static const size_t CacheLine = 64;
+
+        /**
+         * Number of entries of the per thread
+         * cache of rings of recently used queues
+         */
+        static const size_t CacheSize = 16;
+
+        /**
+         * Ring segment of pre-allocated cells
+         */
+        struct Segment_t {
+            /**
+             * Pre-allocated cells
+             */
+            std::unique_ptr<T[]> cells;
+            /**
+             * Next segment in the ring (written by
+             * the writer before publishing the values)
+             */
+            Segment_t* next;
+
+            /**
+             * Initialization
+             */
+            Segment_t(size_t size) :
+                cells(new T[size]),
+                next(nullptr)
+            {
+            }
+        };
+
+        /**
+         * Single producer single consumer ring
+         * of one writer thread. Writer and reader
+         * state are padded on separate cache lines.
+         */
+        struct Ring_t {
+            /**
+             * False if the ring has been released
+             * by its exited writer thread
+             */
+            std::atomic<bool> isUsed;
+            /**
+             * Next registered ring
+             */
+            Ring_t* next;
+            /**
+             * All allocated segments (reader owned)
+             * and free segments pool written by the
+             * reader and taken by the writer
+             */
+            std::vector<std::unique_ptr<Segment_t>> segments;
+            const size_t countSegmentsMax;
+            std::unique_ptr<Segment_t*[]> pool;
+            /**
+             * Number of values written (writer
+             * owned) and dropped because
+             * the ring was full, writing segment
+             * and index and number of free segments
+             * taken from the pool
+             */
+            char padHead[CacheLine];
+            std::atomic<size_t> head;
+            std::atomic<uint64_t> dropped;
+            Segment_t* writeSegment;
+            size_t writeIndex;
+            std::atomic<size_t> poolTail;
+            /**
+             * Number of values read (reader owned),
+             * reading segment and index, number of free
+             * segments put into the pool, last seen
+             * dropped count and maximum number of
+             * values drained by one swap
+             */
+            char padTail[CacheLine];
+            std::atomic<size_t> tail;
+            Segment_t* readSegment;
+            size_t readIndex;
+            std::atomic<size_t> poolHead;
+            uint64_t droppedSeen;
+            size_t drainedMax;
+            char padEnd[CacheLine];
+
+            /**
+             * Initialization with segment size, maximum
+             * number of segments and the number of
+             * initially allocated segments
+             */
+            Ring_t(size_t segmentSize,
+                size_t countMax, size_t countInit) :
+                isUsed(true),
+                next(nullptr),
+                segments(),
+                countSegmentsMax(countMax),
+                pool(new Segment_t*[countMax]),
+                head(0),
+                dropped(0),
+                writeSegment(nullptr),
+                writeIndex(0),
+                poolTail(0),
+                tail(0),
+                readSegment(nullptr),
+                readIndex(0),
+                poolHead(0),
+                droppedSeen(0),
+                drainedMax(0)
+            {
+                //The first segment is used by both
+                //writer and reader, others are free
+                segments.reserve(countMax);
+                for (size_t i=0;i<countInit;i++) {
+                    segments.emplace_back(new Segment_t(segmentSize));
+                    if (i > 0) {
+                        pool[poolHead.load()] = segments.back().get();
+                        poolHead++;
+                    }
+                }
+                writeSegment = segments.front().get();
+                readSegment = segments.front().get();
+            }
+        };
+
+        /**
+         * Per thread cache entry
+         * of queue unique id and ring
+         */
+        struct CacheEntry_t {
+            uint64_t uid;
+            Ring_t* ring;
+        };
+
+        /**
+         * Rings registered by the calling thread
+         * (for all queues). Released at thread
+         * exit if their queue is still alive.
+         */
+        struct ThreadRings_t {
+            std::vector<CacheEntry_t> rings;
+
+            ~ThreadRings_t()
+            {
+                Registry_t& registry = getRegistry();
+                std::lock_guard<std::mutex> lock(registry.mutex);
+                for (const CacheEntry_t& entry : rings) {
+                    if (registry.uids.count(entry.uid) > 0) {
+                        entry.ring->isUsed.store(
+                            false, std::memory_order_release);
+                    }
+                }
+            }
+        };
+
+        /**
+         * Unique ids of alive queues
+         * and its protecting mutex
+         */
+        struct Registry_t {
+            std::mutex mutex;
+            std::set<uint64_t> uids;
+        };
+
+        /**
+         * Maximum data contained by the reader
+         * buffer and by each writer ring, number
+         * of values per segment and pre-allocated
+         * per ring
+         */
+        const size_t _maxSize;
+        const size_t _ringSize;
+        const size_t _segmentSize;
+        const size_t _initSize;
+
+        /**
+         * Queue unique id (never reused
+         * unlike the queue address)
+         */
+        const uint64_t _uid;
+
+        /**
+         * Lock free list of registered rings
+         */
+        std::atomic<Ring_t*> _rings;
+
+        /**
+         * Reader owned buffer (grown by
+         * segment) and its used length
+         */
+        std::vector<T> _buffer;
+        size_t _length;
+
+        /**
+         * Total drained values and reader
+         * buffer length high water mark
+         */
+        std::atomic<uint64_t> _countAppended;
+        std::atomic<size_t> _highWater;
+
+        /**
+         * Return a new queue unique id
+         */
+        static uint64_t nextUid()
+        {
+            static std::atomic<uint64_t> uid(0);
+            return ++uid;
+        }
+
+        /**
+         * Return the alive queues registry.
+         * Never destroyed since queues and writer
+         * threads can outlive static destruction.
+         */
+        static Registry_t& getRegistry()
+        {
+            static Registry_t* registry = new Registry_t();
+            return *registry;
+        }
+
+        /**
+         * Return the number of segments
+         * holding given number of values
+         */
+        size_t countSegments(size_t size) const
+        {
+            return (size + _segmentSize - 1)/_segmentSize;
+        }
+
+        /**
+         * Put back given read segment
+         * into given ring free pool
+         */
+        void recycleSegment(Ring_t* ring, Segment_t* segment)
+        {
+            size_t poolHead = ring->poolHead.load(std::memory_order_relaxed);
+            ring->pool[poolHead % ring->countSegmentsMax] = segment;
+            ring->poolHead.store(poolHead + 1, std::memory_order_release);
+        }
+
+        /**
+         * Allocate free segments into given ring ahead
+         * of demand: the free segments can always hold
+         * twice the maximum number of values drained by
+         * one swap (rate and jitter headroom). The ring
+         * size is doubled if values have been dropped
+         * since last swap.
+         */
+        void growRing(Ring_t* ring, size_t drained)
+        {
+            size_t countFree =
+                ring->poolHead.load(std::memory_order_relaxed) -
+                ring->poolTail.load(std::memory_order_acquire);
+            ring->drainedMax = std::max(ring->drainedMax, drained);
+            size_t target = countSegments(2*ring->drainedMax) + 1;
+            uint64_t dropped = ring->dropped.load(std::memory_order_relaxed);
+            if (dropped != ring->droppedSeen) {
+                ring->droppedSeen = dropped;
+                target = std::max(target, ring->segments.size());
+            }
+            while (
+                countFree < target &&
+                ring->segments.size() < ring->countSegmentsMax
+            ) {
+                ring->segments.emplace_back(new Segment_t(_segmentSize));
+                recycleSegment(ring, ring->segments.back().get());
+                countFree++;
+            }
+        }
+
+        /**
+         * Return a ring for the calling thread,
+         * reusing a released one if any
+         */
+        Ring_t* registerRing()
+        {
+            //Reuse a ring released by an exited thread.
+            //Its values not yet drained are kept.
+            Ring_t* ring = _rings.load();
+            while (ring != nullptr) {
+                bool isUsed = false;
+                if (ring->isUsed.compare_exchange_strong(
+                    isUsed, true, std::memory_order_acquire)
+                ) {
+                    return ring;
+                }
+                ring = ring->next;
+            }
+            //New ring registration with its head and
+            //one free segment. One more segment than the
+            //ring size is needed since the reading and
+            //writing segments can be partially used.
+            size_t countMax = countSegments(_ringSize) + 1;
+            ring = new Ring_t(_segmentSize, countMax,
+                std::min(countMax, countSegments(_initSize) + 1));
+            ring->next = _rings.load();
+            while (!_rings.compare_exchange_weak(ring->next, ring)) {
+            }
+
+            return ring;
+        }
+
+        /**
+         * Return the calling thread ring,
+         * registering it on first use
+         */
+        Ring_t* writerRing()
+        {
+            //Recently used queues lookup
+            thread_local CacheEntry_t cache[CacheSize] = {};
+            thread_local size_t cacheNext = 0;
+            for (size_t i=0;i<CacheSize;i++) {
+                if (cache[i].uid == _uid) {
+                    return cache[i].ring;
+                }
+            }
+            //Calling thread rings lookup
+            thread_local ThreadRings_t threadRings;
+            Ring_t* ring = nullptr;
+            for (const CacheEntry_t& entry : threadRings.rings) {
+                if (entry.uid == _uid) {
+                    ring = entry.ring;
+                    break;
+                }
+            }
+            if (ring == nullptr) {
+                ring = registerRing();
+                threadRings.rings.push_back({_uid, ring});
+            }
+            cache[cacheNext].uid = _uid;
+            cache[cacheNext].ring = ring;
+            cacheNext = (cacheNext + 1) % CacheSize;
+
+            return ring;
+        }
+};
+
+}
+
+#endif
+
@@ -0,0 +1,157 @@
+#ifndef RHIO_LOCKFREESTR_HPP
+#define RHIO_LOCKFREESTR_HPP
+
+#include <string>
+#include <atomic>
+#include <cstdint>
+#include <ostream>
+
+namespace RhIO {
+
+/**
+ * LockFreeStr
+ *
+ * RCU style string holder. The string is stored
+ * in an immutable buffer replaced through an
+ * atomic pointer swap so that readers and writers
+ * never lock. Buffers are taken from a small
+ * per string pool of pre-allocated strings. 
+ * Replaced buffers are retired and only reused 
+ * by later writers once no reader can still
+ * access them (epoch based reclamation).
+ * Writers thus never free memory and do not
+ * allocate once the pooled strings have grown
+ * to the written length.
+ * Writers never lock but are NOT wait free:
+ * writing a string longer than the pooled buffer
+ * capacity (initially Capacity) allocates, and if
+ * all MaxBuffers buffers are still held by readers
+ * (more concurrent readers than pooled buffers, or
+ * more than 256 reader threads) the writer yields
+ * until a reader exits.
+ */
+class LockFreeStr
+{
+    public:
+
+        /**
+         * Number of initially allocated and
+         * maximum number of pooled buffers, and 
+         * initially reserved buffer length
+         */
+        static const size_t InitBuffers = 3;
+        static const size_t MaxBuffers = 16;
+        static const size_t Capacity = 64;
+
+        /**
+         * Initialization with empty
+         * or given string
+         */
+        LockFreeStr();
+        LockFreeStr(const std::string& str);
+
+        /**
+         * Copy constructor and assignment
+         * (deep copy of the current string)
+         */
+        LockFreeStr(const LockFreeStr& str);
+        LockFreeStr& operator=(const LockFreeStr& str);
+
+        /**
+         * Free all pooled buffers.
+         * No concurrent access is assumed.
+         */
+        ~LockFreeStr();
+
+        /**
+         * Replace the string (see store())
+         */
+        LockFreeStr& operator=(const std::string& str);
+
+        /**
+         * Return a copy of the current string.
+         * The non allocating version assigns given
+         * string (no allocation once its capacity
+         * has grown to the string length).
+         * Lock free and thread safe.
+         */
+        std::string load() const;
+        void load(std::string& str) const;
+        operator std::string() const;
+
+        /**
+         * Atomically replace the current string.
+         * Never locks, the old buffer is retired
+         * and never freed by this call.
+         * No allocation unless the pooled buffers have
+         * to grow to given string length or all pooled 
+         * buffers are still being read.
+         * Not wait free: if all MaxBuffers pooled buffers
+         * are still being read, the caller yields until
+         * a reader exits (see class comment).
+         */
+        void store(const std::string& str);
+
+    private:
+
+        /**
+         * Pooled string buffer with its
+         * pool index and retirement epoch
+         */
+        struct Buffer_t {
+            std::string str;
+            size_t index;
+            std::atomic<uint64_t> epoch;
+        };
+
+        /**
+         * Atomic pointer to the
+         * current immutable buffer
+         */
+        std::atomic<Buffer_t*> _ptr;
+
+        /**
+         * Pooled buffers (lazily allocated)
+         * and bit masks of free and retired ones
+         */
+        std::atomic<Buffer_t*> _buffers[MaxBuffers];
+        std::atomic<uint32_t> _free;
+        std::atomic<uint32_t> _retired;
+
+        /**
+         * Allocate the initial buffers
+         * with given current string
+         */
+        void init(const std::string& str);
+
+        /**
+         * Return a free buffer taken from 
+         * the pool (reusing retired buffers
+         * or growing the pool if needed).
+         * Yield while all MaxBuffers buffers
+         * are still being read.
+         */
+        Buffer_t* takeBuffer();
+
+        /**
+         * Move the retired buffers no longer
+         * accessible by any reader to the free
+         * ones. Return false if none.
+         */
+        bool reclaim();
+};
+
+/**
+ * Comparison and stream operators
+ * with standard strings
+ */
+bool operator==(const LockFreeStr& str1, const std::string& str2);
+bool operator==(const std::string& str1, const LockFreeStr& str2);
+bool operator!=(const LockFreeStr& str1, const std::string& str2);
+bool operator!=(const std::string& str1, const LockFreeStr& str2);
+std::ostream& operator<<(std::ostream& os, const LockFreeStr& str);
+
+}
+
+#endif
+
@@ -32,12 +32,28 @@ typedef LogValue<bool> LogValBool;
 typedef LogValue<int64_t> LogValInt;
 typedef LogValue<double> LogValFloat;
 typedef LogValue<std::string> LogValStr;
+typedef LogValue<std::vector<double>> LogValFloatArray;
 
 /**
  * Write in custom binary format the mapping
  * from values name to values id and all
  * values containers into output stream.
+ * FloatArray mapping and values are appended
+ * after all other types so that files are still
+ * readable by older readers (FloatArray ignored).
  */
+void RhIOWriteBinaryLog(
+    std::ostream& os, 
+    const std::map<std::string, size_t>& mappingBool,
+    const std::map<std::string, size_t>& mappingInt,
+    const std::map<std::string, size_t>& mappingFloat,
+    const std::map<std::string, size_t>& mappingStr,
+    const std::map<std::string, size_t>& mappingFloatArray,
+    const std::deque<LogValBool>& valuesBool,
+    const std::deque<LogValInt>& valuesInt,
+    const std::deque<LogValFloat>& valuesFloat,
+    const std::deque<LogValStr>& valuesStr,
+    const std::deque<LogValFloatArray>& valuesFloatArray);
 void RhIOWriteBinaryLog(
     std::ostream& os, 
     const std::map<std::string, size_t>& mappingBool,
@@ -57,7 +73,21 @@ void RhIOWriteBinaryLog(
  * False is returned if the stream is empty and 
  * if no data has been loaded. 
  * Else, return True if the loaded data are valid.
+ * Files written without FloatArray section
+ * are loaded with empty FloatArray containers.
  */
+bool RhIOReadBinaryLog(
+    std::ifstream& is,
+    std::map<std::string, size_t>& mappingBool,
+    std::map<std::string, size_t>& mappingInt,
+    std::map<std::string, size_t>& mappingFloat,
+    std::map<std::string, size_t>& mappingStr,
+    std::map<std::string, size_t>& mappingFloatArray,
+    std::vector<LogValBool>& valuesBool,
+    std::vector<LogValInt>& valuesInt,
+    std::vector<LogValFloat>& valuesFloat,
+    std::vector<LogValStr>& valuesStr,
+    std::vector<LogValFloatArray>& valuesFloatArray);
 bool RhIOReadBinaryLog(
     std::ifstream& is,
     std::map<std::string, size_t>& mappingBool,
@@ -74,6 +104,13 @@ bool RhIOReadBinaryLog(
     std::map<std::string, std::vector<LogValInt>>& containerInt,
     std::map<std::string, std::vector<LogValFloat>>& containerFloat,
     std::map<std::string, std::vector<LogValStr>>& containerStr);
+bool RhIOReadBinaryLog(
+    std::ifstream& is,
+    std::map<std::string, std::vector<LogValBool>>& containerBool,
+    std::map<std::string, std::vector<LogValInt>>& containerInt,
+    std::map<std::string, std::vector<LogValFloat>>& containerFloat,
+    std::map<std::string, std::vector<LogValStr>>& containerStr,
+    std::map<std::string, std::vector<LogValFloatArray>>& containerFloatArray);
 
 }
 
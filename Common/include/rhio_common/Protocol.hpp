@@ -17,6 +17,13 @@ extern const unsigned int PortServerPub;
  */
 extern const std::string AddressMulticast;
 
+/**
+ * Maximum payload size in bytes of streaming
+ * datagrams packing several samples
+ * (fit in a typical Ethernet MTU)
+ */
+extern const size_t StreamPacketSize;
+
 /**
  * Protocol message type
  */
@@ -335,6 +342,191 @@ enum MsgType : uint8_t {
      * config update
      */
     MsgStreamingOK,
+    /**
+     * Client.
+     * Ask a consistent snapshot of all
+     * values under given absolute node name
+     * Args:
+     * String: absolute node name
+     */
+    MsgAskSnapshot,
+    /**
+     * Server.
+     * Return a snapshot of all values 
+     * of asked subtree
+     * Args:
+     * Bool: true if the capture is consistent
+     * For Bool, Int, Float, Str and FloatArray types:
+     * Int: number of values
+     * String: absolute value name
+     * Int: value timestamp
+     * Bool, Int, Float, Str or FloatArray: value
+     * ...
+     */
+    MsgSnapshot,
+    /**
+     * Client
+     * Set the streaming filter policy
+     * of given absolute value name
+     * Args:
+     * String: absolute value name
+     * Bool: only publish value changes
+     * Float: absolute deadband
+     * Float: relative deadband
+     * Int: minimum publish period in microseconds
+     * Bool: only publish latest sample per period
+     */
+    MsgSetStreamFilter,
+    /**
+     * Client.
+     * Ask for listing values of type 
+     * FloatArray at given Node name.
+     * Args:
+     * String: absolute node name
+     */
+    MsgAskValuesFloatArray,
+    /**
+     * Client.
+     * Ask for values of type FloatArray
+     * Args:
+     * String: absolute value name
+     */
+    MsgGetFloatArray,
+    /**
+     * Client.
+     * Ask for values update for type FloatArray
+     * Args:
+     * String: absolute value name to update
+     * FloatArray : new value (same length)
+     */
+    MsgSetFloatArray,
+    /**
+     * Client.
+     * Ask for value meta data for type FloatArray
+     * Args:
+     * String: absolute value name to update
+     */
+    MsgAskMetaFloatArray,
+    /**
+     * Server.
+     * Return the value of asked value
+     * for type FloatArray
+     * Args:
+     * FloatArray: value
+     */
+    MsgValFloatArray,
+    /**
+     * Server.
+     * Return all asked value meta information
+     * for type FloatArray
+     * Args:
+     * String: value comment
+     * Bool: has minimum
+     * Bool: has maximum
+     * Bool: is persisted
+     * Int: number of watcher for streaming
+     * FloatArray: minimum value (empty if none)
+     * FloatArray: maximum value (empty if none)
+     * FloatArray: persisted value
+     */
+    MsgValMetaFloatArray,
+    /**
+     * Server.
+     * Return streamed values for type FloatArray
+     * Args:
+     * String: value absolute name
+     * Int: timestamp (in microseconds)
+     * FloatArray: value (one contiguous record)
+     */
+    MsgStreamFloatArray,
+    /**
+     * Client.
+     * Call the given absolute name command
+     * binary signature with given encoded 
+     * typed arguments (see CommandArgs)
+     * Args:
+     * String: absolute command name
+     * Data: encoded arguments
+     */
+    MsgAskCallBinary,
+    /**
+     * Server.
+     * Return binary call result of asked
+     * command binary call
+     * Args:
+     * Data: encoded result
+     */
+    MsgCallResultBinary,
+    /**
+     * Server.
+     * Several streaming samples packed
+     * into one datagram
+     * Args:
+     * For each sample until the end:
+     * Type: MsgStreamBool, MsgStreamInt,
+     * MsgStreamFloat, MsgStreamStr, 
+     * MsgStreamFloatArray or MsgStreamStream
+     * The sample arguments (see above)
+     */
+    MsgStreamBatch,
+    /**
+     * Server.
+     * Announce the value id dictionary used
+     * by compact streaming samples. Sent before
+     * the first sample of each value and 
+     * periodically repeated.
+     * Args:
+     * VarInt: server session id (random, changed
+     * on server restart, see MsgStreamCompact)
+     * For each entry until the end:
+     * VarInt: value id
+     * Type: MsgStreamBool, MsgStreamInt, 
+     * MsgStreamFloat, MsgStreamStr 
+     * or MsgStreamFloatArray
+     * VarInt: absolute value name length
+     * Raw: absolute value name
+     */
+    MsgStreamDictionary,
+    /**
+     * Server.
+     * Several values samples with
+     * compact encoding
+     * Args:
+     * VarInt: server session id. Samples are only
+     * decoded with the dictionary of the same session.
+     * For each sample until the end:
+     * VarInt: value id (see MsgStreamDictionary)
+     * SignedVarInt: timestamp delta from the previous
+     * sample of the datagram (from zero for the first one)
+     * Bool: value
+     * or
+     * SignedVarInt: value
+     * or
+     * Float: value
+     * or
+     * VarInt: length, Raw: string value
+     * or
+     * VarInt: size, Raw: array doubles
+     */
+    MsgStreamCompact,
+    /**
+     * Server.
+     * One chunk of a streamed frame.
+     * Frames are split into chunks 
+     * fitting in datagrams.
+     * Args:
+     * VarInt: absolute frame name length
+     * Raw: absolute frame name
+     * VarInt: frame sequence number
+     * SignedVarInt: frame timestamp
+     * VarInt: image width
+     * VarInt: image height
+     * VarInt: frame data size
+     * VarInt: chunk index
+     * VarInt: number of chunks
+     * Raw: chunk data until the end
+     */
+    MsgStreamFrameChunk,
 };
 
 }
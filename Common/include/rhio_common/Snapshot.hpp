@@ -0,0 +1,62 @@
+#ifndef RHIO_SNAPSHOT_HPP
+#define RHIO_SNAPSHOT_HPP
+
+#include <string>
+#include <vector>
+#include <cstdint>
+
+namespace RhIO {
+
+/**
+ * Typed value captured in a snapshot
+ */
+template <typename T>
+struct SnapshotValue {
+    //Full absolute name
+    std::string name;
+    //Timestamp in microseconds
+    int64_t timestamp;
+    //Typed value
+    T value;
+};
+
+/**
+ * Typedef for captured value types
+ */
+typedef SnapshotValue<bool> SnapshotBool;
+typedef SnapshotValue<int64_t> SnapshotInt;
+typedef SnapshotValue<double> SnapshotFloat;
+typedef SnapshotValue<std::string> SnapshotStr;
+typedef SnapshotValue<std::vector<double>> SnapshotFloatArray;
+
+/**
+ * Snapshot
+ *
+ * Copy of all values of a subtree
+ * captured at the same instant
+ * (no value write interleaved).
+ * Values of each type are stored
+ * contiguously sorted by node.
+ */
+struct Snapshot {
+    /**
+     * False if concurrent writes prevented
+     * a consistent capture and the values
+     * were only copied on best effort
+     */
+    bool isConsistent;
+
+    /**
+     * Captured values for each type
+     */
+    std::vector<SnapshotBool> valuesBool;
+    std::vector<SnapshotInt> valuesInt;
+    std::vector<SnapshotFloat> valuesFloat;
+    std::vector<SnapshotStr> valuesStr;
+    std::vector<SnapshotFloatArray> valuesFloatArray;
+};
+
+}
+
+#endif
+
@@ -2,22 +2,143 @@
 #define RHIO_TIME_HPP
 
 #include <functional>
+#include <cstdint>
+#include <time.h>
+#if defined(__x86_64__) || defined(__i386__)
+#include <x86intrin.h>
+#endif
 
 namespace RhIO {
 
 /**
- * Function pointer to the time getter 
+ * Available clock sources
+ * for default value timestamp.
+ * TimeSteady: CLOCK_MONOTONIC
+ * (same as std::chrono::steady_clock, default).
+ * TimeCoarse: CLOCK_MONOTONIC_COARSE,
+ * cheaper but only updated every kernel tick.
+ * TimeTSC: raw CPU time stamp counter calibrated
+ * against TimeSteady (requires an invariant TSC,
+ * fallback to TimeSteady on other architectures).
+ * TimeFunc: user defined function
+ * (see setRhIOTimeFunc(), for simulation time).
+ */
+enum TimeSource {
+    TimeSteady,
+    TimeCoarse,
+    TimeTSC,
+    TimeFunc,
+};
+
+/**
+ * Function pointer to the time getter
  * function used for default value timestamp
+ * when TimeFunc source is selected
  */
 extern std::function<int64_t()> FuncGetTime;
 
+/**
+ * Current selected clock source
+ */
+extern TimeSource SourceGetTime;
+
+/**
+ * Time stamp counter calibration
+ * (ticks and time origin and
+ * microseconds per tick ratio)
+ */
+struct TimeCalibrationTSC {
+    uint64_t originTicks;
+    int64_t originTime;
+    double microsPerTick;
+};
+extern TimeCalibrationTSC CalibrationTSC;
+
+/**
+ * Per thread cycle time in microseconds
+ * used as default value timestamp if
+ * not negative (see setRhIOCycleTime())
+ */
+extern thread_local int64_t CycleTime;
+
+/**
+ * Return the given POSIX clock time
+ * expressed in microseconds
+ */
+inline int64_t getRhIOClockPosix(clockid_t clock)
+{
+    struct timespec ts;
+    clock_gettime(clock, &ts);
+    return (int64_t)ts.tv_sec*1000000 + (int64_t)ts.tv_nsec/1000;
+}
+
+/**
+ * Return the current time from the selected
+ * clock source expressed in microseconds
+ * ticks ignoring the thread cycle time
+ * (Thread safe)
+ */
+inline int64_t getRhIOClockTime()
+{
+    switch (SourceGetTime) {
+        case TimeCoarse:
+            return getRhIOClockPosix(CLOCK_MONOTONIC_COARSE);
+#if defined(__x86_64__) || defined(__i386__)
+        case TimeTSC:
+            return CalibrationTSC.originTime + (int64_t)(
+                (double)(__rdtsc() - CalibrationTSC.originTicks)
+                *CalibrationTSC.microsPerTick);
+#endif
+        case TimeFunc:
+            return FuncGetTime();
+        default:
+            return getRhIOClockPosix(CLOCK_MONOTONIC);
+    }
+}
+
 /**
  * Return the current time expressed
- * in microseconds ticks (Thread safe)
+ * in microseconds ticks (Thread safe).
+ * The calling thread cycle time is
+ * returned if it has been set.
  */
 inline int64_t getRhIOTime()
 {
-    return FuncGetTime();
+    if (CycleTime >= 0) {
+        return CycleTime;
+    }
+    return getRhIOClockTime();
+}
+
+/**
+ * Set the calling thread cycle time returned
+ * by getRhIOTime() in place of the clock
+ * until cleared. Typically set once per
+ * control loop iteration so that all
+ * setters reuse the same timestamp.
+ */
+inline void setRhIOCycleTime(int64_t timestamp)
+{
+    CycleTime = timestamp;
+}
+
+/**
+ * Set the calling thread cycle time to the
+ * current clock time and return it
+ */
+inline int64_t beginRhIOCycle()
+{
+    CycleTime = getRhIOClockTime();
+    return CycleTime;
+}
+
+/**
+ * Go back to reading the clock source
+ * for the calling thread
+ */
+inline void clearRhIOCycleTime()
+{
+    CycleTime = -1;
 }
 
 }
@@ -4,45 +4,229 @@
 #include <string>
 #include <functional>
 #include <atomic>
+#include <vector>
+#include <stdexcept>
+#include "rhio_common/LockFreeStr.hpp"
+#include "rhio_common/LockFreeFloatArray.hpp"
 
 namespace RhIO {
 
 /**
- * ValueBase
+ * StreamFilter
  *
- * Factorize non type specific 
- * field of Value
+ * Per value streaming policy.
+ * Updates rejected by the filter are not
+ * published to the streaming server
+ * (they are still logged).
  */
-struct ValueBase
+struct StreamFilter
 {
-    virtual ~ValueBase() {};
+    /**
+     * If true, only publish
+     * value changes
+     */
+    bool onChange;
 
     /**
-     * Value name
+     * Only publish values differing from the last
+     * published one by more than given absolute
+     * or relative (to the last published value) 
+     * threshold (disabled if zero)
      */
-    std::string name;
+    double deadbandAbs;
+    double deadbandRel;
 
     /**
-     * Cached full absolute path
+     * Minimum period between two published
+     * values in microseconds (max rate
+     * decimation, disabled if zero)
      */
-    std::string path;
+    int64_t periodMin;
 
     /**
-     * A friendly and helpful comment message
+     * If true, only the latest sample of the
+     * value is sent at each publisher period
+     * (coalescing). Else every sample is sent.
+     * Only for Bool, Int and Float values.
      */
-    std::string comment;
+    bool latestOnly;
 
     /**
-     * Flags indicating min & max presence
+     * Default constructor
+     * (no filtering)
      */
-    bool hasMin;
-    bool hasMax;
+    StreamFilter() :
+        onChange(false),
+        deadbandAbs(0.0),
+        deadbandRel(0.0),
+        periodMin(0),
+        latestOnly(false)
+    {
+    }
 
     /**
-     * Last updated value timestamp
-     * expressed in microseconds
+     * Return true if
+     * any filtering is enabled
+     */
+    bool isEnabled() const
+    {
+        return 
+            onChange || 
+            deadbandAbs > 0.0 || 
+            deadbandRel > 0.0 || 
+            periodMin > 0;
+    }
+};
+
+/**
+ * StreamFilterAtomic
+ *
+ * StreamFilter stored in a value and read 
+ * lock free by real time setters while it 
+ * may be concurrently replaced.
+ * Each field is atomic (a concurrent read may
+ * see a mix of the old and new filter fields).
+ */
+struct StreamFilterAtomic
+{
+    /**
+     * Filter fields (see StreamFilter)
+     */
+    std::atomic<double> deadbandAbs;
+    std::atomic<double> deadbandRel;
+    std::atomic<int64_t> periodMin;
+    std::atomic<bool> onChange;
+    std::atomic<bool> latestOnly;
+
+    /**
+     * Default constructor
+     * (no filtering)
+     */
+    StreamFilterAtomic() :
+        deadbandAbs(0.0),
+        deadbandRel(0.0),
+        periodMin(0),
+        onChange(false),
+        latestOnly(false)
+    {
+    }
+
+    /**
+     * Copy constructor
+     */
+    StreamFilterAtomic(const StreamFilterAtomic& f) :
+        StreamFilterAtomic()
+    {
+        store(f.load());
+    }
+
+    /**
+     * Assignment operators
+     */
+    StreamFilterAtomic& operator=(const StreamFilterAtomic& f)
+    {
+        if (this != &f) {
+            store(f.load());
+        }
+        return *this;
+    }
+    StreamFilterAtomic& operator=(const StreamFilter& f)
+    {
+        store(f);
+        return *this;
+    }
+
+    /**
+     * Return a copy of the filter
+     */
+    StreamFilter load() const
+    {
+        StreamFilter f;
+        f.onChange = onChange.load(std::memory_order_relaxed);
+        f.deadbandAbs = deadbandAbs.load(std::memory_order_relaxed);
+        f.deadbandRel = deadbandRel.load(std::memory_order_relaxed);
+        f.periodMin = periodMin.load(std::memory_order_relaxed);
+        f.latestOnly = latestOnly.load(std::memory_order_relaxed);
+        return f;
+    }
+
+    /**
+     * Replace the filter
+     */
+    void store(const StreamFilter& f)
+    {
+        onChange.store(f.onChange, std::memory_order_relaxed);
+        deadbandAbs.store(f.deadbandAbs, std::memory_order_relaxed);
+        deadbandRel.store(f.deadbandRel, std::memory_order_relaxed);
+        periodMin.store(f.periodMin, std::memory_order_relaxed);
+        latestOnly.store(f.latestOnly, std::memory_order_relaxed);
+    }
+};
+
+/**
+ * Enum for used value type
+ */
+enum ValueType {
+    NoValue = 0,
+    TypeBool = 1,
+    TypeInt = 2,
+    TypeFloat = 3,
+    TypeStr = 4,
+    TypeFloatArray = 5
+};
+
+/**
+ * ValueTypeOf
+ *
+ * Return the ValueType associated
+ * with a raw value type
+ */
+template <typename TypeRaw>
+struct ValueTypeOf;
+template <>
+struct ValueTypeOf<bool>
+{
+    static const ValueType value = TypeBool;
+};
+template <>
+struct ValueTypeOf<int64_t>
+{
+    static const ValueType value = TypeInt;
+};
+template <>
+struct ValueTypeOf<double>
+{
+    static const ValueType value = TypeFloat;
+};
+template <>
+struct ValueTypeOf<std::string>
+{
+    static const ValueType value = TypeStr;
+};
+template <>
+struct ValueTypeOf<std::vector<double>>
+{
+    static const ValueType value = TypeFloatArray;
+};
+
+/**
+ * ValueMetaBase
+ *
+ * Non type specific cold metadata
+ * of Value only accessed on creation,
+ * listing and persistence
+ */
+struct ValueMetaBase
+{
+    /**
+     * Value name
      */
-    int64_t timestamp;
+    std::string name;
+
+    /**
+     * A friendly and helpful comment message
+     */
+    std::string comment;
 
     /**
      * If false, the value will not be
@@ -50,6 +234,67 @@ struct ValueBase
      */
     bool persisted;
 
+    /**
+     * Default constructor
+     */
+    ValueMetaBase() :
+        name(""),
+        comment(""),
+        persisted(false)
+    {
+    }
+};
+
+/**
+ * ValueMeta
+ *
+ * Typed cold metadata of Value
+ */
+template <typename TypeRaw>
+struct ValueMeta : public ValueMetaBase
+{
+    /**
+     * The value stored in read config file
+     * (used to compute values diff)
+     */
+    TypeRaw valuePersisted;
+
+    /**
+     * Callback called on value update.
+     * Take the new value as argument.
+     */
+    std::function<void(TypeRaw)> callback;
+
+    /**
+     * Default constructor
+     */
+    ValueMeta() :
+        ValueMetaBase(),
+        valuePersisted(),
+        callback()
+    {
+    }
+};
+
+/**
+ * ValueBase
+ *
+ * Factorize non type specific 
+ * field of Value frequently accessed
+ * by value updates (hot state).
+ * Cold metadata are stored apart 
+ * and referenced by ptrMeta.
+ */
+struct ValueBase
+{
+    /**
+     * Last updated value timestamp
+     * expressed in microseconds.
+     * Atomic because it is written by RT 
+     * setters while being read by snapshots.
+     */
+    std::atomic<int64_t> timestamp;
+
     /**
      * The number of registered watcher
      * Streaming is enabled while at least
@@ -57,18 +302,58 @@ struct ValueBase
      */
     std::atomic<int64_t> streamWatchers;
 
+    /**
+     * Interned id of the absolute path
+     * used by streaming and logging
+     * (see PathRegistry)
+     */
+    size_t id;
+
+    /**
+     * Pointer to the value cold metadata.
+     * Not copied by copy and assignment
+     * (set by the owner of the metadata).
+     */
+    ValueMetaBase* ptrMeta;
+
+    /**
+     * Value type
+     */
+    ValueType type;
+
+    /**
+     * Flags indicating min & max presence
+     */
+    bool hasMin;
+    bool hasMax;
+
+    /**
+     * True if an update callback
+     * is set in the metadata
+     */
+    bool hasCallback;
+
+    /**
+     * True if the value is only written
+     * by RhIO itself (internal statistics).
+     * User setters are refused and the
+     * value is never logged.
+     */
+    bool readOnly;
+
     /**
      * Default constructor
      */
     ValueBase() :
-        name(""),
-        path(""),
-        comment(""),
+        timestamp(0),
+        streamWatchers(0),
+        id(0),
+        ptrMeta(nullptr),
+        type(NoValue),
         hasMin(false),
         hasMax(false),
-        timestamp(0),
-        persisted(false),
-        streamWatchers(0)
+        hasCallback(false),
+        readOnly(false)
     {
     }
 
@@ -76,14 +361,15 @@ struct ValueBase
      * Copy constructor
      */
     ValueBase(const ValueBase& v) :
-        name(v.name),
-        path(v.path),
-        comment(v.comment),
+        timestamp(v.timestamp.load(std::memory_order_relaxed)),
+        streamWatchers(v.streamWatchers.load()),
+        id(v.id),
+        ptrMeta(nullptr),
+        type(v.type),
         hasMin(v.hasMin),
         hasMax(v.hasMax),
-        timestamp(v.timestamp),
-        persisted(v.persisted),
-        streamWatchers(v.streamWatchers.load())
+        hasCallback(v.hasCallback),
+        readOnly(v.readOnly)
     {
     }
 
@@ -93,40 +379,73 @@ struct ValueBase
     ValueBase& operator=(const ValueBase& v)
     {
         if (this != &v) {
-            name = v.name;
-            path = v.path;
-            comment = v.comment;
+            timestamp.store(
+                v.timestamp.load(std::memory_order_relaxed),
+                std::memory_order_relaxed);
+            streamWatchers.store(v.streamWatchers.load());
+            id = v.id;
+            type = v.type;
             hasMin = v.hasMin;
             hasMax = v.hasMax;
-            timestamp = v.timestamp;
-            persisted = v.persisted;
-            streamWatchers.store(v.streamWatchers.load());
+            hasCallback = v.hasCallback;
+            readOnly = v.readOnly;
         }
 
         return *this;
     }
+
+    /**
+     * Return the value name, comment
+     * and persisted flag
+     * (stored in cold metadata)
+     */
+    const std::string& getName() const
+    {
+        return ptrMeta->name;
+    }
+    const std::string& getComment() const
+    {
+        return ptrMeta->comment;
+    }
+    bool isPersisted() const
+    {
+        return ptrMeta->persisted;
+    }
 };
 
 /**
- * Value
+ * ValueData
  *
- * Generic value holder
- * for parameters and monitor.
- * Type for actual value and meta
- * information are provided.
+ * Typed hot state of a value:
+ * actual value and bounds.
  */
 template <typename TypeVal, typename TypeRaw>
-struct Value : public ValueBase
+struct ValueData
 {
     /**
-     * Typedef value type
+     * Value value
      */
-    typedef TypeRaw Type;
+    TypeVal value;
+
+    /**
+     * Value min and max bounds
+     */
+    TypeRaw min;
+    TypeRaw max;
+};
 
+/**
+ * Partial template specialization for ValueData
+ * for atomic type value.
+ * Add copy and assignment because atomic is non copyable.
+ */
+template <typename TypeVal, typename TypeRaw>
+struct ValueData<std::atomic<TypeVal>, TypeRaw>
+{
     /**
      * Value value
      */
-    TypeVal value;
+    std::atomic<TypeVal> value;
 
     /**
      * Value min and max bounds
@@ -135,92 +454,219 @@ struct Value : public ValueBase
     TypeRaw max;
 
     /**
-     * The value stored in read config file
-     * (used to compute values diff)
+     * Default constructor
      */
-    TypeRaw valuePersisted;
+    ValueData() :
+        value(),
+        min(),
+        max()
+    {
+    }
 
     /**
-     * Callback called on value update.
-     * Take the new value as argument.
+     * Copy constructor
      */
-    std::function<void(TypeRaw)> callback;
+    ValueData(const ValueData<std::atomic<TypeVal>, TypeRaw>& v) :
+        value(v.value.load()),
+        min(v.min),
+        max(v.max)
+    {
+    }
+
+    /**
+     * Assignment operator
+     */
+    ValueData<std::atomic<TypeVal>, TypeRaw>& operator=(
+        const ValueData<std::atomic<TypeVal>, TypeRaw>& v)
+    {
+        if (this != &v) {
+            value.store(v.value.load());
+            min = v.min;
+            max = v.max;
+        }
+        return *this;
+    }
 };
 
 /**
- * Partial template specialization for Value
- * for atomic type value.
- * Add copy and assignment because atomic is non copyable.
+ * ValueStream
+ *
+ * Streaming filter policy and last
+ * published value state, read and updated
+ * by every streamed value update.
  */
-template <typename TypeVal, typename TypeRaw>
-struct Value<std::atomic<TypeVal>, TypeRaw> : public ValueBase
+struct ValueStream
 {
     /**
-     * Typedef value type
+     * Streaming filter policy
      */
-    typedef TypeRaw Type;
+    StreamFilterAtomic streamFilter;
 
     /**
-     * Value value
+     * Last published value state used
+     * by the streaming filter. Numeric values
+     * are stored as double and strings as hash.
+     * The state is checked and updated while
+     * the streamBusy flag is held.
+     * streamPending is true if the last sample
+     * was suppressed by the max rate only and
+     * has to be published once the period expires.
      */
-    std::atomic<TypeVal> value;
+    std::atomic<double> streamLastValue;
+    std::atomic<size_t> streamLastHash;
+    std::atomic<int64_t> streamLastTimestamp;
+    std::atomic<bool> streamBusy;
+    std::atomic<bool> streamHasLast;
+    std::atomic<bool> streamPending;
 
     /**
-     * Value min and max bounds
+     * Default constructor
      */
-    TypeRaw min;
-    TypeRaw max;
+    ValueStream() :
+        streamFilter(),
+        streamLastValue(0.0),
+        streamLastHash(0),
+        streamLastTimestamp(0),
+        streamBusy(false),
+        streamHasLast(false),
+        streamPending(false)
+    {
+    }
 
     /**
-     * The value stored in read config file
-     * (used to compute values diff)
+     * Copy constructor
      */
-    TypeRaw valuePersisted;
+    ValueStream(const ValueStream& v) :
+        streamFilter(v.streamFilter),
+        streamLastValue(v.streamLastValue.load()),
+        streamLastHash(v.streamLastHash.load()),
+        streamLastTimestamp(v.streamLastTimestamp.load()),
+        streamBusy(false),
+        streamHasLast(v.streamHasLast.load()),
+        streamPending(v.streamPending.load())
+    {
+    }
 
     /**
-     * Callback called on value update.
-     * Take the new value as argument.
+     * Assignment operation
      */
-    std::function<void(TypeRaw)> callback;
+    ValueStream& operator=(const ValueStream& v)
+    {
+        if (this != &v) {
+            streamFilter = v.streamFilter;
+            streamLastValue.store(v.streamLastValue.load());
+            streamLastHash.store(v.streamLastHash.load());
+            streamLastTimestamp.store(v.streamLastTimestamp.load());
+            streamHasLast.store(v.streamHasLast.load());
+            streamPending.store(v.streamPending.load());
+        }
+
+        return *this;
+    }
+};
+
+/**
+ * ValueHot
+ *
+ * Hot state of a value stored
+ * by the server (see ValueTable).
+ * Non type specific fields come first,
+ * followed by the value and bounds and 
+ * then the streaming state, so that the
+ * state accessed by get and set of small 
+ * values fits in the first cache line.
+ * The cold metadata are stored apart
+ * in a ValueMeta pointed by ptrMeta.
+ */
+template <typename TypeVal, typename TypeRaw>
+struct ValueHot : 
+    public ValueBase, 
+    public ValueData<TypeVal, TypeRaw>, 
+    public ValueStream
+{
+    /**
+     * Typedef value and 
+     * metadata type
+     */
+    typedef TypeRaw Type;
+    typedef ValueMeta<TypeRaw> Meta;
 
     /**
      * Default constructor
      */
-    Value() :
+    ValueHot() :
         ValueBase(),
-        value(),
-        min(),
-        max(),
-        valuePersisted(),
-        callback()
+        ValueData<TypeVal, TypeRaw>(),
+        ValueStream()
     {
+        type = ValueTypeOf<TypeRaw>::value;
     }
 
     /**
-     * Copy constructor
+     * Access to the typed cold metadata
      */
-    Value(const Value<std::atomic<TypeVal>, TypeRaw>& v) :
-        ValueBase(v),
-        value(v.value.load()),
-        min(v.min),
-        max(v.max),
-        valuePersisted(v.valuePersisted),
-        callback(v.callback)
+    Meta& meta()
+    {
+        return *static_cast<Meta*>(ptrMeta);
+    }
+    const Meta& meta() const
+    {
+        return *static_cast<const Meta*>(ptrMeta);
+    }
+};
+
+/**
+ * Value
+ *
+ * Generic value holder
+ * for parameters and monitor.
+ * Type for actual value and meta
+ * information are provided.
+ * Complete copy of hot state and cold 
+ * metadata used by clients and returned 
+ * by the server meta information getters.
+ */
+template <typename TypeVal, typename TypeRaw>
+struct Value : 
+    public ValueHot<TypeVal, TypeRaw>, 
+    public ValueMeta<TypeRaw>
+{
+    /**
+     * Default constructor
+     */
+    Value() :
+        ValueHot<TypeVal, TypeRaw>(),
+        ValueMeta<TypeRaw>()
     {
+        this->ptrMeta = static_cast<ValueMeta<TypeRaw>*>(this);
     }
 
     /**
-     * Assignment operator
+     * Copy constructors
+     * (from a complete value or 
+     * from a hot state and its metadata)
      */
-    Value<std::atomic<TypeVal>, TypeRaw>& operator=(const Value<std::atomic<TypeVal>, TypeRaw>& v)
+    Value(const Value<TypeVal, TypeRaw>& v) :
+        ValueHot<TypeVal, TypeRaw>(v),
+        ValueMeta<TypeRaw>(v)
+    {
+        this->ptrMeta = static_cast<ValueMeta<TypeRaw>*>(this);
+    }
+    explicit Value(const ValueHot<TypeVal, TypeRaw>& v) :
+        ValueHot<TypeVal, TypeRaw>(v),
+        ValueMeta<TypeRaw>(v.meta())
+    {
+        this->ptrMeta = static_cast<ValueMeta<TypeRaw>*>(this);
+    }
+
+    /**
+     * Assignment operation
+     */
+    Value<TypeVal, TypeRaw>& operator=(const Value<TypeVal, TypeRaw>& v)
     {
         if (this != &v) {
-            ValueBase::operator=(v);
-            value.store(v.value.load());
-            min = v.min;
-            max = v.max;
-            valuePersisted = v.valuePersisted;
-            callback = v.callback;
+            ValueHot<TypeVal, TypeRaw>::operator=(v);
+            ValueMeta<TypeRaw>::operator=(v);
         }
         return *this;
     }
@@ -232,18 +678,49 @@ struct Value<std::atomic<TypeVal>, TypeRaw> : public ValueBase
 typedef Value<std::atomic<int64_t>, bool> ValueBool;
 typedef Value<std::atomic<int64_t>, int64_t> ValueInt;
 typedef Value<std::atomic<double>, double> ValueFloat;
-typedef Value<std::string, std::string> ValueStr;
+typedef Value<LockFreeStr, std::string> ValueStr;
+typedef Value<LockFreeFloatArray, std::vector<double>> ValueFloatArray;
 
 /**
- * Enum for used value type
+ * Typedef for used value hot states
  */
-enum ValueType {
-    NoValue = 0,
-    TypeBool = 1,
-    TypeInt = 2,
-    TypeFloat = 3,
-    TypeStr = 4
-};
+typedef ValueHot<std::atomic<int64_t>, bool> ValueHotBool;
+typedef ValueHot<std::atomic<int64_t>, int64_t> ValueHotInt;
+typedef ValueHot<std::atomic<double>, double> ValueHotFloat;
+typedef ValueHot<LockFreeStr, std::string> ValueHotStr;
+typedef ValueHot<LockFreeFloatArray, std::vector<double>> ValueHotFloatArray;
+
+/**
+ * Check that given raw value is compatible
+ * with the built value and assign it.
+ * FloatArray values have a fixed length: 
+ * parameters of another length are rejected
+ * and the array is never resized.
+ */
+template <typename TypeVal, typename TypeRaw>
+inline void builderCheck(const TypeVal& value, const TypeRaw& val)
+{
+    (void)value;
+    (void)val;
+}
+inline void builderCheck(
+    const LockFreeFloatArray& value, const std::vector<double>& val)
+{
+    if (val.size() != value.size()) {
+        throw std::logic_error(
+            "RhIO invalid FloatArray parameter length");
+    }
+}
+template <typename TypeVal, typename TypeRaw>
+inline void builderAssign(TypeVal& value, const TypeRaw& val)
+{
+    value = val;
+}
+inline void builderAssign(
+    LockFreeFloatArray& value, const std::vector<double>& val)
+{
+    value.store(val);
+}
 
 /**
  * Proxy struct used to configure optional
@@ -263,23 +740,26 @@ struct ValueBuilder final
          * and an optional callback of finalize the value creation
          */
         ValueBuilder(
-            Value<TypeVal, TypeRaw>& val, 
+            ValueHot<TypeVal, TypeRaw>& val, 
             bool isExisting, 
-            std::function<void(Value<TypeVal, TypeRaw>&)> callback = [](Value<TypeVal, TypeRaw>&){}) :
+            std::function<void(ValueHot<TypeVal, TypeRaw>&)> callback = [](ValueHot<TypeVal, TypeRaw>&){}) :
             _isExisting(isExisting),
             _value(val),
             _callbackFinalize(callback)
         {
             //Default value parameters
             if (!isExisting) {
-                _value.comment = "";
+                _value.meta().comment = "";
                 _value.hasMin = false;
                 _value.hasMax = false;
                 _value.value = TypeRaw();
-                _value.valuePersisted = TypeRaw();
-                _value.persisted = false;
+                _value.meta().valuePersisted = TypeRaw();
+                _value.meta().persisted = false;
                 _value.streamWatchers = 0;
-                _value.callback = [](TypeRaw t){(void)t;};
+                _value.streamFilter = StreamFilter();
+                _value.meta().callback = nullptr;
+                _value.hasCallback = false;
+                _value.readOnly = false;
             }
         }
 
@@ -291,37 +771,87 @@ struct ValueBuilder final
             _callbackFinalize(_value);
         }
 
+        /**
+         * Add a callback called at the end of
+         * value creation after the current ones
+         */
+        void addCallbackFinalize(
+            std::function<void(ValueHot<TypeVal, TypeRaw>&)> callback)
+        {
+            std::function<void(ValueHot<TypeVal, TypeRaw>&)> previous = 
+                _callbackFinalize;
+            _callbackFinalize = 
+                [previous, callback](ValueHot<TypeVal, TypeRaw>& val) {
+                    previous(val);
+                    callback(val);
+                };
+        }
+
         /**
          * Optional parameters setters
          */
         ValueBuilder* comment(const std::string& str)
         {
-            _value.comment = str;
+            _value.meta().comment = str;
             return this;
         }
         ValueBuilder* minimum(TypeRaw val)
         {
+            builderCheck(_value.value, val);
             _value.hasMin = true;
             _value.min = val;
             return this;
         }
         ValueBuilder* maximum(TypeRaw val)
         {
+            builderCheck(_value.value, val);
             _value.hasMax = true;
             _value.max = val;
             return this;
         }
         ValueBuilder* defaultValue(TypeRaw val)
         {
+            builderCheck(_value.value, val);
             if (!_isExisting) {
-                _value.value = val;
-                _value.valuePersisted = val;
+                builderAssign(_value.value, val);
+                _value.meta().valuePersisted = val;
             }
             return this;
         }
         ValueBuilder* persisted(bool flag)
         {
-            _value.persisted = flag;
+            _value.meta().persisted = flag;
+            return this;
+        }
+        ValueBuilder* readOnly(bool flag)
+        {
+            _value.readOnly = flag;
+            return this;
+        }
+        ValueBuilder* streamOnChange(bool flag)
+        {
+            _value.streamFilter.onChange = flag;
+            return this;
+        }
+        ValueBuilder* streamDeadband(double threshold)
+        {
+            _value.streamFilter.deadbandAbs = threshold;
+            return this;
+        }
+        ValueBuilder* streamDeadbandRelative(double ratio)
+        {
+            _value.streamFilter.deadbandRel = ratio;
+            return this;
+        }
+        ValueBuilder* streamMaxRate(double frequency)
+        {
+            _value.streamFilter.periodMin = 
+                (frequency > 0.0) ? (int64_t)(1000000.0/frequency) : 0;
+            return this;
+        }
+        ValueBuilder* streamLatest(bool flag)
+        {
+            _value.streamFilter.latestOnly = flag;
             return this;
         }
 
@@ -336,13 +866,13 @@ struct ValueBuilder final
         /**
          * Internal built reference instance
          */
-        Value<TypeVal, TypeRaw>& _value;
+        ValueHot<TypeVal, TypeRaw>& _value;
 
         /**
          * An optional callback at 
          * the end of value creation
          */
-        std::function<void(Value<TypeVal, TypeRaw>&)> _callbackFinalize;
+        std::function<void(ValueHot<TypeVal, TypeRaw>&)> _callbackFinalize;
 };
 
 /**
@@ -351,7 +881,8 @@ struct ValueBuilder final
 typedef ValueBuilder<std::atomic<int64_t>, bool> ValueBuilderBool;
 typedef ValueBuilder<std::atomic<int64_t>, int64_t> ValueBuilderInt;
 typedef ValueBuilder<std::atomic<double>, double> ValueBuilderFloat;
-typedef ValueBuilder<std::string, std::string> ValueBuilderStr;
+typedef ValueBuilder<LockFreeStr, std::string> ValueBuilderStr;
+typedef ValueBuilder<LockFreeFloatArray, std::vector<double>> ValueBuilderFloatArray;
 
 }
 
@@ -83,6 +83,47 @@ void DataBuffer::writeData(const unsigned char* data, size_t size)
     memcpy(_data + _offset, data, size);
     _offset += size;
 }
+void DataBuffer::writeFloatArray(const std::vector<double>& val)
+{
+    writeInt(val.size());
+    
+    if (_offset + val.size()*sizeof(double) > _size) {
+        throw std::logic_error("RhIO buffer size overflow (write float array)");
+    }
+    
+    memcpy(_data + _offset, val.data(), val.size()*sizeof(double));
+    _offset += val.size()*sizeof(double);
+}
+void DataBuffer::writeVarInt(uint64_t val)
+{
+    do {
+        if (_offset + sizeof(uint8_t) > _size) {
+            throw std::logic_error("RhIO buffer size overflow (write varint)");
+        }
+        uint8_t byte = val & 0x7F;
+        val >>= 7;
+        if (val != 0) {
+            byte |= 0x80;
+        }
+        _data[_offset] = byte;
+        _offset += sizeof(uint8_t);
+    } while (val != 0);
+}
+void DataBuffer::writeVarIntSigned(int64_t val)
+{
+    //Zigzag encoding so that small 
+    //negative values are short
+    writeVarInt(((uint64_t)val << 1) ^ (uint64_t)(val >> 63));
+}
+void DataBuffer::writeRaw(const void* data, size_t size)
+{
+    if (_offset + size > _size) {
+        throw std::logic_error("RhIO buffer size overflow (write raw)");
+    }
+    
+    memcpy(_data + _offset, data, size);
+    _offset += size;
+}
         
 uint8_t DataBuffer::readType()
 {
@@ -154,6 +195,53 @@ unsigned char* DataBuffer::readData(size_t& size)
 
     return data;
 }
+std::vector<double> DataBuffer::readFloatArray()
+{
+    size_t size = readInt();
+    
+    if (_offset + size*sizeof(double) > _size) {
+        throw std::logic_error("RhIO buffer size overflow (read float array)");
+    }
+    
+    std::vector<double> val(size);
+    memcpy(val.data(), _data + _offset, size*sizeof(double));
+    _offset += size*sizeof(double);
+
+    return val;
+}
+uint64_t DataBuffer::readVarInt()
+{
+    uint64_t val = 0;
+    unsigned int shift = 0;
+    while (true) {
+        if (_offset + sizeof(uint8_t) > _size || shift > 63) {
+            throw std::logic_error("RhIO buffer size overflow (read varint)");
+        }
+        uint8_t byte = _data[_offset];
+        _offset += sizeof(uint8_t);
+        val |= (uint64_t)(byte & 0x7F) << shift;
+        if ((byte & 0x80) == 0) {
+            return val;
+        }
+        shift += 7;
+    }
+}
+int64_t DataBuffer::readVarIntSigned()
+{
+    uint64_t val = readVarInt();
+    return (int64_t)(val >> 1) ^ -(int64_t)(val & 1);
+}
+const unsigned char* DataBuffer::readRaw(size_t size)
+{
+    if (_offset + size > _size) {
+        throw std::logic_error("RhIO buffer size overflow (read raw)");
+    }
+    
+    const unsigned char* data = _data + _offset;
+    _offset += size;
+
+    return data;
+}
         
 void* DataBuffer::data()
 {
@@ -0,0 +1,146 @@
+#include <thread>
+#include <stdexcept>
+#include "rhio_common/LockFreeFloatArray.hpp"
+
+namespace RhIO {
+
+LockFreeFloatArray::LockFreeFloatArray() :
+    _seq(0),
+    _size(0),
+    _data()
+{
+}
+LockFreeFloatArray::LockFreeFloatArray(const std::vector<double>& vect) :
+    _seq(0),
+    _size(0),
+    _data()
+{
+    *this = vect;
+}
+
+LockFreeFloatArray::LockFreeFloatArray(const LockFreeFloatArray& vect) :
+    _seq(0),
+    _size(0),
+    _data()
+{
+    *this = vect.load();
+}
+LockFreeFloatArray& LockFreeFloatArray::operator=(const LockFreeFloatArray& vect)
+{
+    if (this != &vect) {
+        *this = vect.load();
+    }
+    return *this;
+}
+
+LockFreeFloatArray& LockFreeFloatArray::operator=(const std::vector<double>& vect)
+{
+    if (vect.size() != _size) {
+        _size = vect.size();
+        _data.reset(new std::atomic<double>[_size]);
+    }
+    for (size_t i=0;i<_size;i++) {
+        _data[i].store(vect[i], std::memory_order_relaxed);
+    }
+    _seq.fetch_add(2);
+    return *this;
+}
+
+size_t LockFreeFloatArray::size() const
+{
+    return _size;
+}
+
+std::vector<double> LockFreeFloatArray::load() const
+{
+    std::vector<double> vect(_size);
+    load(vect.data());
+    return vect;
+}
+void LockFreeFloatArray::load(double* data) const
+{
+    while (true) {
+        uint64_t seq1 = _seq.load(std::memory_order_acquire);
+        if (seq1 & 1) {
+            //A write is in progress
+            std::this_thread::yield();
+            continue;
+        }
+        for (size_t i=0;i<_size;i++) {
+            data[i] = _data[i].load(std::memory_order_relaxed);
+        }
+        std::atomic_thread_fence(std::memory_order_acquire);
+        uint64_t seq2 = _seq.load(std::memory_order_relaxed);
+        if (seq1 == seq2) {
+            return;
+        }
+    }
+}
+LockFreeFloatArray::operator std::vector<double>() const
+{
+    return load();
+}
+double LockFreeFloatArray::at(size_t index) const
+{
+    return _data[index].load(std::memory_order_relaxed);
+}
+
+void LockFreeFloatArray::store(const double* data)
+{
+    //Acquire writing by making 
+    //the sequence counter odd
+    uint64_t seq = _seq.load(std::memory_order_relaxed);
+    while (
+        (seq & 1) || 
+        !_seq.compare_exchange_weak(seq, seq + 1, 
+            std::memory_order_acquire, std::memory_order_relaxed)
+    ) {
+        seq = _seq.load(std::memory_order_relaxed);
+    }
+    std::atomic_thread_fence(std::memory_order_release);
+    for (size_t i=0;i<_size;i++) {
+        _data[i].store(data[i], std::memory_order_relaxed);
+    }
+    _seq.store(seq + 2, std::memory_order_release);
+}
+void LockFreeFloatArray::store(const std::vector<double>& vect)
+{
+    if (vect.size() != _size) {
+        throw std::logic_error(
+            "RhIO invalid FloatArray length");
+    }
+    store(vect.data());
+}
+
+bool operator==(const LockFreeFloatArray& vect1, const std::vector<double>& vect2)
+{
+    return vect1.load() == vect2;
+}
+bool operator==(const std::vector<double>& vect1, const LockFreeFloatArray& vect2)
+{
+    return vect1 == vect2.load();
+}
+bool operator!=(const LockFreeFloatArray& vect1, const std::vector<double>& vect2)
+{
+    return vect1.load() != vect2;
+}
+bool operator!=(const std::vector<double>& vect1, const LockFreeFloatArray& vect2)
+{
+    return vect1 != vect2.load();
+}
+std::ostream& operator<<(std::ostream& os, const LockFreeFloatArray& vect)
+{
+    std::vector<double> tmp = vect.load();
+    os << "[";
+    for (size_t i=0;i<tmp.size();i++) {
+        if (i > 0) {
+            os << " ";
+        }
+        os << tmp[i];
+    }
+    os << "]";
+    return os;
+}
+
+}
+
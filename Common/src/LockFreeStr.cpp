@@ -0,0 +1,325 @@
+#include <cstdint>
+#include <thread>
+#include "rhio_common/LockFreeStr.hpp"
+
+namespace RhIO {
+
+/**
+ * Maximum number of reader threads
+ * with a dedicated epoch record
+ */
+static const size_t MaxReaders = 256;
+
+/**
+ * Reader epoch record on its own cache line.
+ * Epoch is zero while the thread is not reading.
+ */
+struct alignas(64) ReaderRecord_t {
+    std::atomic<uint64_t> epoch;
+    std::atomic<bool> isUsed;
+};
+static ReaderRecord_t readerRecords[MaxReaders];
+
+/**
+ * Number of epoch records ever claimed
+ * (records are claimed in index order)
+ */
+static std::atomic<size_t> readerRecordsCount(0);
+
+/**
+ * Number of readers without dedicated record
+ * currently reading (reclamation is then blocked)
+ */
+static std::atomic<int64_t> readersOverflow(0);
+
+/**
+ * Global reclamation epoch
+ */
+static std::atomic<uint64_t> globalEpoch(1);
+
+/**
+ * Per thread reader state.
+ * Claim an epoch record on first use
+ * and release it at thread exit.
+ */
+class ReaderState
+{
+    public:
+
+        ReaderState() :
+            _record(nullptr),
+            _depth(0)
+        {
+            for (size_t i=0;i<MaxReaders;i++) {
+                bool isUsed = false;
+                if (readerRecords[i].isUsed.compare_exchange_strong(
+                    isUsed, true)
+                ) {
+                    _record = &(readerRecords[i]);
+                    _record->epoch.store(0);
+                    size_t count = readerRecordsCount.load();
+                    while (
+                        count < i + 1 && 
+                        !readerRecordsCount.compare_exchange_weak(
+                            count, i + 1)
+                    ) {
+                    }
+                    break;
+                }
+            }
+        }
+
+        ~ReaderState()
+        {
+            if (_record != nullptr) {
+                _record->epoch.store(0);
+                _record->isUsed.store(false);
+            }
+        }
+
+        void enter()
+        {
+            if (_depth++ > 0) {
+                return;
+            }
+            if (_record != nullptr) {
+                _record->epoch.store(globalEpoch.load());
+            } else {
+                readersOverflow++;
+            }
+        }
+
+        void exit()
+        {
+            if (--_depth > 0) {
+                return;
+            }
+            if (_record != nullptr) {
+                _record->epoch.store(0);
+            } else {
+                readersOverflow--;
+            }
+        }
+
+    private:
+
+        ReaderRecord_t* _record;
+        size_t _depth;
+};
+static thread_local ReaderState readerState;
+
+/**
+ * Scoped reader critical section
+ */
+struct ReaderGuard {
+    ReaderGuard()
+    {
+        readerState.enter();
+    }
+    ~ReaderGuard()
+    {
+        readerState.exit();
+    }
+};
+
+LockFreeStr::LockFreeStr() :
+    _ptr(nullptr),
+    _buffers(),
+    _free(0),
+    _retired(0)
+{
+    init("");
+}
+LockFreeStr::LockFreeStr(const std::string& str) :
+    _ptr(nullptr),
+    _buffers(),
+    _free(0),
+    _retired(0)
+{
+    init(str);
+}
+
+LockFreeStr::LockFreeStr(const LockFreeStr& str) :
+    _ptr(nullptr),
+    _buffers(),
+    _free(0),
+    _retired(0)
+{
+    init(str.load());
+}
+LockFreeStr& LockFreeStr::operator=(const LockFreeStr& str)
+{
+    if (this != &str) {
+        *this = str.load();
+    }
+    return *this;
+}
+
+LockFreeStr::~LockFreeStr()
+{
+    for (size_t i=0;i<MaxBuffers;i++) {
+        delete _buffers[i].load();
+    }
+}
+
+LockFreeStr& LockFreeStr::operator=(const std::string& str)
+{
+    store(str);
+    return *this;
+}
+
+std::string LockFreeStr::load() const
+{
+    ReaderGuard guard;
+    return _ptr.load()->str;
+}
+void LockFreeStr::load(std::string& str) const
+{
+    ReaderGuard guard;
+    str.assign(_ptr.load()->str);
+}
+LockFreeStr::operator std::string() const
+{
+    return load();
+}
+
+void LockFreeStr::store(const std::string& str)
+{
+    Buffer_t* buffer = takeBuffer();
+    buffer->str.assign(str);
+    Buffer_t* bufferOld = _ptr.exchange(buffer);
+    //Readers which may still access the old
+    //buffer have entered before this epoch
+    bufferOld->epoch.store(globalEpoch.fetch_add(1));
+    _retired.fetch_or((uint32_t)1 << bufferOld->index);
+}
+
+void LockFreeStr::init(const std::string& str)
+{
+    for (size_t i=0;i<MaxBuffers;i++) {
+        _buffers[i].store(nullptr);
+    }
+    for (size_t i=0;i<InitBuffers;i++) {
+        Buffer_t* buffer = new Buffer_t();
+        buffer->str.reserve(Capacity);
+        buffer->index = i;
+        buffer->epoch.store(0);
+        _buffers[i].store(buffer);
+    }
+    _buffers[0].load()->str.assign(str);
+    _ptr.store(_buffers[0].load());
+    _free.store((((uint32_t)1 << InitBuffers) - 1) & ~(uint32_t)1);
+    _retired.store(0);
+}
+
+LockFreeStr::Buffer_t* LockFreeStr::takeBuffer()
+{
+    while (true) {
+        //Take the first free buffer
+        uint32_t mask = _free.load();
+        while (mask != 0) {
+            size_t index = 0;
+            while ((mask & ((uint32_t)1 << index)) == 0) {
+                index++;
+            }
+            if (_free.compare_exchange_weak(
+                mask, mask & ~((uint32_t)1 << index))
+            ) {
+                return _buffers[index].load();
+            }
+        }
+        //Reuse the retired buffers
+        if (reclaim()) {
+            continue;
+        }
+        //Grow the pool since all buffers are
+        //still being read (rare, allocating)
+        for (size_t i=InitBuffers;i<MaxBuffers;i++) {
+            if (_buffers[i].load() != nullptr) {
+                continue;
+            }
+            Buffer_t* buffer = new Buffer_t();
+            buffer->str.reserve(Capacity);
+            buffer->index = i;
+            buffer->epoch.store(0);
+            Buffer_t* expected = nullptr;
+            if (_buffers[i].compare_exchange_strong(expected, buffer)) {
+                return buffer;
+            }
+            delete buffer;
+        }
+        //All MaxBuffers buffers are still being
+        //read. Wait for readers to exit (the 
+        //writer is not wait free in this case)
+        std::this_thread::yield();
+    }
+}
+
+bool LockFreeStr::reclaim()
+{
+    uint32_t mask = _retired.load();
+    if (mask == 0 || readersOverflow.load() > 0) {
+        return false;
+    }
+
+    //Compute the oldest epoch still being read
+    uint64_t epochMin = globalEpoch.load();
+    size_t count = readerRecordsCount.load();
+    for (size_t i=0;i<count;i++) {
+        uint64_t epoch = readerRecords[i].epoch.load();
+        if (epoch != 0 && epoch < epochMin) {
+            epochMin = epoch;
+        }
+    }
+
+    //Free the buffers retired before
+    //any currently active reader
+    bool isReclaimed = false;
+    for (size_t i=0;i<MaxBuffers;i++) {
+        uint32_t bit = (uint32_t)1 << i;
+        if ((mask & bit) == 0) {
+            continue;
+        }
+        //Claim the retired buffer before checking
+        //its epoch so that concurrent writers can not
+        //reuse and retire it again meanwhile
+        if ((_retired.fetch_and(~bit) & bit) == 0) {
+            continue;
+        }
+        Buffer_t* buffer = _buffers[i].load();
+        if (buffer->epoch.load() < epochMin) {
+            _free.fetch_or(bit);
+            isReclaimed = true;
+        } else {
+            //Still visible to a reader
+            _retired.fetch_or(bit);
+        }
+    }
+
+    return isReclaimed;
+}
+
+bool operator==(const LockFreeStr& str1, const std::string& str2)
+{
+    return str1.load() == str2;
+}
+bool operator==(const std::string& str1, const LockFreeStr& str2)
+{
+    return str1 == str2.load();
+}
+bool operator!=(const LockFreeStr& str1, const std::string& str2)
+{
+    return str1.load() != str2;
+}
+bool operator!=(const std::string& str1, const LockFreeStr& str2)
+{
+    return str1 != str2.load();
+}
+std::ostream& operator<<(std::ostream& os, const LockFreeStr& str)
+{
+    os << str.load();
+    return os;
+}
+
+}
+
@@ -21,6 +21,13 @@ void writeBinary<std::string>(std::ostream& os, const std::string& val)
     os.write((const char*)&len, sizeof(size_t));
     os.write((const char*)val.c_str(), len);
 }
+template <>
+void writeBinary<std::vector<double>>(std::ostream& os, const std::vector<double>& val)
+{
+    size_t len = val.size();
+    os.write((const char*)&len, sizeof(size_t));
+    os.write((const char*)val.data(), len*sizeof(double));
+}
 
 /**
  * Shorthand function reading a value
@@ -42,6 +49,14 @@ void readBinary<std::string>(std::ifstream& is, std::string& val)
     val = std::string(len, '\0');
     is.read((char*)val.c_str(), len);
 }
+template <>
+void readBinary<std::vector<double>>(std::ifstream& is, std::vector<double>& val)
+{
+    size_t len = 0;
+    is.read((char*)&len, sizeof(size_t));
+    val.resize(len);
+    is.read((char*)val.data(), len*sizeof(double));
+}
 
 void RhIOWriteBinaryLog(
     std::ostream& os, 
@@ -49,10 +64,12 @@ void RhIOWriteBinaryLog(
     const std::map<std::string, size_t>& mappingInt,
     const std::map<std::string, size_t>& mappingFloat,
     const std::map<std::string, size_t>& mappingStr,
+    const std::map<std::string, size_t>& mappingFloatArray,
     const std::deque<LogValBool>& valuesBool,
     const std::deque<LogValInt>& valuesInt,
     const std::deque<LogValFloat>& valuesFloat,
-    const std::deque<LogValStr>& valuesStr)
+    const std::deque<LogValStr>& valuesStr,
+    const std::deque<LogValFloatArray>& valuesFloatArray)
 {
     //Write value name mapping sizes
     size_t sizeMapBool = mappingBool.size();
@@ -113,6 +130,39 @@ void RhIOWriteBinaryLog(
         writeBinary(os, valuesStr[i].timestamp);
         writeBinary(os, valuesStr[i].value);
     }
+
+    //Write FloatArray section
+    size_t sizeMapFloatArray = mappingFloatArray.size();
+    writeBinary(os, sizeMapFloatArray);
+    for (const auto& it : mappingFloatArray) {
+        writeBinary(os, it.first);
+        writeBinary(os, it.second);
+    }
+    size_t sizeValFloatArray = valuesFloatArray.size();
+    writeBinary(os, sizeValFloatArray);
+    for (size_t i=0;i<sizeValFloatArray;i++) {
+        writeBinary(os, valuesFloatArray[i].id);
+        writeBinary(os, valuesFloatArray[i].timestamp);
+        writeBinary(os, valuesFloatArray[i].value);
+    }
+}
+void RhIOWriteBinaryLog(
+    std::ostream& os, 
+    const std::map<std::string, size_t>& mappingBool,
+    const std::map<std::string, size_t>& mappingInt,
+    const std::map<std::string, size_t>& mappingFloat,
+    const std::map<std::string, size_t>& mappingStr,
+    const std::deque<LogValBool>& valuesBool,
+    const std::deque<LogValInt>& valuesInt,
+    const std::deque<LogValFloat>& valuesFloat,
+    const std::deque<LogValStr>& valuesStr)
+{
+    RhIOWriteBinaryLog(
+        os,
+        mappingBool, mappingInt, mappingFloat, mappingStr,
+        std::map<std::string, size_t>(),
+        valuesBool, valuesInt, valuesFloat, valuesStr,
+        std::deque<LogValFloatArray>());
 }
 
 bool RhIOReadBinaryLog(
@@ -121,21 +171,27 @@ bool RhIOReadBinaryLog(
     std::map<std::string, size_t>& mappingInt,
     std::map<std::string, size_t>& mappingFloat,
     std::map<std::string, size_t>& mappingStr,
+    std::map<std::string, size_t>& mappingFloatArray,
     std::vector<LogValBool>& valuesBool,
     std::vector<LogValInt>& valuesInt,
     std::vector<LogValFloat>& valuesFloat,
-    std::vector<LogValStr>& valuesStr)
+    std::vector<LogValStr>& valuesStr,
+    std::vector<LogValFloatArray>& valuesFloatArray)
 {
     //Reset containers
     mappingBool.clear();
     mappingInt.clear();
     mappingFloat.clear();
     mappingStr.clear();
+    mappingFloatArray.clear();
     valuesBool.clear();
     valuesInt.clear();
     valuesFloat.clear();
     valuesStr.clear();
+    valuesFloatArray.clear();
     
+    size_t sizeMapFloatArray = 0;
+    size_t sizeValFloatArray = 0;
     size_t sizeMapBool = 0;
     size_t sizeMapInt = 0;
     size_t sizeMapFloat = 0;
@@ -225,6 +281,27 @@ bool RhIOReadBinaryLog(
         readBinary(is, valuesStr[i].timestamp);
         readBinary(is, valuesStr[i].value);
     }
+
+    //Read optional FloatArray section
+    if (!is.good() || is.peek() == EOF) return true;
+    readBinary(is, sizeMapFloatArray);
+    for (size_t i=0;i<sizeMapFloatArray;i++) {
+        if (!is.good() || is.peek() == EOF) goto errorCase;
+        std::string name;
+        size_t id;
+        readBinary(is, name);
+        readBinary(is, id);
+        mappingFloatArray.insert(std::make_pair(name, id));
+    }
+    if (!is.good() || is.peek() == EOF) goto errorCase;
+    readBinary(is, sizeValFloatArray);
+    valuesFloatArray.assign(sizeValFloatArray, LogValFloatArray());
+    for (size_t i=0;i<sizeValFloatArray;i++) {
+        if (!is.good() || is.peek() == EOF) goto errorCase;
+        readBinary(is, valuesFloatArray[i].id);
+        readBinary(is, valuesFloatArray[i].timestamp);
+        readBinary(is, valuesFloatArray[i].value);
+    }
     
     return true;
     
@@ -236,26 +313,54 @@ errorCase:
     mappingInt.clear();
     mappingFloat.clear();
     mappingStr.clear();
+    mappingFloatArray.clear();
     valuesBool.clear();
     valuesInt.clear();
     valuesFloat.clear();
     valuesStr.clear();
+    valuesFloatArray.clear();
 
     return false;
 }
+bool RhIOReadBinaryLog(
+    std::ifstream& is,
+    std::map<std::string, size_t>& mappingBool,
+    std::map<std::string, size_t>& mappingInt,
+    std::map<std::string, size_t>& mappingFloat,
+    std::map<std::string, size_t>& mappingStr,
+    std::vector<LogValBool>& valuesBool,
+    std::vector<LogValInt>& valuesInt,
+    std::vector<LogValFloat>& valuesFloat,
+    std::vector<LogValStr>& valuesStr)
+{
+    std::map<std::string, size_t> mappingFloatArray;
+    std::vector<LogValFloatArray> valuesFloatArray;
+    return RhIOReadBinaryLog(
+        is,
+        mappingBool, mappingInt, mappingFloat, mappingStr,
+        mappingFloatArray,
+        valuesBool, valuesInt, valuesFloat, valuesStr,
+        valuesFloatArray);
+}
 bool RhIOReadBinaryLog(
     std::ifstream& is,
     std::map<std::string, std::vector<LogValBool>>& containerBool,
     std::map<std::string, std::vector<LogValInt>>& containerInt,
     std::map<std::string, std::vector<LogValFloat>>& containerFloat,
-    std::map<std::string, std::vector<LogValStr>>& containerStr)
+    std::map<std::string, std::vector<LogValStr>>& containerStr,
+    std::map<std::string, std::vector<LogValFloatArray>>& containerFloatArray)
 {
     //Reset containers
     containerBool.clear();
     containerInt.clear();
     containerFloat.clear();
     containerStr.clear();
+    containerFloatArray.clear();
     
+    size_t sizeMapFloatArray = 0;
+    size_t sizeValFloatArray = 0;
+    std::map<size_t, std::string> mappingInvFloatArray;
+
     size_t sizeMapBool = 0;
     size_t sizeMapInt = 0;
     size_t sizeMapFloat = 0;
@@ -358,6 +463,30 @@ bool RhIOReadBinaryLog(
         readBinary(is, val.value);
         containerStr.at(mappingInvStr.at(val.id)).push_back(val);
     }
+
+    //Read optional FloatArray section
+    if (!is.good() || is.peek() == EOF) return true;
+    readBinary(is, sizeMapFloatArray);
+    for (size_t i=0;i<sizeMapFloatArray;i++) {
+        if (!is.good() || is.peek() == EOF) goto errorCase;
+        std::string name;
+        size_t id;
+        readBinary(is, name);
+        readBinary(is, id);
+        mappingInvFloatArray.insert(std::make_pair(id, name));
+        containerFloatArray.insert(std::make_pair(
+            name, std::vector<LogValFloatArray>()));
+    }
+    if (!is.good() || is.peek() == EOF) goto errorCase;
+    readBinary(is, sizeValFloatArray);
+    for (size_t i=0;i<sizeValFloatArray;i++) {
+        if (!is.good() || is.peek() == EOF) goto errorCase;
+        LogValFloatArray val;
+        readBinary(is, val.id);
+        readBinary(is, val.timestamp);
+        readBinary(is, val.value);
+        containerFloatArray.at(mappingInvFloatArray.at(val.id)).push_back(val);
+    }
     
     return true;
     
@@ -369,9 +498,23 @@ errorCase:
     containerInt.clear();
     containerFloat.clear();
     containerStr.clear();
+    containerFloatArray.clear();
 
     return false;
 }
+bool RhIOReadBinaryLog(
+    std::ifstream& is,
+    std::map<std::string, std::vector<LogValBool>>& containerBool,
+    std::map<std::string, std::vector<LogValInt>>& containerInt,
+    std::map<std::string, std::vector<LogValFloat>>& containerFloat,
+    std::map<std::string, std::vector<LogValStr>>& containerStr)
+{
+    std::map<std::string, std::vector<LogValFloatArray>> containerFloatArray;
+    return RhIOReadBinaryLog(
+        is,
+        containerBool, containerInt, containerFloat, containerStr,
+        containerFloatArray);
+}
 
 }
 
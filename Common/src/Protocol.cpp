@@ -8,4 +8,6 @@ const unsigned int PortServerPub = 9998;
 
 const std::string AddressMulticast = "239.9.9.9";
 
+const size_t StreamPacketSize = 1400;
+
 }
@@ -2,11 +2,14 @@
 #define RHIO_HPP
 
 #include <functional>
+#include <atomic>
 #include "rhio_common/Time.hpp"
 #include "rhio_common/Protocol.hpp"
 #include "rhio_server/IONode.hpp"
 #include "rhio_server/Bind.hpp"
 #include "rhio_server/Wrapper.hpp"
+#include "rhio_server/ValueHandle.hpp"
+#include "rhio_server/ValueBatch.hpp"
 
 namespace RhIO {
 
@@ -30,6 +33,52 @@ extern ServerPub* ServerStream;
 class ServerLog;
 extern ServerLog* ServerLogging;
 
+/**
+ * Internal pointer to the callback dispatcher
+ * used when value callbacks are deferred
+ * (nullptr if callbacks are called inline)
+ */
+class CallbackDispatcher;
+extern std::atomic<CallbackDispatcher*> ServerCallback;
+
+/**
+ * Internal number of value setters currently
+ * pushing a callback into the dispatcher
+ * (waited for by setCallbackMode())
+ */
+extern std::atomic<int64_t> ServerCallbackUsers;
+
+/**
+ * Value update callbacks execution mode.
+ * CallbackInline: callbacks are called by value
+ * setters while the node lock is held (default).
+ * CallbackDeferred: callbacks are queued and only
+ * called from the user loop by dispatchCallbacks().
+ * CallbackThread: callbacks are queued and called
+ * by a dedicated RhIO thread.
+ */
+enum CallbackMode {
+    CallbackInline,
+    CallbackDeferred,
+    CallbackThread,
+};
+
+/**
+ * Streaming publisher thread scheduling mode.
+ * PublishPeriodic: published samples are sent
+ * every start() period (default).
+ * PublishEvent: the publisher thread sleeps until
+ * a sample is published and sends it immediately 
+ * unless the previous send is more recent than the
+ * batching window (minimum time between two sends,
+ * samples published meanwhile are sent together).
+ * Samples are still sent at least every period.
+ */
+enum PublishMode {
+    PublishPeriodic,
+    PublishEvent,
+};
+
 /**
  * Start the RhIO server.
  *
@@ -39,12 +88,17 @@ extern ServerLog* ServerLogging;
  * of streaming pub server loop.
  * @param logLength_ Maximum log time of log server 
  * history in seconds (infinite if negative).
+ * @param logCapacity_ Maximum number of values of 
+ * each type logged by one thread between two log 
+ * server loops. If zero, the RHIO_LOG_CAPACITY 
+ * environment variable or 5000000 is used.
  */
 void start(
     unsigned int portRep_ = PortServerRep,
     unsigned int portPub_ = PortServerPub,
     unsigned int period_ = 20,
-    unsigned int logLengthSecs_ = (unsigned int)-1);
+    unsigned int logLengthSecs_ = (unsigned int)-1,
+    size_t logCapacity_ = 0);
 
 /**
  * Wait for the RhIO server
@@ -71,11 +125,54 @@ void writeLogs(const std::string& filepath);
 
 /**
  * Set the time getter function used 
- * for default value timestamp.
+ * for default value timestamp
+ * and select the TimeFunc source.
  * The given function MUST be thread safe.
  */
 void setRhIOTimeFunc(std::function<int64_t()> func);
 
+/**
+ * Select the clock source used for default 
+ * value timestamp (see TimeSource).
+ * The time stamp counter is calibrated
+ * when selected (blocking for 20ms).
+ * Must not be called concurrently with value updates.
+ */
+void setRhIOTimeSource(TimeSource source);
+
+/**
+ * Set the value callbacks execution mode.
+ * Pending deferred callbacks are dispatched
+ * when switching back to inline mode, once
+ * the setters still pushing into the 
+ * dispatcher are over.
+ */
+void setCallbackMode(CallbackMode mode);
+
+/**
+ * Set the streaming publisher thread mode and 
+ * the batching window in microseconds used by 
+ * the event mode. Can be called at any time.
+ */
+void setPublishMode(PublishMode mode, 
+    unsigned int windowUs = 1000);
+
+/**
+ * Call all queued deferred value callbacks
+ * without holding any node lock.
+ * Per value update order is preserved.
+ * Return the number of called callbacks.
+ */
+size_t dispatchCallbacks();
+
+/**
+ * Return the number of deferred callback calls
+ * dropped because the dispatcher queue was full
+ * (accounted at dispatch, also exported
+ * in statistics values)
+ */
+uint64_t countDroppedCallbacks();
+
 }
 
 #endif
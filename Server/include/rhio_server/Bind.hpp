@@ -6,6 +6,8 @@
 #include "RhIO.hpp"
 #include "rhio_common/Value.hpp"
 #include "rhio_server/ValueNode.hpp"
+#include "rhio_server/ValueHandle.hpp"
+#include "rhio_server/ValueBatch.hpp"
 
 namespace RhIO {
 
@@ -123,6 +125,7 @@ class Bind
         /**
          * Alias to FrameNode::newFrame
          * and FrameNode::framePush
+         * and FrameNode::frameLease
          * using internal prefix child
          */
         void newFrame(const std::string& name, 
@@ -132,32 +135,46 @@ class Bind
         void framePush(const std::string& name, 
             size_t width, size_t height,
             unsigned char* data, size_t size);
+        FrameBuffer* frameLease(const std::string& name, 
+            size_t width, size_t height);
 
         /**
          * Import RhIO global values to
-         * binded pointer
+         * binded pointer.
+         * Values are read through pointers
+         * resolved at bind time (no lookup).
          */
         void pull();
 
         /**
          * Export binded pointer to global
-         * RhIO values
+         * RhIO values.
+         * All updates are applied as one batch
+         * with a single shared timestamp (see ValueBatch).
          */
         void push();
 
+        /**
+         * If enabled, push() skips variables
+         * not changed since the last pull() or push().
+         * Disabled by default.
+         */
+        void setPushOnChange(bool isEnabled);
+
     private:
 
         /**
          * Structure holding binding
          * information
-         * Value relative name, node
-         * pointer and value pointer
+         * Variable pointer, value handle resolved
+         * at bind time, variable value at last pull 
+         * or push (dirty check) and policy
          */
-        template <typename T>
+        template <typename T, typename H>
         struct BindInfo {
-            std::string name;
-            IONode* node;
             T* ptr;
+            ValueHandle<H> handle;
+            T last;
             Policy policy;
         };
 
@@ -171,12 +188,23 @@ class Bind
          * Binded information container
          * for each type
          */
-        std::vector<BindInfo<bool>> _bindsBool;
-        std::vector<BindInfo<int>> _bindsInt;
-        std::vector<BindInfo<long>> _bindsLong;
-        std::vector<BindInfo<float>> _bindsFloat;
-        std::vector<BindInfo<double>> _bindsDouble;
-        std::vector<BindInfo<std::string>> _bindsStr;
+        std::vector<BindInfo<bool, bool>> _bindsBool;
+        std::vector<BindInfo<int, int64_t>> _bindsInt;
+        std::vector<BindInfo<long, int64_t>> _bindsLong;
+        std::vector<BindInfo<float, double>> _bindsFloat;
+        std::vector<BindInfo<double, double>> _bindsDouble;
+        std::vector<BindInfo<std::string, std::string>> _bindsStr;
+
+        /**
+         * Reused batch of pushed updates
+         */
+        ValueBatch _batch;
+
+        /**
+         * If true, unchanged
+         * variables are not pushed
+         */
+        bool _isPushOnChange;
 
         /**
          * Create given absolute path if
@@ -190,12 +218,6 @@ class Bind
          * given value absolute name
          */
         IONode* getChildPtr(const std::string& name) const;
-        
-        /**
-         * Extract relative value name from
-         * given value absolute name
-         */
-        std::string relativeName(const std::string& name) const;
 
         /**
          * Return true if given variable address
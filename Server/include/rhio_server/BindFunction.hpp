@@ -1,6 +1,10 @@
 #ifndef RHIO_BINDFUNCTION_HPP
 #define RHIO_BINDFUNCTION_HPP
 
+#include <sstream>
+#include <type_traits>
+#include "rhio_common/CommandArgs.hpp"
+
 namespace RhIO {
 
 /**
@@ -30,6 +34,21 @@ inline string to_string(const string& str)
 {
     return str;
 }
+inline string to_string(const vector<double>& vect)
+{
+    string str;
+    for (size_t i=0;i<vect.size();i++) {
+        if (i > 0) {
+            str += " ";
+        }
+        str += to_string(vect[i]);
+    }
+    return str;
+}
+inline string to_string(const vector<unsigned char>& data)
+{
+    return string(data.begin(), data.end());
+}
 
 }
 
@@ -154,6 +173,42 @@ struct FromString<std::string> {
     }
 };
 
+template <>
+struct FromString<std::vector<double>> {
+    inline static std::vector<double> convert(const std::string& str) {
+        //Space, comma or bracket separated values
+        std::vector<double> vect;
+        std::string tmp = str;
+        for (char& c : tmp) {
+            if (c == ',' || c == '[' || c == ']') {
+                c = ' ';
+            }
+        }
+        std::istringstream ss(tmp);
+        double val;
+        while (ss >> val) {
+            vect.push_back(val);
+        }
+        if (!ss.eof()) {
+            throw std::invalid_argument(
+                "RhIO invalid float array: " + str);
+        }
+        return vect;
+    }
+    inline static std::string type() {
+        return "float[]";
+    }
+};
+template <>
+struct FromString<CommandData> {
+    inline static CommandData convert(const std::string& str) {
+        return CommandData(str.begin(), str.end());
+    }
+    inline static std::string type() {
+        return "data";
+    }
+};
+
 /**
  * Compile time sequence of integer
  */
@@ -179,7 +234,8 @@ template <typename Ret, typename Arg, typename ... Args>
 std::function<Ret(Args...)> custom_bind(
     std::function<Ret(Arg, Args...)> func, Arg arg)
 {
-    return custom_bind_aux(func, arg, make_int_sequence<sizeof...(Args)>());
+    return custom_bind_aux<Ret, Arg, Args...>(
+        func, arg, make_int_sequence<sizeof...(Args)>());
 }
 
 /**
@@ -220,18 +276,49 @@ std::function<Ret(void)> params_bind(
     const std::vector<std::string>& params,
     const std::vector<std::string>& defaultArgs)
 {
-    Arg val;
+    typedef typename std::decay<Arg>::type ArgVal;
+    ArgVal val;
     if (N < params.size()) {
-        val = FromString<Arg>::convert(params.at(N));
+        val = FromString<ArgVal>::convert(params.at(N));
     } else if (N < defaultArgs.size() && defaultArgs.at(N) != "") {
-        val = FromString<Arg>::convert(defaultArgs.at(N));
+        val = FromString<ArgVal>::convert(defaultArgs.at(N));
     } else {
         throw std::runtime_error(std::string(
             "RhIO bind error at argument ") + std::to_string(N+1));
     }
 
     return params_bind<N+1, Ret, Args...>(
-        custom_bind(func, val), params, defaultArgs);
+        custom_bind<Ret, Arg, Args...>(func, val), params, defaultArgs);
+}
+
+/**
+ * Decode given binary arguments
+ * and bind to given function
+ */
+template <int N, typename Ret> 
+std::function<Ret(void)> params_bind_binary(
+    std::function<Ret(void)> func, 
+    DataBuffer& buffer)
+{
+    (void)buffer;
+    return func;
+}
+template <int N, typename Ret, typename Arg, typename ... Args>
+std::function<Ret(void)> params_bind_binary(
+    std::function<Ret(Arg, Args...)> func, 
+    DataBuffer& buffer)
+{
+    typedef typename std::decay<Arg>::type ArgVal;
+    ArgVal val;
+    try {
+        val = CommandArg<ArgVal>::read(buffer);
+    } catch (const std::exception& e) {
+        throw std::runtime_error(std::string(
+            "RhIO bind error at argument ") + std::to_string(N+1));
+    }
+
+    return params_bind_binary<N+1, Ret, Args...>(
+        custom_bind<Ret, Arg, Args...>(func, val), buffer);
 }
 
 /**
@@ -248,7 +335,8 @@ std::string bind_usage_aux(const std::vector<std::string>& defaultArgs)
 template <int N, typename Arg, typename ... Args>
 std::string bind_usage_aux(const std::vector<std::string>& defaultArgs)
 {
-    std::string part = FromString<Arg>::type();
+    std::string part = 
+        FromString<typename std::decay<Arg>::type>::type();
     if (
         N < defaultArgs.size() && 
         defaultArgs.at(N) != ""
@@ -263,7 +351,8 @@ std::string bind_usage(const std::vector<std::string>& defaultArgs)
 {
     //Print arguments and return type
     return bind_usage_aux<0, Args...>(defaultArgs) 
-        + "--> <" + FromString<Ret>::type() + ">";
+        + "--> <" + 
+        FromString<typename std::decay<Ret>::type>::type() + ">";
 }
 
 /**
@@ -287,6 +376,29 @@ struct BindApply<void> {
     }
 };
 
+/**
+ * Conditionaly apply and encode return value of
+ * given binded function as binary result.
+ * If return value is void, return an empty 
+ * arguments list
+ */
+template <typename Ret>
+struct BindApplyBinary {
+    static CommandData apply(std::function<Ret()> func)
+    {
+        return commandArgsPack(
+            (typename std::decay<Ret>::type)func());
+    }
+};
+template <>
+struct BindApplyBinary<void> {
+    static CommandData apply(std::function<void()> func)
+    {
+        func();
+        return commandArgsPack();
+    }
+};
+
 /**
  * Implement command method binding
  */
@@ -310,6 +422,7 @@ void Bind::bindFunc(
             "RhIO default parameters given with invalid size");
     }
     //Create and implement the command
+    //with textual and binary signatures
     node().newCommand(name, comment, 
     [func, &self, name, defaultArgs]
     (const std::vector<std::string>& params) -> std::string {
@@ -334,7 +447,24 @@ void Bind::bindFunc(
                 return "User exception: " + std::string(e.what());
             }
         }
-
+    },
+    [func, &self, name]
+    (const CommandData& params) -> CommandData {
+        //Bind member method with given class instance
+        auto tmpFunc = custom_bind_member(func, &self);
+        //Check the number of encoded arguments
+        DataBuffer buffer((void*)params.data(), params.size());
+        if (buffer.readInt() != (int64_t)sizeof...(Args)) {
+            throw std::runtime_error(
+                "RhIO bind error invalid number of arguments.\nUSAGE: "
+                + std::string(name) + " " 
+                + bind_usage<Ret, Args...>({}));
+        }
+        //Bind function parameters with decoded values.
+        //User exceptions are forwarded.
+        auto tmpFunc2 = params_bind_binary<0, Ret, Args...>(
+            tmpFunc, buffer);
+        return BindApplyBinary<Ret>::apply(tmpFunc2);
     });
 }
 
@@ -0,0 +1,131 @@
+#ifndef RHIO_CALLBACKDISPATCHER_HPP
+#define RHIO_CALLBACKDISPATCHER_HPP
+
+#include <string>
+#include <mutex>
+#include "rhio_common/Value.hpp"
+#include "rhio_common/LockFreeDoubleQueue.hpp"
+
+namespace RhIO {
+
+/**
+ * Forward declaration
+ */
+class ValueNode;
+
+/**
+ * CallbackDispatcher
+ *
+ * Deferred execution of value update callbacks.
+ * Setters only append the new value into a lock
+ * free queue (while holding the node lock) and the
+ * user callbacks are later called by dispatch()
+ * without any node lock held.
+ * Callbacks of a given value are called in
+ * update order (a value updates are serialized
+ * by its node lock and always go to the same queue).
+ */
+class CallbackDispatcher
+{
+    public:
+
+        /**
+         * Initialization
+         */
+        CallbackDispatcher();
+
+        /**
+         * Queue a callback call for given value structure
+         * owned by given node with given new value for each type.
+         * Lock free, no dynamic allocation (except Str and FloatArray).
+         * Return false if the queue is full and
+         * the call has been dropped (dropped calls are
+         * counted, see getCountDropped()).
+         */
+        bool pushBool(ValueNode* node,
+            ValueHotBool* ptrValue, bool val);
+        bool pushInt(ValueNode* node,
+            ValueHotInt* ptrValue, int64_t val);
+        bool pushFloat(ValueNode* node,
+            ValueHotFloat* ptrValue, double val);
+        bool pushStr(ValueNode* node,
+            ValueHotStr* ptrValue, const std::string& val);
+        bool pushFloatArray(ValueNode* node,
+            ValueHotFloatArray* ptrValue, const std::vector<double>& val);
+
+        /**
+         * Call all queued callbacks.
+         * Return the number of called callbacks.
+         * Thread safe but NOT real time.
+         */
+        size_t dispatch();
+
+        /**
+         * Discard all queued callbacks
+         */
+        void clear();
+
+        /**
+         * Return the number of callback calls
+         * dropped because a queue was full
+         */
+        uint64_t getCountDropped() const;
+
+        /**
+         * Export the queues counters
+         * as statistics values
+         */
+        void updateStats() const;
+
+    private:
+
+        /**
+         * Queued callback call
+         */
+        template <typename V, typename T>
+        struct Deferred {
+            //Node owning the value
+            ValueNode* node;
+            //Updated value structure
+            V* ptrValue;
+            //New assigned value
+            T value;
+        };
+
+        /**
+         * Typedef for typed calls
+         */
+        typedef Deferred<ValueHotBool, bool> DeferredBool;
+        typedef Deferred<ValueHotInt, int64_t> DeferredInt;
+        typedef Deferred<ValueHotFloat, double> DeferredFloat;
+        typedef Deferred<ValueHotStr, std::string> DeferredStr;
+        typedef Deferred<ValueHotFloatArray, std::vector<double>> DeferredFloatArray;
+
+        /**
+         * Lock free double buffer of
+         * queued calls for each type
+         */
+        LockFreeDoubleQueue<DeferredBool> _queueBool;
+        LockFreeDoubleQueue<DeferredInt> _queueInt;
+        LockFreeDoubleQueue<DeferredFloat> _queueFloat;
+        LockFreeDoubleQueue<DeferredStr> _queueStr;
+        LockFreeDoubleQueue<DeferredFloatArray> _queueFloatArray;
+
+        /**
+         * Mutex serializing dispatch calls
+         */
+        std::mutex _mutex;
+
+        /**
+         * Swap given queue and call
+         * all its queued callbacks
+         */
+        template <typename V, typename T>
+        size_t dispatchQueue(
+            LockFreeDoubleQueue<Deferred<V, T>>& queue);
+};
+
+}
+
+#endif
+
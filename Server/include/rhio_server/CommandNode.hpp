@@ -7,6 +7,7 @@
 #include <mutex>
 #include <functional>
 
+#include "rhio_common/CommandArgs.hpp"
 #include "rhio_server/BaseNode.hpp"
 
 namespace RhIO {
@@ -25,6 +26,14 @@ class CommandNode: public BaseNode<CommandNode>
          */
         typedef std::function<
             std::string(std::vector<std::string>)> CommandFunc;
+
+        /**
+         * Typedef for optional binary Command function
+         * taking and returning typed arguments encoded
+         * as raw bytes (see CommandArgs)
+         */
+        typedef std::function<
+            CommandData(const CommandData&)> CommandBinaryFunc;
         
         /**
          * Inherit BaseNode constructor
@@ -51,6 +60,21 @@ class CommandNode: public BaseNode<CommandNode>
         std::string call(const std::string& name, 
             const std::vector<std::string>& arguments);
 
+        /**
+         * Return true if given command name is registered
+         * with a binary signature
+         */
+        bool commandBinaryExist(const std::string& name) const;
+
+        /**
+         * Call given command name binary signature with 
+         * given encoded arguments and return encoded result.
+         * Throw std::logic_error if given name does not
+         * exist or has no binary signature
+         */
+        CommandData callBinary(const std::string& name, 
+            const CommandData& arguments);
+
         /**
          * Return the textual description of given relative
          * command name.
@@ -71,6 +95,16 @@ class CommandNode: public BaseNode<CommandNode>
             const std::string& comment,
             CommandFunc func);
 
+        /**
+         * Register a new command with given name, textual
+         * description, textual callback function and
+         * binary callback function.
+         */
+        void newCommand(const std::string& name, 
+            const std::string& comment,
+            CommandFunc func,
+            CommandBinaryFunc funcBinary);
+
         /**
          * Return the relative name list of 
          * all registered commands
@@ -80,10 +114,12 @@ class CommandNode: public BaseNode<CommandNode>
     private:
 
         /**
-         * Container map for commands functions
+         * Container map for commands functions,
+         * binary commands functions
          * and commands descriptions
          */
         std::map<std::string, CommandFunc> _commands;
+        std::map<std::string, CommandBinaryFunc> _commandsBinary;
         std::map<std::string, std::string> _descriptions;
         
         /**
@@ -6,10 +6,12 @@
 #include <vector>
 #include <map>
 #include <mutex>
+#include <memory>
 
 #include "rhio_common/Time.hpp"
 #include "rhio_server/BaseNode.hpp"
 #include "rhio_common/Frame.hpp"
+#include "rhio_server/FramePool.hpp"
 
 namespace RhIO {
 
@@ -55,12 +57,33 @@ class FrameNode: public BaseNode<FrameNode>
          * Send to watchers the raw frame with 
          * given name with given data of given size.
          * Frame width and height size are also given.
-         * The given data is immediatly copied.
+         * The given data is immediatly copied 
+         * into a pooled buffer.
          */
         void framePush(const std::string& name, 
             size_t width, size_t height,
             unsigned char* data, size_t size,
             int64_t timestamp = getRhIOTime());
+
+        /**
+         * Lease a pooled buffer of given frame name,
+         * width and height for the producer to directly
+         * write the next frame image into its data.
+         * Return nullptr if the frame is not streamed
+         * or if all the pooled buffers are in use.
+         * The buffer must be given back to framePublish().
+         */
+        FrameBuffer* frameLease(const std::string& name, 
+            size_t width, size_t height);
+
+        /**
+         * Hand over the given leased and written buffer
+         * to the publisher with given timestamp.
+         * The buffer is sent without copy and returns
+         * to its pool once sent.
+         */
+        void framePublish(FrameBuffer* buffer,
+            int64_t timestamp = getRhIOTime());
         
         /**
          * Enable or disable (increase or decrease watchers
@@ -93,6 +116,12 @@ class FrameNode: public BaseNode<FrameNode>
          * and textual description
          */
         std::map<std::string, Frame> _frames;
+
+        /**
+         * Pre-allocated buffers pool
+         * for each frame stream
+         */
+        std::map<std::string, std::shared_ptr<FramePool>> _pools;
         
         /**
          * Mutex protecting concurent stream creation
@@ -0,0 +1,215 @@
+#ifndef RHIO_FRAMEPOOL_HPP
+#define RHIO_FRAMEPOOL_HPP
+
+#include <string>
+#include <vector>
+#include <atomic>
+#include <memory>
+#include <cstdint>
+#include "rhio_server/ValueHandle.hpp"
+
+namespace RhIO {
+
+class FramePool;
+
+/**
+ * FrameBuffer
+ *
+ * Pooled frame image buffer leased by
+ * the producer to directly write the frame
+ * into and handed over to the publisher.
+ */
+struct FrameBuffer
+{
+    /**
+     * Owning pool
+     */
+    FramePool* pool;
+
+    /**
+     * Image data (at least size bytes)
+     * and used size
+     */
+    std::vector<unsigned char> data;
+    size_t size;
+
+    /**
+     * Frame width, height
+     * and timestamp
+     */
+    size_t width;
+    size_t height;
+    int64_t timestamp;
+
+    /**
+     * Publisher owned frame chunk
+     * datagrams sent without copy
+     */
+    std::vector<uint8_t> packets;
+
+    /**
+     * Number of references holding the buffer
+     * (producer, publisher or sent datagrams)
+     */
+    std::atomic<size_t> countRefs;
+};
+
+/**
+ * FramePool
+ *
+ * Fixed set of pre-allocated frame buffers
+ * of one frame stream. Lease and release
+ * are lock free. The image data is only
+ * reallocated when the frame size grows.
+ * Published buffers go through a single pending
+ * slot (triple buffering between the producer 
+ * writing buffer, the pending buffer and the 
+ * publisher sending buffer): the producer never 
+ * blocks and overwrites the pending frame while 
+ * the publisher always takes the newest one.
+ */
+class FramePool
+{
+    public:
+
+        /**
+         * Default and maximum number of pooled 
+         * buffers (triple buffering plus one
+         * buffer still held by ZMQ once sent)
+         */
+        static const size_t DefaultCount = 4;
+        static const size_t MaxCount = 64;
+
+        /**
+         * Initialization with the frame stream
+         * absolute name and the number of buffers
+         */
+        FramePool(const std::string& name,
+            size_t count = DefaultCount);
+
+        /**
+         * Return the frame stream absolute name
+         */
+        const std::string& name() const;
+
+        /**
+         * Lease a free buffer holding a frame of given
+         * width and height (3 bytes per pixel) with one
+         * reference. Return nullptr if all buffers are in use.
+         * RT, thread safe, no dynamic allocation
+         * unless the frame size grows.
+         */
+        FrameBuffer* lease(size_t width, size_t height);
+
+        /**
+         * Add given number of references
+         * to given leased buffer
+         */
+        void retain(FrameBuffer* buffer, size_t count);
+
+        /**
+         * Drop one reference to given leased buffer.
+         * The buffer returns to the pool when
+         * its last reference is dropped.
+         * RT, thread safe.
+         */
+        void release(FrameBuffer* buffer);
+
+        /**
+         * Make given leased and written buffer
+         * the pending frame, overwriting and
+         * releasing the previous pending one.
+         * Return true if no frame was pending.
+         * RT, thread safe, wait free.
+         */
+        bool publish(FrameBuffer* buffer);
+
+        /**
+         * Take the pending frame buffer with its
+         * reference. Return nullptr if none.
+         * Wait free.
+         */
+        FrameBuffer* take();
+
+        /**
+         * Release the pending frame 
+         * if any as overwritten
+         */
+        void discard();
+
+        /**
+         * Return the number of free buffers
+         */
+        size_t countFree() const;
+
+        /**
+         * Return the number of published,
+         * taken to be sent and overwritten
+         * (never sent) frames
+         */
+        int64_t countProduced() const;
+        int64_t countSent() const;
+        int64_t countOverwritten() const;
+
+        /**
+         * Create the read only produced, sent and 
+         * overwritten counters values of the frame stream
+         * under the statistics node (see StatsPath) 
+         * of given node and resolve their handles
+         */
+        void bindCounters(ValueNode& node);
+
+        /**
+         * Update the read only counters values 
+         * through the resolved handles (if bound)
+         */
+        void updateCounters();
+
+    private:
+
+        /**
+         * Frame stream absolute name
+         */
+        std::string _name;
+
+        /**
+         * Number of pooled buffers
+         */
+        size_t _count;
+
+        /**
+         * Pre-allocated buffers
+         */
+        std::unique_ptr<FrameBuffer[]> _buffers;
+
+        /**
+         * Bit mask of free buffers
+         */
+        std::atomic<uint64_t> _free;
+
+        /**
+         * Pending newest frame buffer
+         */
+        std::atomic<FrameBuffer*> _pending;
+
+        /**
+         * Published, sent and 
+         * overwritten frames counters
+         */
+        std::atomic<int64_t> _countProduced;
+        std::atomic<int64_t> _countSent;
+        std::atomic<int64_t> _countOverwritten;
+
+        /**
+         * Handles on the counters values
+         * resolved by bindCounters()
+         */
+        ValueHandleInt _handleProduced;
+        ValueHandleInt _handleSent;
+        ValueHandleInt _handleOverwritten;
+};
+
+}
+
+#endif
+
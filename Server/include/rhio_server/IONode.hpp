@@ -9,6 +9,8 @@
 #include "rhio_server/CommandNode.hpp"
 #include "rhio_server/StreamNode.hpp"
 #include "rhio_server/FrameNode.hpp"
+#include "rhio_server/PathIndex.hpp"
+#include "rhio_common/Snapshot.hpp"
 
 namespace RhIO {
 
@@ -104,6 +106,18 @@ class IONode final : public ValueNode,
          * path directory
          */
         void load(const std::string& path);
+
+        /**
+         * Return a copy of all values of the subtree
+         * at given relative node name (this node if empty)
+         * captured atomically with respect to values writes
+         * (including real time and batch writes).
+         * Lock free with respect to writers: the copy is
+         * retried while writes are detected. If writes never
+         * stop, the last best effort copy is returned
+         * flagged as not consistent.
+         */
+        Snapshot snapshot(const std::string& name = "") const;
     
     private:
         
@@ -135,6 +149,13 @@ class IONode final : public ValueNode,
          * modification
          */
         mutable std::mutex _mutex;
+
+        /**
+         * Flat index from absolute path to every Node 
+         * of the tree. Owned by the Root and shared
+         * with all its children.
+         */
+        PathIndex<IONode>* _index;
         
         /**
          * Copy and assignment operator
@@ -153,16 +174,31 @@ class IONode final : public ValueNode,
          * If given name is invalid, throw logic_error exception.
          * unless createBranch is true. Missing Nodes are then
          * created.
+         * Existing branches are found with a single
+         * lookup in the path index.
          */
         IONode* forwardChildren(
             const std::string& name, std::string& newName,
             bool createBranch);
 
+        /**
+         * Allocate a new direct child Node with given name
+         * and register it into the path index.
+         * The node mutex must be locked by the caller.
+         */
+        IONode* newChildNode(const std::string& name);
+
         /**
          * Return true of the current subtree
          * has data to be saved
          */
         bool isNeededSave() const;
+
+        /**
+         * Append to given list this Node 
+         * and recursively all its children
+         */
+        void listSubtree(std::vector<const IONode*>& nodes) const;
 };
 
 }
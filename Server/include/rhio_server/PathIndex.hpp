@@ -0,0 +1,219 @@
+#ifndef RHIO_PATHINDEX_HPP
+#define RHIO_PATHINDEX_HPP
+
+#include <string>
+#include <vector>
+#include <atomic>
+#include <mutex>
+#include <functional>
+
+namespace RhIO {
+
+/**
+ * PathIndex
+ *
+ * Concurrent hash index from a string path
+ * to a pointer. Lookups are lock free (open
+ * addressing with linear probing) and never
+ * block writers. Insertions are serialized
+ * by an internal mutex. Entries are only removed
+ * by clear().
+ * When the table grows, the previous table is retired
+ * and only freed at destruction so that concurrent
+ * readers always access valid memory
+ * (tables double in size so the retired ones
+ * never exceed the current one).
+ */
+template <typename T>
+class PathIndex
+{
+    public:
+
+        /**
+         * Initialization with empty table
+         */
+        PathIndex() :
+            _table(nullptr),
+            _count(0),
+            _entries(),
+            _retired(),
+            _mutex()
+        {
+            _table.store(new Table_t(16));
+        }
+
+        /**
+         * Free current and retired tables
+         * and all entries
+         */
+        ~PathIndex()
+        {
+            delete _table.load();
+            for (Table_t* table : _retired) {
+                delete table;
+            }
+            for (Entry_t* entry : _entries) {
+                delete entry;
+            }
+        }
+
+        /**
+         * Non copyable
+         */
+        PathIndex(const PathIndex&) = delete;
+        PathIndex& operator=(const PathIndex&) = delete;
+
+        /**
+         * Return the pointer associated with
+         * given path or nullptr if not found.
+         * Lock free and thread safe.
+         */
+        T* find(const std::string& path) const
+        {
+            size_t hash = std::hash<std::string>()(path);
+            const Table_t* table = _table.load(std::memory_order_acquire);
+            size_t index = hash & table->mask;
+            while (true) {
+                const Entry_t* entry =
+                    table->slots[index].load(std::memory_order_acquire);
+                if (entry == nullptr) {
+                    return nullptr;
+                }
+                if (entry->hash == hash && entry->path == path) {
+                    return entry->ptr;
+                }
+                index = (index + 1) & table->mask;
+            }
+        }
+
+        /**
+         * Register given pointer with given path.
+         * Do nothing if the path is already known.
+         * Thread safe.
+         */
+        void insert(const std::string& path, T* ptr)
+        {
+            std::lock_guard<std::mutex> lock(_mutex);
+            if (find(path) != nullptr) {
+                return;
+            }
+            //Grow the table to keep load factor below one half
+            Table_t* table = _table.load();
+            if (2*(_count + 1) > table->slots.size()) {
+                Table_t* tableNew = new Table_t(2*table->slots.size());
+                for (Entry_t* entry : _entries) {
+                    place(tableNew, entry);
+                }
+                _table.store(tableNew, std::memory_order_release);
+                _retired.push_back(table);
+                table = tableNew;
+            }
+            //Publish the new entry
+            Entry_t* entry = new Entry_t(
+                path, ptr, std::hash<std::string>()(path));
+            _entries.push_back(entry);
+            place(table, entry);
+            _count++;
+        }
+
+        /**
+         * Remove all entries.
+         * NOT THREAD SAFE with concurrent lookups.
+         */
+        void clear()
+        {
+            std::lock_guard<std::mutex> lock(_mutex);
+            Table_t* table = _table.load();
+            for (auto& slot : table->slots) {
+                slot.store(nullptr);
+            }
+            for (Entry_t* entry : _entries) {
+                delete entry;
+            }
+            _entries.clear();
+            _count = 0;
+        }
+
+        /**
+         * Return the number of registered entries
+         */
+        size_t size() const
+        {
+            std::lock_guard<std::mutex> lock(_mutex);
+            return _count;
+        }
+
+    private:
+
+        /**
+         * Immutable indexed entry
+         */
+        struct Entry_t {
+            Entry_t(const std::string& path_, T* ptr_, size_t hash_) :
+                path(path_),
+                ptr(ptr_),
+                hash(hash_)
+            {
+            }
+            const std::string path;
+            T* const ptr;
+            const size_t hash;
+        };
+
+        /**
+         * Open addressing table with
+         * power of two size
+         */
+        struct Table_t {
+            Table_t(size_t size) :
+                mask(size - 1),
+                slots(size)
+            {
+                for (auto& slot : slots) {
+                    slot.store(nullptr);
+                }
+            }
+            const size_t mask;
+            std::vector<std::atomic<Entry_t*>> slots;
+        };
+
+        /**
+         * Current table read by lookups
+         */
+        std::atomic<Table_t*> _table;
+
+        /**
+         * Number of registered entries
+         */
+        size_t _count;
+
+        /**
+         * All allocated entries and
+         * retired tables container
+         */
+        std::vector<Entry_t*> _entries;
+        std::vector<Table_t*> _retired;
+
+        /**
+         * Mutex serializing writers
+         */
+        mutable std::mutex _mutex;
+
+        /**
+         * Store given entry in the first
+         * free slot of given table
+         */
+        static void place(Table_t* table, Entry_t* entry)
+        {
+            size_t index = entry->hash & table->mask;
+            while (table->slots[index].load() != nullptr) {
+                index = (index + 1) & table->mask;
+            }
+            table->slots[index].store(entry, std::memory_order_release);
+        }
+};
+
+}
+
+#endif
+
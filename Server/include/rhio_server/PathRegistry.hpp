@@ -0,0 +1,46 @@
+#ifndef RHIO_PATHREGISTRY_HPP
+#define RHIO_PATHREGISTRY_HPP
+
+#include <string>
+
+namespace RhIO {
+
+/**
+ * PathRegistry
+ *
+ * Global interning of values absolute path
+ * into compact integer ids. Ids are assigned
+ * at value creation and are never released
+ * (a path keeps its id across RhIO::reset()),
+ * so that streaming and logging hot paths only
+ * carry the id and the path is resolved at
+ * serialization time.
+ */
+class PathRegistry
+{
+    public:
+
+        /**
+         * Return the id associated with
+         * given path (created if not known).
+         * Thread safe but NOT real time.
+         */
+        static size_t intern(const std::string& path);
+
+        /**
+         * Return the path associated with given
+         * id previously returned by intern().
+         * Lock free and thread safe.
+         */
+        static const std::string& path(size_t id);
+
+        /**
+         * Return the number of interned paths
+         */
+        static size_t size();
+};
+
+}
+
+#endif
+
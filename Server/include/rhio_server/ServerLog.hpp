@@ -4,9 +4,11 @@
 #include <deque>
 #include <string>
 #include <list>
+#include <vector>
 #include <mutex>
 #include "RhIO.hpp"
-#include "rhio_common/LockFreeDoubleQueue.hpp"
+#include "rhio_common/LockFreeRingQueue.hpp"
+#include "rhio_common/LockFreeCounters.hpp"
 #include "rhio_common/Logging.hpp"
 
 namespace RhIO {
@@ -24,33 +26,65 @@ class ServerLog
     public:
         
         /**
-         * Initialization 
+         * Default number of values of each type
+         * buffered between two ticks by one writer thread
+         * and number of values pre-allocated per
+         * writer thread (buffers grow by segment
+         * ahead of the logged rate)
          */
-        ServerLog();
+        static const size_t DefaultCapacity = 5000000;
+        static const size_t InitSize = 4096;
+
+        /**
+         * Initialization with the
+         * buffers capacity
+         */
+        ServerLog(size_t capacity = DefaultCapacity);
         
         /**
          * Append to logging buffer value for type
-         * Bool, Int, Float, Str with given absolute
-         * name and timestamp.
+         * Bool, Int, Float, Str with given interned
+         * path id (see PathRegistry) and timestamp.
          * Real time compatible.
          */
         void logBool(
-            const std::string& name, 
+            size_t id, 
             bool val, 
             int64_t timestamp);
         void logInt(
-            const std::string& name, 
+            size_t id, 
             int64_t val, 
             int64_t timestamp);
         void logFloat(
-            const std::string& name, 
+            size_t id, 
             double val, 
             int64_t timestamp);
         void logStr(
-            const std::string& name, 
+            size_t id, 
             const std::string& val, 
             int64_t timestamp);
 
+        /**
+         * Append to logging buffer the given array 
+         * data of given length as one record.
+         * Real time compatible once the buffer 
+         * cells have grown to the array length.
+         */
+        void logFloatArray(
+            size_t id, 
+            const double* data, 
+            size_t size,
+            int64_t timestamp);
+
+        /**
+         * Append to logging buffers all values
+         * of given committed batch.
+         * Values of each type are appended as
+         * one contiguous block.
+         * Real time compatible.
+         */
+        void logBatch(const ValueBatch& batch);
+
         /**
          * Allocate and transfert data from RT buffer 
          * to non-RT containers.
@@ -65,59 +99,75 @@ class ServerLog
          */
         void writeLogsToFile(const std::string& filepath);
 
-    private:
-
         /**
-         * Named value data point to be 
-         * logged in lock free buffer
-         * (the name is not yet replaced by
-         * an id to prevent memory allocation).
+         * Export the logging buffers and per value
+         * dropped samples counters into the tree
+         * under the statistics node (see StatsPath)
          */
-        template <typename T>
-        struct LogNamedValue {
-            //Full absolute name
-            std::string name;
-            //Timestamp in microseconds
-            int64_t timestamp;
-            //Typed value
-            T value;
-        };
+        void updateStats();
+
+    private:
 
         /**
-         * Named and typed value typedef
+         * Lock free per writer thread rings for RT logging
+         * of bool, int, float, str and float array values.
+         * Logged data points directly use the
+         * interned path id so that no name is
+         * copied or looked up until logs writing.
          */
-        typedef LogNamedValue<bool> LogNamedValBool;
-        typedef LogNamedValue<int64_t> LogNamedValInt;
-        typedef LogNamedValue<double> LogNamedValFloat;
-        typedef LogNamedValue<std::string> LogNamedValStr;
-        
+        LockFreeRingQueue<LogValBool> _bufferBool;
+        LockFreeRingQueue<LogValInt> _bufferInt;
+        LockFreeRingQueue<LogValFloat> _bufferFloat;
+        LockFreeRingQueue<LogValStr> _bufferStr;
+        LockFreeRingQueue<LogValFloatArray> _bufferFloatArray;
+
         /**
-         * Lock free double buffer for RT logging
-         * of bool, int, float and str values
+         * Number of samples dropped because
+         * of full buffers indexed by value id
+         * (grown with the value id space 
+         * by the logging thread)
          */
-        LockFreeDoubleQueue<LogNamedValBool> _bufferBool;
-        LockFreeDoubleQueue<LogNamedValInt> _bufferInt;
-        LockFreeDoubleQueue<LogNamedValFloat> _bufferFloat;
-        LockFreeDoubleQueue<LogNamedValStr> _bufferStr;
+        LockFreeCounters _droppedValues;
 
         /**
          * Non real time container for logged values
-         * and names to ids mapping to reduce memory usage
-         * in logs files.
+         * and flags indexed by path id telling
+         * which values have been logged.
          */
-        std::map<std::string, size_t> _mappingBool;
-        std::map<std::string, size_t> _mappingInt;
-        std::map<std::string, size_t> _mappingFloat;
-        std::map<std::string, size_t> _mappingStr;
+        std::vector<bool> _isLoggedBool;
+        std::vector<bool> _isLoggedInt;
+        std::vector<bool> _isLoggedFloat;
+        std::vector<bool> _isLoggedStr;
+        std::vector<bool> _isLoggedFloatArray;
         std::deque<LogValBool> _valuesBool;
         std::deque<LogValInt> _valuesInt;
         std::deque<LogValFloat> _valuesFloat;
         std::deque<LogValStr> _valuesStr;
+        std::deque<LogValFloatArray> _valuesFloatArray;
         
         /**
          * Mutex protecting data during logs writing
          */
         std::mutex _mutex;
+
+        /**
+         * Append the first given count of updates
+         * of given list as one block into given buffer
+         */
+        template <typename T, typename U>
+        void appendBatch(
+            LockFreeRingQueue<LogValue<T>>& buffer,
+            const std::vector<U>& updates,
+            size_t count,
+            int64_t timestamp);
+
+        /**
+         * Build the logged values name to id
+         * mapping from given logged flags
+         */
+        static void buildMapping(
+            const std::vector<bool>& isLogged,
+            std::map<std::string, size_t>& mapping);
 };
 
 }
@@ -2,11 +2,16 @@
 #define RHIO_SERVERPUB_HPP
 
 #include <string>
-#include <list>
-#include <mutex>
+#include <atomic>
 #include <zmq.hpp>
 #include "RhIO.hpp"
+#include "rhio_server/FramePool.hpp"
 #include "rhio_common/LockFreeDoubleQueue.hpp"
+#include "rhio_common/LockFreeRingQueue.hpp"
+#include "rhio_common/LockFreeLatestSlots.hpp"
+#include "rhio_common/LockFreeCounters.hpp"
+#include "rhio_common/DataBuffer.hpp"
+#include "rhio_common/Protocol.hpp"
 
 namespace RhIO {
 
@@ -22,24 +27,65 @@ class ServerPub
         
         /**
          * Initialization with the bind
-         * endpoint string
+         * endpoint string and the maximum payload
+         * size of datagrams packing several samples.
+         * Zero packet size sends one sample per datagram.
          */
-        ServerPub(std::string endpoint = "");
+        ServerPub(std::string endpoint = "", 
+            size_t packetSize = StreamPacketSize);
+
+        /**
+         * Release the wakeup event
+         */
+        ~ServerPub();
 
         /**
          * Append to publish buffer value for type
-         * Bool, Int, Float, Str with given absolute
-         * name and timestamp
-         */
-        void publishBool(const std::string& name, 
-            bool val, int64_t timestamp);
-        void publishInt(const std::string& name, 
-            int64_t val, int64_t timestamp);
-        void publishFloat(const std::string& name, 
-            double val, int64_t timestamp);
-        void publishStr(const std::string& name, 
+         * Bool, Int, Float, Str with given interned
+         * path id (see PathRegistry) and timestamp.
+         * If isLatest is true, the sample replaces the 
+         * one of the same value not sent yet 
+         * (see StreamFilter::latestOnly).
+         */
+        void publishBool(size_t id, 
+            bool val, int64_t timestamp, 
+            bool isLatest = false);
+        void publishInt(size_t id, 
+            int64_t val, int64_t timestamp,
+            bool isLatest = false);
+        void publishFloat(size_t id, 
+            double val, int64_t timestamp,
+            bool isLatest = false);
+        void publishStr(size_t id, 
             const std::string& val, int64_t timestamp);
 
+        /**
+         * Append to publish buffer the given array
+         * data of given length as one record.
+         * No allocation once the buffer cells 
+         * have grown to the array length.
+         */
+        void publishFloatArray(size_t id, 
+            const double* data, size_t size, int64_t timestamp);
+
+        /**
+         * Register the interned path id of a value whose
+         * last sample was suppressed by its streaming
+         * max rate. The value current sample is published
+         * once the rate period is elapsed if no later update
+         * was published (see ValueNode::flushStreamingValue).
+         * Return false if the registration queue is full.
+         */
+        bool publishPending(size_t id);
+
+        /**
+         * Append to publish buffers all streamed
+         * values of given committed batch.
+         * Values of each type are appended as
+         * one contiguous block.
+         */
+        void publishBatch(const ValueBatch& batch);
+
         /**
          * Append to publish buffer stream
          * given absolute name, string and timestamp
@@ -48,15 +94,14 @@ class ServerPub
             const std::string& val, int64_t timestamp);
 
         /**
-         * Append to publish buffer frame
-         * given absolute name, timestamp,
-         * frame data and size.
-         * The data is immediatly copied.
+         * Make the given leased and written frame buffer
+         * the pending frame of its pool (only its pointer
+         * is copied) and append the pool to publish buffer 
+         * if no frame was pending. The newest pending frame
+         * is sent and released to its pool once all 
+         * its chunks are sent.
          */
-        void publishFrame(const std::string& name,
-            size_t width, size_t height,
-            unsigned char* data, size_t size,
-            int64_t timestamp);
+        void publishFrame(FrameBuffer* buffer);
 
         /**
          * Switch values buffer and publish to Client
@@ -64,19 +109,58 @@ class ServerPub
          */
         void sendToClient();
 
+        /**
+         * Enable or disable the wakeup signal sent
+         * by the first writer publishing a sample
+         * since last sendToClient()
+         */
+        void setWakeup(bool isEnabled);
+
+        /**
+         * Wait at most given timeout in microseconds
+         * for a writer wakeup signal (see setWakeup()).
+         * Return true if a sample has been published.
+         */
+        bool waitForSamples(int64_t timeout);
+
+        /**
+         * Return the total number of sent
+         * datagrams and their payload bytes
+         */
+        uint64_t getSentPackets() const;
+        uint64_t getSentBytes() const;
+
+        /**
+         * Export the publish buffers and per value
+         * dropped samples counters into the tree
+         * under the statistics node (see StatsPath)
+         */
+        void updateStats();
+
     private:
 
         /**
          * Structure for typed values 
-         * to publish
+         * to publish (the name is only 
+         * resolved from its id when sent)
          */
         template <typename T>
         struct PubValue {
-            std::string name;
+            size_t id;
             T value;
             int64_t timestamp;
         };
 
+        /**
+         * Structure for named 
+         * stream to publish
+         */
+        struct PubStream {
+            std::string name;
+            std::string value;
+            int64_t timestamp;
+        };
+
         /**
          * Typedef for typed values
          */
@@ -84,6 +168,7 @@ class ServerPub
         typedef PubValue<int64_t> PubValInt;
         typedef PubValue<double> PubValFloat;
         typedef PubValue<std::string> PubValStr;
+        typedef PubValue<std::vector<double>> PubValFloatArray;
         
         /**
          * ZMQ context
@@ -96,42 +181,243 @@ class ServerPub
         zmq::socket_t _socket;
 
         /**
-         * Lock free double buffer for RT publish
-         * of bool, int, float and str values and streams
+         * Lock free per writer thread rings for RT publish
+         * of bool, int, float, str and float array 
+         * values and streams
+         */
+        LockFreeRingQueue<PubValBool> _bufferBool;
+        LockFreeRingQueue<PubValInt> _bufferInt;
+        LockFreeRingQueue<PubValFloat> _bufferFloat;
+        LockFreeRingQueue<PubValStr> _bufferStr;
+        LockFreeRingQueue<PubValFloatArray> _bufferFloatArray;
+        LockFreeRingQueue<PubStream> _bufferStream;
+
+        /**
+         * Lock free latest sample slots indexed
+         * by value id for coalesced bool, int and 
+         * float values. Ids out of slots range and
+         * samples whose slot is being written by another
+         * writer fall back to the full rate buffers.
          */
-        LockFreeDoubleQueue<PubValBool> _bufferBool;
-        LockFreeDoubleQueue<PubValInt> _bufferInt;
-        LockFreeDoubleQueue<PubValFloat> _bufferFloat;
-        LockFreeDoubleQueue<PubValStr> _bufferStr;
-        LockFreeDoubleQueue<PubValStr> _bufferStream;
+        LockFreeLatestSlots<bool> _latestBool;
+        LockFreeLatestSlots<int64_t> _latestInt;
+        LockFreeLatestSlots<double> _latestFloat;
 
         /**
-         * If true, the external writing buffer
-         * is the 1 and the outputing network buffer is the 2.
-         * If false, the external writing buffer 
-         * is the 2 and the outputing network buffer is the 1.
+         * Lock free double buffer of frame
+         * pools with a pending frame
          */
-        bool _isWritingTo1;
+        LockFreeDoubleQueue<FramePool*> _bufferFrame;
 
         /**
-         * First double buffer for frame publishing
+         * Lock free double buffer of registered
+         * value ids with a sample suppressed by the
+         * max rate and list of still pending ids
+         * (only accessed by the publisher thread)
          */
-        std::list<zmq::message_t> _queue1Frame;
+        LockFreeDoubleQueue<size_t> _bufferPending;
+        std::vector<size_t> _pending;
 
         /**
-         * Second double buffer for frame publishing
+         * Number of samples dropped because
+         * of full buffers indexed by value id
+         * (grown with the value id space by the
+         * publisher thread) and number of dropped
+         * text stream samples
          */
-        std::list<zmq::message_t> _queue2Frame;
+        LockFreeCounters _droppedValues;
+        std::atomic<uint64_t> _droppedStream;
 
         /**
-         * Mutex protecting access to frame double buffer
+         * Maximum datagram payload size 
+         * for packed samples
          */
-        std::mutex _mutexQueueFrame;
+        size_t _packetSize;
+
+        /**
+         * Publish the samples suppressed by the 
+         * max rate of registered pending values 
+         * whose rate period is elapsed
+         */
+        void flushPending();
+
+        /**
+         * Datagram being packed. The first
+         * byte is reserved for the batch header.
+         * Used length and number of records.
+         */
+        std::vector<uint8_t> _packetData;
+        size_t _packetLength;
+        size_t _packetCount;
+
+        /**
+         * Header type of the datagram being packed
+         * (MsgStreamBatch or MsgStreamCompact) and 
+         * timestamp of its last compact sample
+         */
+        MsgType _packetHeader;
+        int64_t _packetTimestamp;
+
+        /**
+         * Announced sample type indexed by value id
+         * (zero if not announced), announced ids,
+         * ids to announce before the next compact 
+         * datagram, ids announced during the current 
+         * cycle and repeated at the next one (a lost 
+         * announcement does not wait for the whole
+         * dictionary) and dictionary datagram buffer
+         */
+        std::vector<uint8_t> _dictionaryTypes;
+        std::vector<size_t> _dictionaryIds;
+        std::vector<size_t> _dictionaryPending;
+        std::vector<size_t> _dictionaryRepeat;
+        std::vector<uint8_t> _dictionaryData;
+
+        /**
+         * Steady time in microseconds of 
+         * last whole dictionary announcement
+         */
+        int64_t _dictionaryTime;
+
+        /**
+         * Random session id written in dictionary
+         * and compact datagrams so that clients drop
+         * the dictionary of a restarted server.
+         * Encoded as VarInt with its length.
+         */
+        uint8_t _sessionData[10];
+        size_t _sessionLength;
+
+        /**
+         * Linux eventfd signaled by writers,
+         * wakeup enabled state and true if a 
+         * writer has already signaled since 
+         * last sendToClient()
+         */
+        int _wakeupFd;
+        std::atomic<bool> _isWakeup;
+        std::atomic<bool> _isSignaled;
+
+        /**
+         * Sequence number of last sent frame
+         */
+        uint64_t _frameSeq;
+
+        /**
+         * Total number of sent datagrams 
+         * and payload bytes
+         */
+        uint64_t _sentPackets;
+        uint64_t _sentBytes;
 
         /**
          * Swap double buffer for publishing values
          */
         void swapBuffer();
+
+        /**
+         * Signal the publisher thread if wakeup is 
+         * enabled and not yet signaled since last
+         * sendToClient(). RT, thread safe, at most one
+         * system call per sent batch.
+         */
+        void notifyWriter();
+
+        /**
+         * Return the buffer to write a record of given
+         * maximum size into the datagram being packed 
+         * with given header type. The datagram is sent 
+         * first if the record does not fit in or if its 
+         * header differs. The record is appended by 
+         * packetCommit() with its actual size.
+         */
+        DataBuffer packetReserve(size_t size, MsgType header);
+        void packetCommit(size_t size);
+
+        /**
+         * Reserve and append a record of given 
+         * size into a MsgStreamBatch datagram
+         */
+        DataBuffer packetRecord(size_t size);
+
+        /**
+         * Send the datagram being packed if not empty
+         * (after the pending dictionary entries)
+         */
+        void packetFlush();
+
+        /**
+         * Send given datagram data and size.
+         * If isSession is true, the session id
+         * is inserted after the header type.
+         */
+        void sendPacket(const uint8_t* data, 
+            size_t size, bool isSession = false);
+
+        /**
+         * Send the dictionary entries 
+         * of given value ids
+         */
+        void sendDictionary(const std::vector<size_t>& ids);
+
+        /**
+         * Send given frame buffer split into sequence
+         * numbered chunks fitting in datagrams.
+         * The frame data is copied once into the buffer 
+         * chunk datagrams storage which are sent without
+         * further copy, each holding a buffer reference.
+         */
+        void sendFrame(FrameBuffer* frame);
+
+        /**
+         * Write the compact sample id and timestamp
+         * delta of given value id and sample type and
+         * register the value for announcement if needed
+         */
+        void packCompact(DataBuffer& pub, 
+            size_t id, MsgType type, int64_t timestamp);
+
+        /**
+         * Write the compact sample of given value
+         * id, value and timestamp into the 
+         * datagram being packed for types
+         * Bool, Int, Float, Str and FloatArray
+         */
+        void packBool(size_t id, bool val, int64_t timestamp);
+        void packInt(size_t id, int64_t val, int64_t timestamp);
+        void packFloat(size_t id, double val, int64_t timestamp);
+        void packStr(size_t id, 
+            const std::string& val, int64_t timestamp);
+        void packFloatArray(size_t id, 
+            const std::vector<double>& val, int64_t timestamp);
+
+        /**
+         * Append the streamed updates among the first
+         * given count of given list as one block
+         * into given buffer. Coalesced
+         * updates with id lower than given latest slots
+         * size are skipped (see appendLatest).
+         */
+        template <typename T, typename U>
+        void appendBatch(
+            LockFreeRingQueue<PubValue<T>>& buffer,
+            size_t latestSize,
+            const std::vector<U>& updates,
+            size_t count,
+            int64_t timestamp);
+
+        /**
+         * Write coalesced streamed updates
+         * of given list into given latest slots.
+         * Updates whose slot is being written by 
+         * another writer are appended to given buffer.
+         */
+        template <typename T, typename U>
+        void appendLatest(
+            LockFreeLatestSlots<T>& slots,
+            LockFreeRingQueue<PubValue<T>>& buffer,
+            const std::vector<U>& updates,
+            int64_t timestamp);
 };
 
 }
@@ -55,40 +55,44 @@ class ServerRep
         void listChildren(DataBuffer& buffer);
 
         /**
-         * Implement MsgAskValues Bool, Int, Float and Str
+         * Implement MsgAskValues Bool, Int, Float, Str and FloatArray
          * (MsgListNames)
          */
         void listValuesBool(DataBuffer& buffer);
         void listValuesInt(DataBuffer& buffer);
         void listValuesFloat(DataBuffer& buffer);
         void listValuesStr(DataBuffer& buffer);
+        void listValuesFloatArray(DataBuffer& buffer);
 
         /**
-         * Implement MsgGet for Bool, Int, Float, Str
+         * Implement MsgGet for Bool, Int, Float, Str, FloatArray
          * (MsgVal)
          */
         void getBool(DataBuffer& buffer);
         void getInt(DataBuffer& buffer);
         void getFloat(DataBuffer& buffer);
         void getStr(DataBuffer& buffer);
+        void getFloatArray(DataBuffer& buffer);
 
         /**
-         * Implement MsgSet for Bool, Int, Float, Str
+         * Implement MsgSet for Bool, Int, Float, Str, FloatArray
          * (MsgSetOk)
          */
         void setBool(DataBuffer& buffer);
         void setInt(DataBuffer& buffer);
         void setFloat(DataBuffer& buffer);
         void setStr(DataBuffer& buffer);
+        void setFloatArray(DataBuffer& buffer);
 
         /**
-         * Implement MsgAskMeta for Bool, Int, Float, Str
+         * Implement MsgAskMeta for Bool, Int, Float, Str, FloatArray
          * (MsgValMeta)
          */
         void valMetaBool(DataBuffer& buffer);
         void valMetaInt(DataBuffer& buffer);
         void valMetaFloat(DataBuffer& buffer);
         void valMetaStr(DataBuffer& buffer);
+        void valMetaFloatArray(DataBuffer& buffer);
 
         /**
          * Implement MsgEnableStreamingValue, MsgDisableStreamingValue
@@ -98,6 +102,12 @@ class ServerRep
         void enableStreamingValue(DataBuffer& buffer);
         void disableStreamingValue(DataBuffer& buffer);
         void checkStreamingValue(DataBuffer& buffer);
+
+        /**
+         * Implement MsgSetStreamFilter
+         * (MsgStreamingOK)
+         */
+        void setStreamFilter(DataBuffer& buffer);
         
         /**
          * Implement MsgEnableStreamingStream, MsgDisableStreamingStream
@@ -142,6 +152,11 @@ class ServerRep
          * Implement MsgAskCall (MsgCallResult)
          */
         void callResult(DataBuffer& buffer);
+        
+        /**
+         * Implement MsgAskCallBinary (MsgCallResultBinary)
+         */
+        void callBinaryResult(DataBuffer& buffer);
 
         /**
          * Implement MsgAskStreams (MsgListNames)
@@ -165,6 +180,12 @@ class ServerRep
          */
         void valMetaFrame(DataBuffer& buffer);
 
+        /**
+         * Implement MsgAskSnapshot
+         * (MsgSnapshot)
+         */
+        void snapshot(DataBuffer& buffer);
+
         /**
          * Implement MsgError with given error message
          */
@@ -0,0 +1,63 @@
+#ifndef RHIO_STATS_HPP
+#define RHIO_STATS_HPP
+
+#include <string>
+#include <cstdint>
+#include "rhio_common/LockFreeCounters.hpp"
+
+namespace RhIO {
+
+/**
+ * Tree path of the node holding 
+ * RhIO internal statistics values
+ * and their update period in microseconds
+ */
+extern const std::string StatsPath;
+extern const int64_t StatsPeriod;
+
+/**
+ * Set the statistics Int value of given name 
+ * relative to StatsPath with given comment.
+ * The value is created read only if needed
+ * (refused to user setters and not logged).
+ * Not thread safe with RhIO::reset().
+ */
+void statsSetInt(const std::string& name, 
+    int64_t val, const std::string& comment);
+
+/**
+ * Export the counters of given lock free
+ * queue (double or ring) under given name
+ */
+template <typename Queue>
+void statsQueue(const std::string& name, 
+    const Queue& queue)
+{
+    statsSetInt(name + "/appended", 
+        queue.getCountAppended(),
+        "Number of values appended to the buffer");
+    statsSetInt(name + "/dropped", 
+        queue.getCountDropped(),
+        "Number of values dropped because the buffer was full");
+    statsSetInt(name + "/highWater", 
+        queue.getHighWater(),
+        "Maximum number of values held by the buffer");
+    statsSetInt(name + "/capacity", 
+        queue.getCapacity(),
+        "Buffer capacity");
+}
+
+/**
+ * Export the non zero counters of given
+ * per value id counters under the path of 
+ * each value (relative to StatsPath/values) 
+ * with given name
+ */
+void statsValues(const std::string& name, 
+    const LockFreeCounters& counters,
+    const std::string& comment);
+
+}
+
+#endif
+
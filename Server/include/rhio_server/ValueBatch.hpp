@@ -0,0 +1,245 @@
+#ifndef RHIO_VALUEBATCH_HPP
+#define RHIO_VALUEBATCH_HPP
+
+#include <string>
+#include <vector>
+#include "rhio_common/Time.hpp"
+#include "rhio_common/Value.hpp"
+#include "rhio_server/ValueNode.hpp"
+#include "rhio_server/ValueHandle.hpp"
+
+namespace RhIO {
+
+/**
+ * ValueBatch
+ *
+ * Transaction of value updates relative to
+ * a node. Updates are only recorded by the set
+ * methods and are all applied at once by commit()
+ * with a single shared timestamp. Updates are grouped
+ * by owning node when recorded so that the mutex of
+ * each node is taken only once during the commit
+ * (only one lock if all values belong to the same node)
+ * and the commit is linear in the number of updates.
+ * FloatArray updates are copied into the batch
+ * (storage is kept for reuse) and are recorded
+ * by name only since no FloatArray handle exists.
+ * Streaming and logging records of each value type
+ * are appended as one contiguous block into
+ * ServerPub and ServerLog so that the
+ * sample set is kept coherent.
+ * A batch can be reused across control cycles.
+ * Recorded but not committed updates are discarded.
+ * NOT THREAD SAFE (a batch belongs to one thread).
+ */
+class ValueBatch
+{
+    public:
+
+        /**
+         * Initialization with the node
+         * relative to which names are given
+         */
+        ValueBatch(ValueNode& node);
+
+        /**
+         * Record an update for given relative name
+         * (sub child forward is supported) for each type.
+         * Throw logic_error exception if asked values name
+         * does not exist or if the FloatArray length does
+         * not match the value length
+         */
+        void setBool(const std::string& name, bool val);
+        void setInt(const std::string& name, int64_t val);
+        void setFloat(const std::string& name, double val);
+        void setStr(const std::string& name, const std::string& val);
+        void setFloatArray(const std::string& name,
+            const std::vector<double>& val);
+
+        /**
+         * Record an update for given pre resolved
+         * value handle for each type (no lookup).
+         * Throw logic_error exception if the handle
+         * is uninitialized.
+         */
+        void setBool(const ValueHandleBool& handle, bool val);
+        void setInt(const ValueHandleInt& handle, int64_t val);
+        void setFloat(const ValueHandleFloat& handle, double val);
+        void setStr(const ValueHandleStr& handle, const std::string& val);
+
+        /**
+         * Return the number of recorded updates
+         */
+        size_t size() const;
+
+        /**
+         * Discard all recorded updates
+         * (allocated memory is kept for reuse)
+         */
+        void clear();
+
+        /**
+         * Apply all recorded updates with the
+         * given shared timestamp, with bounds clamping
+         * and callbacks call (if noCallblack is false),
+         * stream and log them and clear the batch.
+         * Updates are applied node by node, in
+         * recording order within each node 
+         * and value type.
+         * If a callback throws, its update and the 
+         * updates applied before it are still 
+         * streamed and logged, 
+         * the batch is cleared and the exception
+         * is forwarded.
+         */
+        void commit(
+            bool noCallblack = false,
+            int64_t timestamp = getRhIOTime());
+
+    private:
+
+        /**
+         * Recorded update of a typed value
+         */
+        template <typename V, typename T>
+        struct Update {
+            //Updated value structure
+            V* ptrValue;
+            //Assigned value (clamped after commit)
+            T value;
+            //True if the value was
+            //streamed at commit
+            bool isStreamed;
+            //True once the update
+            //is applied at commit
+            bool isApplied;
+        };
+
+        /**
+         * Typedef for typed updates
+         */
+        typedef Update<ValueHotBool, bool> UpdateBool;
+        typedef Update<ValueHotInt, int64_t> UpdateInt;
+        typedef Update<ValueHotFloat, double> UpdateFloat;
+        typedef Update<ValueHotStr, std::string> UpdateStr;
+        typedef Update<ValueHotFloatArray, std::vector<double>> UpdateFloatArray;
+
+        /**
+         * Node relative to which names are given
+         */
+        ValueNode* _node;
+
+        /**
+         * Indexes in typed update lists
+         * of the updates of one owning node
+         */
+        struct NodeUpdates {
+            ValueNode* node;
+            std::vector<size_t> indexesBool;
+            std::vector<size_t> indexesInt;
+            std::vector<size_t> indexesFloat;
+            std::vector<size_t> indexesStr;
+            std::vector<size_t> indexesFloatArray;
+        };
+
+        /**
+         * Distinct nodes owning updated values
+         * (only the first _countNodes are used, others
+         * are kept for reuse) and open addressing hash
+         * table of node index plus one (zero if empty)
+         */
+        std::vector<NodeUpdates> _nodes;
+        size_t _countNodes;
+        std::vector<size_t> _nodesTable;
+
+        /**
+         * Recorded updates for each type
+         */
+        std::vector<UpdateBool> _updatesBool;
+        std::vector<UpdateInt> _updatesInt;
+        std::vector<UpdateFloat> _updatesFloat;
+        std::vector<UpdateStr> _updatesStr;
+        std::vector<UpdateFloatArray> _updatesFloatArray;
+
+        /**
+         * Number of used FloatArray updates
+         * (others are kept to reuse their storage)
+         */
+        size_t _countFloatArray;
+
+        /**
+         * Shared timestamp of
+         * last commit
+         */
+        int64_t _timestamp;
+
+        /**
+         * Scoped write on all nodes owning updated
+         * values so that snapshots see all or none
+         * updates. Writes are ended on scope exit
+         * even if a callback throws.
+         */
+        class CommitGuard
+        {
+            public:
+                inline CommitGuard(ValueBatch& batch) :
+                    _batch(batch)
+                {
+                    for (size_t i=0;i<_batch._countNodes;i++) {
+                        _batch._nodes[i].node->beginWrite();
+                    }
+                }
+                inline ~CommitGuard()
+                {
+                    for (size_t i=0;i<_batch._countNodes;i++) {
+                        _batch._nodes[i].node->endWrite();
+                    }
+                }
+                CommitGuard(const CommitGuard&) = delete;
+                CommitGuard& operator=(const CommitGuard&) = delete;
+            private:
+                ValueBatch& _batch;
+        };
+
+        /**
+         * Apply all recorded updates
+         * (see commit())
+         */
+        void applyUpdates(bool noCallblack, int64_t timestamp);
+
+        /**
+         * Remove the updates not applied
+         * by an interrupted commit
+         */
+        void removeNotApplied();
+
+        /**
+         * Stream and log the 
+         * applied updates
+         */
+        void publishUpdates();
+
+        /**
+         * Return the updates of given node,
+         * registering it on its first update
+         */
+        NodeUpdates& addNode(ValueNode* node);
+
+        /**
+         * Return the hash table slot of given node
+         * (or the empty slot where to insert it)
+         */
+        size_t findNode(ValueNode* node) const;
+
+        /**
+         * Allow streaming and logging
+         * servers to read committed updates
+         */
+        friend class ServerPub;
+        friend class ServerLog;
+};
+
+}
+
+#endif
+
@@ -0,0 +1,202 @@
+#ifndef RHIO_VALUEHANDLE_HPP
+#define RHIO_VALUEHANDLE_HPP
+
+#include <string>
+#include <stdexcept>
+#include "rhio_common/Time.hpp"
+#include "rhio_common/Value.hpp"
+#include "rhio_server/ValueNode.hpp"
+#include "rhio_server/PathRegistry.hpp"
+
+namespace RhIO {
+
+/**
+ * ValueHandleType
+ *
+ * Map a raw value type to
+ * its RhIO value structure
+ */
+template <typename T>
+struct ValueHandleType;
+template <>
+struct ValueHandleType<bool>
+{
+    typedef ValueHotBool Type;
+};
+template <>
+struct ValueHandleType<int64_t>
+{
+    typedef ValueHotInt Type;
+};
+template <>
+struct ValueHandleType<double>
+{
+    typedef ValueHotFloat Type;
+};
+template <>
+struct ValueHandleType<std::string>
+{
+    typedef ValueHotStr Type;
+};
+
+/**
+ * ValueHandle
+ *
+ * Typed handle on an existing value resolved
+ * once at construction. Get and set do not perform
+ * any string lookup or tree traversal but keep
+ * the same bounds clamping, callback, streaming
+ * and logging behaviour than name based setters.
+ * The handle is valid until RhIO::reset() is called.
+ */
+template <typename T>
+class ValueHandle
+{
+    public:
+
+        /**
+         * Default uninitialized
+         */
+        ValueHandle() :
+            _node(nullptr),
+            _ptrValue(nullptr)
+        {
+        }
+
+        /**
+         * Initialize with a RhIO node and the
+         * relative name of an existing value
+         * (sub child forward is supported)
+         */
+        ValueHandle(
+            ValueNode& node,
+            const std::string& name) :
+            _node(nullptr),
+            _ptrValue(nullptr)
+        {
+            node.handleResolve(name, _node, _ptrValue);
+        }
+
+        /**
+         * Bind the handle to given RhIO node and
+         * given relative name of existing value.
+         * Only if the handle is still uninitialized.
+         */
+        void bind(
+            ValueNode& node,
+            const std::string& name)
+        {
+            if (_node != nullptr || _ptrValue != nullptr) {
+                throw std::logic_error(
+                    "RhIO::ValueHandle::bind: "
+                    "Handle already assigned");
+            }
+            node.handleResolve(name, _node, _ptrValue);
+        }
+
+        /**
+         * Return true if the handle
+         * is bound to a value
+         */
+        bool isBound() const
+        {
+            return _ptrValue != nullptr;
+        }
+
+        /**
+         * Return the absolute path
+         * of the bound value
+         */
+        const std::string& path() const
+        {
+            if (_ptrValue == nullptr) {
+                throw std::logic_error(
+                    "RhIO::ValueHandle::path: uninitialized");
+            }
+            return PathRegistry::path(_ptrValue->id);
+        }
+
+        /**
+         * Return the value
+         */
+        T get() const
+        {
+            if (_node == nullptr || _ptrValue == nullptr) {
+                throw std::logic_error(
+                    "RhIO::ValueHandle::get: uninitialized");
+            }
+            return _node->handleGet(*_ptrValue);
+        }
+        operator T() const
+        {
+            return get();
+        }
+
+        /**
+         * Set the value with optional timestamp information.
+         * Callback is not called if noCallblack is true.
+         */
+        void set(
+            const T& val,
+            bool noCallblack = false,
+            int64_t timestamp = getRhIOTime())
+        {
+            if (_node == nullptr || _ptrValue == nullptr) {
+                throw std::logic_error(
+                    "RhIO::ValueHandle::set: uninitialized");
+            }
+            _node->handleSet(*_ptrValue, val, noCallblack, timestamp);
+        }
+        void operator=(const T& val)
+        {
+            set(val);
+        }
+
+        /**
+         * Set the read only value (see ValueBase)
+         * with optional timestamp information.
+         * Reserved to RhIO internal values (statistics),
+         * only Int values are supported.
+         * No bounds, no callback, streamed but never logged.
+         * Throw logic_error exception if the value 
+         * is not read only.
+         */
+        void setReadOnly(
+            const T& val,
+            int64_t timestamp = getRhIOTime())
+        {
+            if (_node == nullptr || _ptrValue == nullptr) {
+                throw std::logic_error(
+                    "RhIO::ValueHandle::setReadOnly: uninitialized");
+            }
+            _node->handleSetReadOnly(*_ptrValue, val, timestamp);
+        }
+
+    private:
+
+        /**
+         * Allow batch to record
+         * pre resolved updates
+         */
+        friend class ValueBatch;
+
+        /**
+         * Pointer towards the node owning the value
+         * and the value element stored in its map container.
+         */
+        ValueNode* _node;
+        typename ValueHandleType<T>::Type* _ptrValue;
+};
+
+/**
+ * Typedef for each value type
+ */
+typedef ValueHandle<bool> ValueHandleBool;
+typedef ValueHandle<int64_t> ValueHandleInt;
+typedef ValueHandle<double> ValueHandleFloat;
+typedef ValueHandle<std::string> ValueHandleStr;
+
+}
+
+#endif
+
@@ -7,13 +7,21 @@
 #include <functional>
 #include <memory>
 #include <mutex>
+#include <atomic>
 
 #include "rhio_common/Time.hpp"
 #include "rhio_common/Value.hpp"
 #include "rhio_server/BaseNode.hpp"
+#include "rhio_server/PathIndex.hpp"
+#include "rhio_server/ValueTable.hpp"
 
 namespace RhIO {
 
+/**
+ * Forward declaration
+ */
+class ValueBatch;
+
 /**
  * ValueNode
  *
@@ -44,13 +52,15 @@ class ValueNode : public BaseNode<ValueNode>
          * Values getters for each type
          * associated with given relative name 
          * from this Node
+         * Lock free, readers never block writers.
          * Throw logic_error exception if asked values name
          * does not exist
          */
         bool getBool(const std::string& name) const;
         int64_t getInt(const std::string& name) const;
         double getFloat(const std::string& name) const;
-        const std::string& getStr(const std::string& name) const;
+        std::string getStr(const std::string& name) const;
+        std::vector<double> getFloatArray(const std::string& name) const;
 
         /**
          * Real time lock free version of values 
@@ -59,10 +69,22 @@ class ValueNode : public BaseNode<ValueNode>
          * (no sub child forward) is supported.
          * No concurrent creation of new values on 
          * the same child node is also assumed.
+         * Str values are read from an RCU buffer 
+         * (see LockFreeStr) without any lock. The non 
+         * allocating Str version assigns given string
+         * (no allocation once its capacity has grown).
+         * FloatArray values are read through a sequence
+         * lock (see LockFreeFloatArray) and copied into
+         * given buffer of the value length.
          */
         bool getRTBool(const std::string& name) const;
         int64_t getRTInt(const std::string& name) const;
         double getRTFloat(const std::string& name) const;
+        std::string getRTStr(const std::string& name) const;
+        void getRTStr(const std::string& name, 
+            std::string& val) const;
+        void getRTFloatArray(const std::string& name, 
+            double* data) const;
 
         /**
          * Values setters for each type
@@ -87,6 +109,10 @@ class ValueNode : public BaseNode<ValueNode>
         void setStr(const std::string& name, const std::string& val,
             bool noCallblack = false,
             int64_t timestamp = getRhIOTime());
+        void setFloatArray(const std::string& name, 
+            const std::vector<double>& val,
+            bool noCallblack = false,
+            int64_t timestamp = getRhIOTime());
 
         /**
          * Real time lock free version of values 
@@ -96,6 +122,13 @@ class ValueNode : public BaseNode<ValueNode>
          * Callback call is not supported.
          * No concurrent creation of new values on 
          * the same child node is also assumed.
+         * Str values are swapped into a pooled RCU buffer
+         * and the old one is never freed by the caller.
+         * The Str setter allocates if the string exceeds
+         * the pooled buffers capacity and yields while all
+         * pooled buffers are being read (see LockFreeStr).
+         * FloatArray values are copied from given buffer
+         * of the value length without allocation.
          */
         void setRTBool(const std::string& name, bool val,
             int64_t timestamp = getRhIOTime());
@@ -103,6 +136,21 @@ class ValueNode : public BaseNode<ValueNode>
             int64_t timestamp = getRhIOTime());
         void setRTFloat(const std::string& name, double val,
             int64_t timestamp = getRhIOTime());
+        void setRTStr(const std::string& name, const std::string& val,
+            int64_t timestamp = getRhIOTime());
+        void setRTFloatArray(const std::string& name, const double* data,
+            int64_t timestamp = getRhIOTime());
+
+        /**
+         * Set the read only Int value (see ValueBase)
+         * associated with given relative name.
+         * Reserved to RhIO internal values (statistics).
+         * No bounds, no callback, streamed but never logged.
+         * Throw logic_error exception if asked values name
+         * does not exist or is not read only.
+         */
+        void setReadOnlyInt(const std::string& name, int64_t val,
+            int64_t timestamp = getRhIOTime());
 
         /**
          * Real time lock free and atomically add or subtract 
@@ -132,6 +180,14 @@ class ValueNode : public BaseNode<ValueNode>
         bool toggleRTBool(const std::string& name,
             int64_t timestamp = getRhIOTime());
 
+        /**
+         * Return a new empty batch of value updates
+         * relative to this node. All updates recorded
+         * in the batch are applied at once on commit
+         * with a single shared timestamp (see ValueBatch).
+         */
+        ValueBatch batch();
+
         /**
          * Declare a new value with given relative name for each type.
          * Subtree Node is created if relative branch path does not exist.
@@ -147,12 +203,24 @@ class ValueNode : public BaseNode<ValueNode>
         std::unique_ptr<ValueBuilderStr> newStr(
             const std::string& name, int64_t timestamp = getRhIOTime());
 
+        /**
+         * Declare a new fixed length array of float 
+         * with given relative name and length (zero initialized).
+         * The whole array is set, streamed and logged
+         * as one record. Optional bounds and default value
+         * must have the same length.
+         */
+        std::unique_ptr<ValueBuilderFloatArray> newFloatArray(
+            const std::string& name, size_t size, 
+            int64_t timestamp = getRhIOTime());
+
         /**
          * Set a callback function that will be called
          * when the value is updated. The given function
          * will have the new value as argument.
          * CALLBACK FUNCTION MUST NOT CALL ANY 
-         * OTHER RHIO FUNCTION (DEADLOCK).
+         * OTHER RHIO FUNCTION (DEADLOCK)
+         * unless callbacks are deferred (see setCallbackMode()).
          */
         void setCallbackBool(const std::string& name, 
             std::function<void(bool)> func);
@@ -162,6 +230,8 @@ class ValueNode : public BaseNode<ValueNode>
             std::function<void(double)> func);
         void setCallbackStr(const std::string& name, 
             std::function<void(std::string)> func);
+        void setCallbackFloatArray(const std::string& name, 
+            std::function<void(std::vector<double>)> func);
 
         /**
          * Values structure getters for each type
@@ -169,12 +239,15 @@ class ValueNode : public BaseNode<ValueNode>
          * from this Node
          * Throw logic_error exception if asked values name
          * does not exist
+         * Return a copy of the value hot state and metadata.
          * READ VALUE IS NOT THREAD SAFE (use only for meta information)
          */
-        const ValueBool& getValueBool(const std::string& name) const;
-        const ValueInt& getValueInt(const std::string& name) const;
-        const ValueFloat& getValueFloat(const std::string& name) const;
-        const ValueStr& getValueStr(const std::string& name) const;
+        ValueBool getValueBool(const std::string& name) const;
+        ValueInt getValueInt(const std::string& name) const;
+        ValueFloat getValueFloat(const std::string& name) const;
+        ValueStr getValueStr(const std::string& name) const;
+        ValueFloatArray getValueFloatArray(
+            const std::string& name) const;
 
         /**
          * Enable or disable (increase or decrease stream watchers) 
@@ -186,6 +259,23 @@ class ValueNode : public BaseNode<ValueNode>
         void disableStreamingValue(const std::string& name);
         void checkStreamingValue(const std::string& name);
 
+        /**
+         * Publish the current sample of given value name
+         * if its last update was suppressed by the streaming
+         * max rate only and the rate period is elapsed at
+         * given time. Return false if the sample is still
+         * pending. Called by the streaming server.
+         */
+        bool flushStreamingValue(const std::string& name, 
+            int64_t timestamp);
+
+        /**
+         * Set the streaming filter policy
+         * of given value name
+         */
+        void setStreamFilter(const std::string& name, 
+            const StreamFilter& filter);
+
         /**
          * Return the relative name list of all registered
          * values for each type
@@ -194,6 +284,7 @@ class ValueNode : public BaseNode<ValueNode>
         std::vector<std::string> listValuesInt() const;
         std::vector<std::string> listValuesFloat() const;
         std::vector<std::string> listValuesStr() const;
+        std::vector<std::string> listValuesFloatArray() const;
 
     protected:
 
@@ -213,20 +304,98 @@ class ValueNode : public BaseNode<ValueNode>
          */
         void loadValues(const std::string& path);
 
+        /**
+         * Append to given lists the pointers towards
+         * all values structure of this node for each type.
+         * Thread safe.
+         */
+        void listValuesPtr(
+            std::vector<const ValueHotBool*>& listBool,
+            std::vector<const ValueHotInt*>& listInt,
+            std::vector<const ValueHotFloat*>& listFloat,
+            std::vector<const ValueHotStr*>& listStr,
+            std::vector<const ValueHotFloatArray*>& listFloatArray) const;
+
+        /**
+         * Return the number of started and finished
+         * values writes on this node. No write is in 
+         * progress if both are equal and no write
+         * occurred between two equal reads of 
+         * the started counter.
+         */
+        uint64_t countWritesBegin() const;
+        uint64_t countWritesEnd() const;
+
     private:
 
         /**
-         * Contained values map for each types
+         * Contained values table for each types
+         * (cache line aligned contiguous storage)
          */
-        std::map<std::string, ValueBool> _valuesBool;
-        std::map<std::string, ValueInt> _valuesInt;
-        std::map<std::string, ValueFloat> _valuesFloat;
-        std::map<std::string, ValueStr> _valuesStr;
+        ValueTable<ValueHotBool> _valuesBool;
+        ValueTable<ValueHotInt> _valuesInt;
+        ValueTable<ValueHotFloat> _valuesFloat;
+        ValueTable<ValueHotStr> _valuesStr;
+        ValueTable<ValueHotFloatArray> _valuesFloatArray;
+
+        /**
+         * Lock free lookup index from value name to
+         * value structure stored in the tables for each type.
+         * Used by readers to never take the node mutex.
+         */
+        PathIndex<ValueHotBool> _indexBool;
+        PathIndex<ValueHotInt> _indexInt;
+        PathIndex<ValueHotFloat> _indexFloat;
+        PathIndex<ValueHotStr> _indexStr;
+        PathIndex<ValueHotFloatArray> _indexFloatArray;
 
         /**
          * Mutex protecting concurrent values creation
          */
         mutable std::mutex _mutex;
+
+        /**
+         * Counters of started and finished
+         * values writes (see snapshot)
+         */
+        std::atomic<uint64_t> _writesBegin{0};
+        std::atomic<uint64_t> _writesEnd{0};
+
+        /**
+         * Mark the start and the end
+         * of a value write on this node
+         */
+        inline void beginWrite()
+        {
+            _writesBegin.fetch_add(1);
+        }
+        inline void endWrite()
+        {
+            _writesEnd.fetch_add(1);
+        }
+
+        /**
+         * Scoped value write on given node.
+         * The write is ended on scope exit
+         * even if an exception is thrown.
+         */
+        class WriteGuard
+        {
+            public:
+                inline WriteGuard(ValueNode& node) :
+                    _node(node)
+                {
+                    _node.beginWrite();
+                }
+                inline ~WriteGuard()
+                {
+                    _node.endWrite();
+                }
+                WriteGuard(const WriteGuard&) = delete;
+                WriteGuard& operator=(const WriteGuard&) = delete;
+            private:
+                ValueNode& _node;
+        };
         
         /**
          * Direct access to values structure for each type
@@ -236,24 +405,179 @@ class ValueNode : public BaseNode<ValueNode>
          * does not exist
          * READ VALUE IS NOT THREAD SAFE (use only for meta information)
          */
-        ValueBool& accessValueBool(const std::string& name);
-        ValueInt& accessValueInt(const std::string& name);
-        ValueFloat& accessValueFloat(const std::string& name);
-        ValueStr& accessValueStr(const std::string& name);
+        ValueHotBool& accessValueBool(const std::string& name);
+        ValueHotInt& accessValueInt(const std::string& name);
+        ValueHotFloat& accessValueFloat(const std::string& name);
+        ValueHotStr& accessValueStr(const std::string& name);
+        ValueHotFloatArray& accessValueFloatArray(const std::string& name);
 
         /**
          * Assign a value to the given structure
          * assuming real time assignment (callback not called)
          */
         void assignRTBool(
-            ValueBool& valueStruct,
+            ValueHotBool& valueStruct,
             double val, int64_t timestamp);
         void assignRTInt(
-            ValueInt& valueStruct,
+            ValueHotInt& valueStruct,
             double val, int64_t timestamp);
         void assignRTFloat(
-            ValueFloat& valueStruct,
+            ValueHotFloat& valueStruct,
+            double val, int64_t timestamp);
+        void assignRTStr(
+            ValueHotStr& valueStruct,
+            const std::string& val, int64_t timestamp);
+        void assignRTFloatArray(
+            ValueHotFloatArray& valueStruct,
+            const double* data, int64_t timestamp);
+
+        /**
+         * Throw logic_error exception if given
+         * value is read only (see ValueBase)
+         */
+        static void checkWritable(const ValueBase& valueStruct);
+
+        /**
+         * Return true if given value structure has 
+         * stream watchers and given new value is accepted 
+         * by its streaming filter (the filter state is
+         * then updated with given value). Lock free.
+         */
+        static bool isStreamed(ValueHotBool& valueStruct, 
+            double val, int64_t timestamp);
+        static bool isStreamed(ValueHotInt& valueStruct, 
             double val, int64_t timestamp);
+        static bool isStreamed(ValueHotFloat& valueStruct, 
+            double val, int64_t timestamp);
+        static bool isStreamed(ValueHotStr& valueStruct, 
+            const std::string& val, int64_t timestamp);
+        static bool isStreamed(ValueHotFloatArray& valueStruct, 
+            const double* data, int64_t timestamp);
+
+        /**
+         * Return given array data clamped to the value
+         * bounds (into a per thread buffer) or given data
+         * itself if the value has no bounds
+         */
+        static const double* boundFloatArray(
+            const ValueHotFloatArray& valueStruct, const double* data);
+
+        /**
+         * Update the given structure with bounds clamping 
+         * and callback call but without streaming and logging.
+         * Return the clamped assigned value.
+         * The node mutex must be locked by the caller.
+         */
+        bool updateBool(
+            ValueHotBool& valueStruct, bool val,
+            bool noCallblack, int64_t timestamp);
+        int64_t updateInt(
+            ValueHotInt& valueStruct, int64_t val,
+            bool noCallblack, int64_t timestamp);
+        double updateFloat(
+            ValueHotFloat& valueStruct, double val,
+            bool noCallblack, int64_t timestamp);
+        const std::string& updateStr(
+            ValueHotStr& valueStruct, const std::string& val,
+            bool noCallblack, int64_t timestamp);
+        const double* updateFloatArray(
+            ValueHotFloatArray& valueStruct, const double* data,
+            bool noCallblack, int64_t timestamp);
+
+        /**
+         * Call or defer (see setCallbackMode()) the
+         * update callback of the given structure, if
+         * any, with given assigned value.
+         * The node mutex must be locked by the caller.
+         */
+        void callbackBool(
+            ValueHotBool& valueStruct, bool val);
+        void callbackInt(
+            ValueHotInt& valueStruct, int64_t val);
+        void callbackFloat(
+            ValueHotFloat& valueStruct, double val);
+        void callbackStr(
+            ValueHotStr& valueStruct, const std::string& val);
+        void callbackFloatArray(
+            ValueHotFloatArray& valueStruct, const double* data);
+
+        /**
+         * Assign a value to the given structure with
+         * bounds clamping, callback call, streaming and logging.
+         * The node mutex must be locked by the caller.
+         */
+        void assignBool(
+            ValueHotBool& valueStruct, bool val,
+            bool noCallblack, int64_t timestamp);
+        void assignInt(
+            ValueHotInt& valueStruct, int64_t val,
+            bool noCallblack, int64_t timestamp);
+        void assignFloat(
+            ValueHotFloat& valueStruct, double val,
+            bool noCallblack, int64_t timestamp);
+        void assignStr(
+            ValueHotStr& valueStruct, const std::string& val,
+            bool noCallblack, int64_t timestamp);
+        void assignFloatArray(
+            ValueHotFloatArray& valueStruct, const double* data,
+            bool noCallblack, int64_t timestamp);
+
+        /**
+         * Assign a value to the given read only
+         * Int structure without bounds nor callback, 
+         * streamed but never logged.
+         * The node mutex must be locked by the caller.
+         */
+        void assignReadOnlyInt(
+            ValueHotInt& valueStruct, int64_t val, int64_t timestamp);
+
+        /**
+         * Resolve given relative name to the node
+         * owning the value and to its value structure.
+         * Throw logic_error exception if asked values name
+         * does not exist
+         */
+        void handleResolve(const std::string& name,
+            ValueNode*& node, ValueHotBool*& ptrValue);
+        void handleResolve(const std::string& name,
+            ValueNode*& node, ValueHotInt*& ptrValue);
+        void handleResolve(const std::string& name,
+            ValueNode*& node, ValueHotFloat*& ptrValue);
+        void handleResolve(const std::string& name,
+            ValueNode*& node, ValueHotStr*& ptrValue);
+        void handleResolve(const std::string& name,
+            ValueNode*& node, ValueHotFloatArray*& ptrValue);
+
+        /**
+         * Read the value of a structure owned 
+         * by this node for each type
+         */
+        bool handleGet(const ValueHotBool& valueStruct) const;
+        int64_t handleGet(const ValueHotInt& valueStruct) const;
+        double handleGet(const ValueHotFloat& valueStruct) const;
+        std::string handleGet(const ValueHotStr& valueStruct) const;
+
+        /**
+         * Update the value of a structure owned
+         * by this node with the same semantic 
+         * than name based setters
+         */
+        void handleSet(ValueHotBool& valueStruct, bool val,
+            bool noCallblack, int64_t timestamp);
+        void handleSet(ValueHotInt& valueStruct, int64_t val,
+            bool noCallblack, int64_t timestamp);
+        void handleSet(ValueHotFloat& valueStruct, double val,
+            bool noCallblack, int64_t timestamp);
+        void handleSet(ValueHotStr& valueStruct, const std::string& val,
+            bool noCallblack, int64_t timestamp);
+
+        /**
+         * Update the read only Int value of a structure
+         * owned by this node with the same semantic
+         * than setReadOnlyInt()
+         */
+        void handleSetReadOnly(ValueHotInt& valueStruct, int64_t val,
+            int64_t timestamp);
 
         /**
          * Allow wrapper classes to access 
@@ -262,6 +586,11 @@ class ValueNode : public BaseNode<ValueNode>
         friend class WrapperBool;
         friend class WrapperInt;
         friend class WrapperFloat;
+        friend class WrapperFloatArray;
+        template <typename T>
+        friend class ValueHandle;
+        friend class ValueBatch;
+        friend class CallbackDispatcher;
 };
 
 }
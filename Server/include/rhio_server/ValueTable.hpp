@@ -0,0 +1,360 @@
+#ifndef RHIO_VALUETABLE_HPP
+#define RHIO_VALUETABLE_HPP
+
+#include <string>
+#include <vector>
+#include <algorithm>
+#include <new>
+#include <stdexcept>
+#include <cstdint>
+
+namespace RhIO {
+
+/**
+ * ValueTable
+ *
+ * Name indexed container of values hot state
+ * (see ValueHot) with a std::map like interface
+ * (sorted iteration).
+ * Hot states are stored contiguously in cache line
+ * aligned chunks growing geometrically. The cold
+ * metadata (T::Meta) of each value are stored in
+ * a side table of parallel chunks and referenced
+ * by the hot state ptrMeta field.
+ * The name index is a sorted array of pointers
+ * (names are stored in the cold metadata) searched
+ * by dichotomy.
+ * Stored structures addresses are stable.
+ * Entries are only removed by clear().
+ * NOT THREAD SAFE.
+ */
+template <typename T>
+class ValueTable
+{
+    public:
+
+        /**
+         * Typedef cold metadata type
+         */
+        typedef typename T::Meta Meta;
+
+        /**
+         * Cache line size in bytes
+         */
+        static const size_t CacheLine = 64;
+
+        /**
+         * Sorted iteration element
+         */
+        template <typename U>
+        struct Entry {
+            const std::string& first;
+            U& second;
+        };
+
+        /**
+         * Sorted iterator over name index
+         */
+        template <typename It, typename U>
+        class Iterator
+        {
+            public:
+
+                Iterator(It it) :
+                    _it(it)
+                {
+                }
+
+                Entry<U> operator*() const
+                {
+                    return Entry<U>{(*_it)->meta().name, **_it};
+                }
+                Iterator& operator++()
+                {
+                    ++_it;
+                    return *this;
+                }
+                bool operator==(const Iterator& it) const
+                {
+                    return _it == it._it;
+                }
+                bool operator!=(const Iterator& it) const
+                {
+                    return _it != it._it;
+                }
+
+            private:
+
+                It _it;
+        };
+
+        typedef Iterator<
+            typename std::vector<T*>::iterator, T> iterator;
+        typedef Iterator<
+            typename std::vector<T*>::const_iterator, const T>
+            const_iterator;
+
+        /**
+         * Initialization with empty table
+         */
+        ValueTable() :
+            _names(),
+            _chunks()
+        {
+        }
+
+        /**
+         * Deep copy
+         */
+        ValueTable(const ValueTable& table) :
+            _names(),
+            _chunks()
+        {
+            *this = table;
+        }
+        ValueTable& operator=(const ValueTable& table)
+        {
+            if (this != &table) {
+                clear();
+                for (const T* ptr : table._names) {
+                    T& value = (*this)[ptr->meta().name];
+                    value = *ptr;
+                    value.meta() = ptr->meta();
+                }
+            }
+            return *this;
+        }
+
+        /**
+         * Destroy all structures
+         * and free the chunks
+         */
+        ~ValueTable()
+        {
+            clear();
+        }
+
+        /**
+         * Return 1 if given name is
+         * contained and 0 else
+         */
+        size_t count(const std::string& name) const
+        {
+            return (find(name) != nullptr) ? 1 : 0;
+        }
+
+        /**
+         * Return the structure associated with
+         * given name. Throw std::out_of_range
+         * if not found.
+         */
+        T& at(const std::string& name)
+        {
+            T* ptr = find(name);
+            if (ptr == nullptr) {
+                throw std::out_of_range(
+                    "RhIO::ValueTable: unknown name: " + name);
+            }
+            return *ptr;
+        }
+        const T& at(const std::string& name) const
+        {
+            const T* ptr = find(name);
+            if (ptr == nullptr) {
+                throw std::out_of_range(
+                    "RhIO::ValueTable: unknown name: " + name);
+            }
+            return *ptr;
+        }
+
+        /**
+         * Return the structure associated with given
+         * name. A default constructed one (with its
+         * metadata name set) is inserted if the
+         * name is not contained.
+         */
+        T& operator[](const std::string& name)
+        {
+            auto it = lowerBound(name);
+            if (it != _names.end() && (*it)->meta().name == name) {
+                return **it;
+            }
+            Chunk_t& chunk = allocate();
+            Meta* meta = new (chunk.cold + chunk.used*sizeof(Meta)) Meta();
+            T* ptr = new (chunk.hot + chunk.used*sizeof(T)) T();
+            chunk.used++;
+            ptr->ptrMeta = meta;
+            meta->name = name;
+            _names.insert(it, ptr);
+            return *ptr;
+        }
+
+        /**
+         * Return the number of contained structures
+         */
+        size_t size() const
+        {
+            return _names.size();
+        }
+
+        /**
+         * Destroy all contained structures
+         */
+        void clear()
+        {
+            for (Chunk_t& chunk : _chunks) {
+                for (size_t i=0;i<chunk.used;i++) {
+                    ((T*)(chunk.hot + i*sizeof(T)))->~T();
+                    ((Meta*)(chunk.cold + i*sizeof(Meta)))->~Meta();
+                }
+                delete[] chunk.rawHot;
+                delete[] chunk.rawCold;
+            }
+            _chunks.clear();
+            _names.clear();
+        }
+
+        /**
+         * Sorted by name iteration
+         */
+        iterator begin()
+        {
+            return iterator(_names.begin());
+        }
+        iterator end()
+        {
+            return iterator(_names.end());
+        }
+        const_iterator begin() const
+        {
+            return const_iterator(_names.begin());
+        }
+        const_iterator end() const
+        {
+            return const_iterator(_names.end());
+        }
+
+    private:
+
+        /**
+         * Number of structures in the first
+         * chunk and maximum chunk size
+         */
+        static const size_t ChunkMin = 8;
+        static const size_t ChunkMax = 1024;
+
+        /**
+         * Contiguous storage of hot states
+         * and of their cold metadata.
+         * Raw allocated pointers and
+         * cache line aligned begins.
+         */
+        struct Chunk_t {
+            unsigned char* rawHot;
+            unsigned char* rawCold;
+            unsigned char* hot;
+            unsigned char* cold;
+            size_t capacity;
+            size_t used;
+        };
+
+        /**
+         * Pointers to stored structures
+         * sorted by name
+         */
+        std::vector<T*> _names;
+
+        /**
+         * Allocated storage chunks
+         */
+        std::vector<Chunk_t> _chunks;
+
+        /**
+         * Return the first index position whose
+         * name is not less than given name
+         */
+        typename std::vector<T*>::iterator lowerBound(
+            const std::string& name)
+        {
+            return std::lower_bound(_names.begin(), _names.end(), name,
+                [](const T* ptr, const std::string& key) {
+                    return ptr->meta().name < key;
+                });
+        }
+        typename std::vector<T*>::const_iterator lowerBound(
+            const std::string& name) const
+        {
+            return std::lower_bound(_names.begin(), _names.end(), name,
+                [](const T* ptr, const std::string& key) {
+                    return ptr->meta().name < key;
+                });
+        }
+
+        /**
+         * Return the structure associated with
+         * given name or nullptr if not found
+         */
+        T* find(const std::string& name)
+        {
+            auto it = lowerBound(name);
+            if (it != _names.end() && (*it)->meta().name == name) {
+                return *it;
+            }
+            return nullptr;
+        }
+        const T* find(const std::string& name) const
+        {
+            auto it = lowerBound(name);
+            if (it != _names.end() && (*it)->meta().name == name) {
+                return *it;
+            }
+            return nullptr;
+        }
+
+        /**
+         * Return cache line aligned
+         * begin of given raw allocation
+         */
+        static unsigned char* align(unsigned char* raw)
+        {
+            uintptr_t addr = (uintptr_t)raw;
+            addr = ((addr + CacheLine - 1)/CacheLine)*CacheLine;
+            return (unsigned char*)addr;
+        }
+
+        /**
+         * Return the last chunk with room for
+         * at least one new structure
+         * (the caller increments its used count)
+         */
+        Chunk_t& allocate()
+        {
+            if (_chunks.size() == 0 ||
+                _chunks.back().used == _chunks.back().capacity
+            ) {
+                size_t capacity = ChunkMin;
+                if (_chunks.size() > 0) {
+                    capacity = 2*_chunks.back().capacity;
+                    if (capacity > ChunkMax) {
+                        capacity = ChunkMax;
+                    }
+                }
+                Chunk_t chunk;
+                chunk.rawHot = new unsigned char[
+                    capacity*sizeof(T) + CacheLine];
+                chunk.rawCold = new unsigned char[
+                    capacity*sizeof(Meta) + CacheLine];
+                chunk.hot = align(chunk.rawHot);
+                chunk.cold = align(chunk.rawCold);
+                chunk.capacity = capacity;
+                chunk.used = 0;
+                _chunks.push_back(chunk);
+            }
+            return _chunks.back();
+        }
+};
+
+}
+
+#endif
+
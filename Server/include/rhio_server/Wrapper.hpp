@@ -102,7 +102,7 @@ class WrapperBool
          * element stored in the map container.
          */
         IONode* _node;
-        ValueBool* _ptrValue;
+        ValueHotBool* _ptrValue;
 };
 class WrapperInt
 {
@@ -197,7 +197,7 @@ class WrapperInt
          * element stored in the map container.
          */
         IONode* _node;
-        ValueInt* _ptrValue;
+        ValueHotInt* _ptrValue;
 };
 class WrapperFloat
 {
@@ -292,7 +292,226 @@ class WrapperFloat
          * element stored in the map container.
          */
         IONode* _node;
-        ValueFloat* _ptrValue;
+        ValueHotFloat* _ptrValue;
+};
+
+/**
+ * WrapperFloatArray
+ *
+ * Object wrapper around either an existing
+ * native float array value or a block of existing
+ * float values, with bulk copy in and out.
+ * Bulk accessors check the wrapper state once
+ * per call. Element accessors are only checked
+ * in debug builds (without NDEBUG).
+ */
+class WrapperFloatArray
+{
+    public:
+        
+        /**
+         * Default uninitialized
+         */
+        WrapperFloatArray() :
+            _node(nullptr),
+            _ptrArray(nullptr),
+            _ptrValues()
+        {
+        }
+
+        /**
+         * Initialize with a RhIO node and the name of 
+         * an existing float array value stored within it
+         */
+        WrapperFloatArray(
+            IONode& node,
+            const std::string& name) :
+            _node(nullptr),
+            _ptrArray(nullptr),
+            _ptrValues()
+        {
+            bind(node, name);
+        }
+
+        /**
+         * Initialize with a RhIO node and the names of 
+         * existing float values stored within it.
+         * Element i is bound to the value names[i].
+         */
+        WrapperFloatArray(
+            IONode& node,
+            const std::vector<std::string>& names) :
+            _node(nullptr),
+            _ptrArray(nullptr),
+            _ptrValues()
+        {
+            bind(node, names);
+        }
+
+        /**
+         * Bind the wrapper to given RhIO node and given
+         * name of existing float array or names of existing 
+         * floats stored within it.
+         * Only if the wrapper is still uninitialized.
+         */
+        void bind(
+            IONode& node,
+            const std::string& name)
+        {
+            if (_node != nullptr) {
+                throw std::logic_error(
+                    "RhIO::WrapperFloatArray::bind: "
+                    "Wrapper already assigned");
+            }
+            _ptrArray = &(node.accessValueFloatArray(name));
+            _node = &node;
+        }
+        void bind(
+            IONode& node,
+            const std::vector<std::string>& names)
+        {
+            if (_node != nullptr) {
+                throw std::logic_error(
+                    "RhIO::WrapperFloatArray::bind: "
+                    "Wrapper already assigned");
+            }
+            std::vector<ValueHotFloat*> ptrValues;
+            for (const std::string& name : names) {
+                ptrValues.push_back(&(node.accessValueFloat(name)));
+            }
+            _ptrValues = ptrValues;
+            _node = &node;
+        }
+
+        /**
+         * Return the number of bound elements
+         */
+        size_t size() const
+        {
+            if (_ptrArray != nullptr) {
+                return _ptrArray->value.size();
+            } else {
+                return _ptrValues.size();
+            }
+        }
+
+        /**
+         * Copy all elements into given 
+         * buffer of size() length.
+         * A native array is read consistently.
+         */
+        void get(double* data) const
+        {
+            if (_node == nullptr) {
+                throw std::logic_error(
+                    "RhIO::WrapperFloatArray::get: uninitialized");
+            }
+            if (_ptrArray != nullptr) {
+                _ptrArray->value.load(data);
+            } else {
+                size_t size = _ptrValues.size();
+                ValueHotFloat* const* ptrValues = _ptrValues.data();
+                for (size_t i=0;i<size;i++) {
+                    data[i] = ptrValues[i]->value.load(
+                        std::memory_order_relaxed);
+                }
+            }
+        }
+
+        /**
+         * Return the element at given index
+         */
+        double get(size_t index) const
+        {
+#ifndef NDEBUG
+            if (_node == nullptr) {
+                throw std::logic_error(
+                    "RhIO::WrapperFloatArray::get: uninitialized");
+            }
+            if (index >= size()) {
+                throw std::logic_error(
+                    "RhIO::WrapperFloatArray::get: out of range");
+            }
+#endif
+            if (_ptrArray != nullptr) {
+                return _ptrArray->value.at(index);
+            } else {
+                return _ptrValues[index]->value.load(
+                    std::memory_order_relaxed);
+            }
+        }
+        double operator[](size_t index) const
+        {
+            return get(index);
+        }
+
+        /**
+         * Set all elements from given buffer 
+         * of size() length with optional 
+         * timestamp information.
+         * A native array is written atomically.
+         */
+        void set(
+            const double* data,
+            int64_t timestamp = getRhIOTime())
+        {
+            if (_node == nullptr) {
+                throw std::logic_error(
+                    "RhIO::WrapperFloatArray::set: uninitialized");
+            }
+            if (_ptrArray != nullptr) {
+                _node->assignRTFloatArray(*_ptrArray, data, timestamp);
+            } else {
+                for (size_t i=0;i<_ptrValues.size();i++) {
+                    _node->assignRTFloat(
+                        *(_ptrValues[i]), data[i], timestamp);
+                }
+            }
+        }
+
+        /**
+         * Bulk copy out to and copy in from a 
+         * contiguous container of double providing 
+         * data() and size() (std::vector, Eigen 
+         * vectors...). Its size must be size().
+         */
+        template <typename T>
+        void copyOut(T& buffer) const
+        {
+            checkSize(buffer.size());
+            get(buffer.data());
+        }
+        template <typename T>
+        void copyIn(
+            const T& buffer,
+            int64_t timestamp = getRhIOTime())
+        {
+            checkSize(buffer.size());
+            set(buffer.data(), timestamp);
+        }
+
+    private:
+
+        /**
+         * Pointer towards a node and either a float
+         * array value or float values elements
+         * stored in the node containers.
+         */
+        IONode* _node;
+        ValueHotFloatArray* _ptrArray;
+        std::vector<ValueHotFloat*> _ptrValues;
+
+        /**
+         * Throw logic_error if given buffer 
+         * size does not match
+         */
+        void checkSize(size_t length) const
+        {
+            if (length != size()) {
+                throw std::logic_error(
+                    "RhIO::WrapperFloatArray: invalid buffer size");
+            }
+        }
 };
 
 }
@@ -4,7 +4,15 @@
 namespace RhIO {
         
 Bind::Bind(const std::string& prefixChild) :
-    _prefix(prefixChild)
+    _prefix(prefixChild),
+    _bindsBool(),
+    _bindsInt(),
+    _bindsLong(),
+    _bindsFloat(),
+    _bindsDouble(),
+    _bindsStr(),
+    _batch(RhIO::Root),
+    _isPushOnChange(false)
 {
     if (_prefix[_prefix.length()] != '/') {
         _prefix = _prefix + '/';
@@ -25,14 +33,23 @@ std::unique_ptr<ValueBuilderBool> Bind::bindNew(
     }
     //Create non existing hierarchy
     createPath(_prefix+name);
+    //Create new value
+    std::unique_ptr<ValueBuilderBool> builder = 
+        RhIO::Root.newBool(_prefix+name);
     //Add to bind container
+    ValueHandleBool handle(RhIO::Root, _prefix+name);
     _bindsBool.push_back({
-        relativeName(_prefix+name), 
-        getChildPtr(_prefix+name), 
         &var,
+        handle,
+        (bool)handle.get(),
         policy});
-    //Create new value
-    return RhIO::Root.newBool(_prefix+name);
+    //Read the last value again once the default
+    //value is applied (at builder destruction)
+    size_t index = _bindsBool.size() - 1;
+    builder->addCallbackFinalize([this, index](ValueHotBool&) {
+        _bindsBool[index].last = (bool)_bindsBool[index].handle.get();
+    });
+    return builder;
 }
 std::unique_ptr<ValueBuilderInt> Bind::bindNew(
     const std::string& name, int& var,
@@ -45,14 +62,23 @@ std::unique_ptr<ValueBuilderInt> Bind::bindNew(
     }
     //Create non existing hierarchy
     createPath(_prefix+name);
+    //Create new value
+    std::unique_ptr<ValueBuilderInt> builder = 
+        RhIO::Root.newInt(_prefix+name);
     //Add to bind container
+    ValueHandleInt handle(RhIO::Root, _prefix+name);
     _bindsInt.push_back({
-        relativeName(_prefix+name), 
-        getChildPtr(_prefix+name), 
         &var,
+        handle,
+        (int)handle.get(),
         policy});
-    //Create new value
-    return RhIO::Root.newInt(_prefix+name);
+    //Read the last value again once the default
+    //value is applied (at builder destruction)
+    size_t index = _bindsInt.size() - 1;
+    builder->addCallbackFinalize([this, index](ValueHotInt&) {
+        _bindsInt[index].last = (int)_bindsInt[index].handle.get();
+    });
+    return builder;
 }
 std::unique_ptr<ValueBuilderInt> Bind::bindNew(
     const std::string& name, long& var,
@@ -65,14 +91,23 @@ std::unique_ptr<ValueBuilderInt> Bind::bindNew(
     }
     //Create non existing hierarchy
     createPath(_prefix+name);
+    //Create new value
+    std::unique_ptr<ValueBuilderInt> builder = 
+        RhIO::Root.newInt(_prefix+name);
     //Add to bind container
+    ValueHandleInt handle(RhIO::Root, _prefix+name);
     _bindsLong.push_back({
-        relativeName(_prefix+name), 
-        getChildPtr(_prefix+name), 
         &var,
+        handle,
+        (long)handle.get(),
         policy});
-    //Create new value
-    return RhIO::Root.newInt(_prefix+name);
+    //Read the last value again once the default
+    //value is applied (at builder destruction)
+    size_t index = _bindsLong.size() - 1;
+    builder->addCallbackFinalize([this, index](ValueHotInt&) {
+        _bindsLong[index].last = (long)_bindsLong[index].handle.get();
+    });
+    return builder;
 }
 std::unique_ptr<ValueBuilderFloat> Bind::bindNew(
     const std::string& name, float& var,
@@ -85,14 +120,23 @@ std::unique_ptr<ValueBuilderFloat> Bind::bindNew(
     }
     //Create non existing hierarchy
     createPath(_prefix+name);
+    //Create new value
+    std::unique_ptr<ValueBuilderFloat> builder = 
+        RhIO::Root.newFloat(_prefix+name);
     //Add to bind container
+    ValueHandleFloat handle(RhIO::Root, _prefix+name);
     _bindsFloat.push_back({
-        relativeName(_prefix+name), 
-        getChildPtr(_prefix+name), 
         &var,
+        handle,
+        (float)handle.get(),
         policy});
-    //Create new value
-    return RhIO::Root.newFloat(_prefix+name);
+    //Read the last value again once the default
+    //value is applied (at builder destruction)
+    size_t index = _bindsFloat.size() - 1;
+    builder->addCallbackFinalize([this, index](ValueHotFloat&) {
+        _bindsFloat[index].last = (float)_bindsFloat[index].handle.get();
+    });
+    return builder;
 }
 std::unique_ptr<ValueBuilderFloat> Bind::bindNew(
     const std::string& name, double& var,
@@ -105,14 +149,23 @@ std::unique_ptr<ValueBuilderFloat> Bind::bindNew(
     }
     //Create non existing hierarchy
     createPath(_prefix+name);
+    //Create new value
+    std::unique_ptr<ValueBuilderFloat> builder = 
+        RhIO::Root.newFloat(_prefix+name);
     //Add to bind container
+    ValueHandleFloat handle(RhIO::Root, _prefix+name);
     _bindsDouble.push_back({
-        relativeName(_prefix+name), 
-        getChildPtr(_prefix+name), 
         &var,
+        handle,
+        (double)handle.get(),
         policy});
-    //Create new value
-    return RhIO::Root.newFloat(_prefix+name);
+    //Read the last value again once the default
+    //value is applied (at builder destruction)
+    size_t index = _bindsDouble.size() - 1;
+    builder->addCallbackFinalize([this, index](ValueHotFloat&) {
+        _bindsDouble[index].last = (double)_bindsDouble[index].handle.get();
+    });
+    return builder;
 }
 std::unique_ptr<ValueBuilderStr> Bind::bindNew(
     const std::string& name, std::string& var,
@@ -125,14 +178,23 @@ std::unique_ptr<ValueBuilderStr> Bind::bindNew(
     }
     //Create non existing hierarchy
     createPath(_prefix+name);
+    //Create new value
+    std::unique_ptr<ValueBuilderStr> builder = 
+        RhIO::Root.newStr(_prefix+name);
     //Add to bind container
+    ValueHandleStr handle(RhIO::Root, _prefix+name);
     _bindsStr.push_back({
-        relativeName(_prefix+name), 
-        getChildPtr(_prefix+name), 
         &var,
+        handle,
+        (std::string)handle.get(),
         policy});
-    //Create new value
-    return RhIO::Root.newStr(_prefix+name);
+    //Read the last value again once the default
+    //value is applied (at builder destruction)
+    size_t index = _bindsStr.size() - 1;
+    builder->addCallbackFinalize([this, index](ValueHotStr&) {
+        _bindsStr[index].last = (std::string)_bindsStr[index].handle.get();
+    });
+    return builder;
 }
 
 void Bind::bind(const std::string& name, bool& var,
@@ -149,10 +211,11 @@ void Bind::bind(const std::string& name, bool& var,
             "RhIO not created value name: " + name);
     }
     //Add to bind container
+    ValueHandleBool handle(RhIO::Root, _prefix+name);
     _bindsBool.push_back({
-        relativeName(_prefix+name), 
-        getChildPtr(_prefix+name), 
         &var,
+        handle,
+        (bool)handle.get(),
         policy});
 }
 void Bind::bind(const std::string& name, int& var,
@@ -169,10 +232,11 @@ void Bind::bind(const std::string& name, int& var,
             "RhIO not created value name: " + name);
     }
     //Add to bind container
+    ValueHandleInt handle(RhIO::Root, _prefix+name);
     _bindsInt.push_back({
-        relativeName(_prefix+name), 
-        getChildPtr(_prefix+name), 
         &var,
+        handle,
+        (int)handle.get(),
         policy});
 }
 void Bind::bind(const std::string& name, long& var,
@@ -189,10 +253,11 @@ void Bind::bind(const std::string& name, long& var,
             "RhIO not created value name: " + name);
     }
     //Add to bind container
+    ValueHandleInt handle(RhIO::Root, _prefix+name);
     _bindsLong.push_back({
-        relativeName(_prefix+name), 
-        getChildPtr(_prefix+name), 
         &var,
+        handle,
+        (long)handle.get(),
         policy});
 }
 void Bind::bind(const std::string& name, float& var,
@@ -209,10 +274,11 @@ void Bind::bind(const std::string& name, float& var,
             "RhIO not created value name: " + name);
     }
     //Add to bind container
+    ValueHandleFloat handle(RhIO::Root, _prefix+name);
     _bindsFloat.push_back({
-        relativeName(_prefix+name), 
-        getChildPtr(_prefix+name), 
         &var,
+        handle,
+        (float)handle.get(),
         policy});
 }
 void Bind::bind(const std::string& name, double& var,
@@ -229,10 +295,11 @@ void Bind::bind(const std::string& name, double& var,
             "RhIO not created value name: " + name);
     }
     //Add to bind container
+    ValueHandleFloat handle(RhIO::Root, _prefix+name);
     _bindsDouble.push_back({
-        relativeName(_prefix+name), 
-        getChildPtr(_prefix+name), 
         &var,
+        handle,
+        (double)handle.get(),
         policy});
 }
 void Bind::bind(const std::string& name, std::string& var,
@@ -249,10 +316,11 @@ void Bind::bind(const std::string& name, std::string& var,
             "RhIO not created value name: " + name);
     }
     //Add to bind container
+    ValueHandleStr handle(RhIO::Root, _prefix+name);
     _bindsStr.push_back({
-        relativeName(_prefix+name), 
-        getChildPtr(_prefix+name), 
         &var,
+        handle,
+        (std::string)handle.get(),
         policy});
 }
 
@@ -305,37 +373,48 @@ void Bind::framePush(const std::string& name,
 {
     node().framePush(name, width, height, data, size);
 }
+FrameBuffer* Bind::frameLease(const std::string& name, 
+    size_t width, size_t height)
+{
+    return node().frameLease(name, width, height);
+}
 
 void Bind::pull()
 {
     for (auto& b : _bindsBool) {
         if (b.policy == PushAndPull || b.policy == PullOnly) {
-            *(b.ptr) = b.node->getBool(b.name);
+            *(b.ptr) = b.handle.get();
+            b.last = *(b.ptr);
         }
     }
     for (auto& b : _bindsInt) {
         if (b.policy == PushAndPull || b.policy == PullOnly) {
-            *(b.ptr) = b.node->getInt(b.name);
+            *(b.ptr) = b.handle.get();
+            b.last = *(b.ptr);
         }
     }
     for (auto& b : _bindsLong) {
         if (b.policy == PushAndPull || b.policy == PullOnly) {
-            *(b.ptr) = b.node->getInt(b.name);
+            *(b.ptr) = b.handle.get();
+            b.last = *(b.ptr);
         }
     }
     for (auto& b : _bindsFloat) {
         if (b.policy == PushAndPull || b.policy == PullOnly) {
-            *(b.ptr) = b.node->getFloat(b.name);
+            *(b.ptr) = b.handle.get();
+            b.last = *(b.ptr);
         }
     }
     for (auto& b : _bindsDouble) {
         if (b.policy == PushAndPull || b.policy == PullOnly) {
-            *(b.ptr) = b.node->getFloat(b.name);
+            *(b.ptr) = b.handle.get();
+            b.last = *(b.ptr);
         }
     }
     for (auto& b : _bindsStr) {
         if (b.policy == PushAndPull || b.policy == PullOnly) {
-            *(b.ptr) = b.node->getStr(b.name);
+            *(b.ptr) = b.handle.get();
+            b.last = *(b.ptr);
         }
     }
 }
@@ -343,35 +422,68 @@ void Bind::pull()
 void Bind::push()
 {
     for (auto& b : _bindsBool) {
-        if (b.policy == PushAndPull || b.policy == PushOnly) {
-            b.node->setBool(b.name, *(b.ptr));
+        if (
+            (b.policy == PushAndPull || b.policy == PushOnly) &&
+            (!_isPushOnChange || *(b.ptr) != b.last)
+        ) {
+            _batch.setBool(b.handle, *(b.ptr));
+            b.last = *(b.ptr);
         }
     }
     for (auto& b : _bindsInt) {
-        if (b.policy == PushAndPull || b.policy == PushOnly) {
-            b.node->setInt(b.name, *(b.ptr));
+        if (
+            (b.policy == PushAndPull || b.policy == PushOnly) &&
+            (!_isPushOnChange || *(b.ptr) != b.last)
+        ) {
+            _batch.setInt(b.handle, *(b.ptr));
+            b.last = *(b.ptr);
         }
     }
     for (auto& b : _bindsLong) {
-        if (b.policy == PushAndPull || b.policy == PushOnly) {
-            b.node->setInt(b.name, *(b.ptr));
+        if (
+            (b.policy == PushAndPull || b.policy == PushOnly) &&
+            (!_isPushOnChange || *(b.ptr) != b.last)
+        ) {
+            _batch.setInt(b.handle, *(b.ptr));
+            b.last = *(b.ptr);
         }
     }
     for (auto& b : _bindsFloat) {
-        if (b.policy == PushAndPull || b.policy == PushOnly) {
-            b.node->setFloat(b.name, *(b.ptr));
+        if (
+            (b.policy == PushAndPull || b.policy == PushOnly) &&
+            (!_isPushOnChange || *(b.ptr) != b.last)
+        ) {
+            _batch.setFloat(b.handle, *(b.ptr));
+            b.last = *(b.ptr);
         }
     }
     for (auto& b : _bindsDouble) {
-        if (b.policy == PushAndPull || b.policy == PushOnly) {
-            b.node->setFloat(b.name, *(b.ptr));
+        if (
+            (b.policy == PushAndPull || b.policy == PushOnly) &&
+            (!_isPushOnChange || *(b.ptr) != b.last)
+        ) {
+            _batch.setFloat(b.handle, *(b.ptr));
+            b.last = *(b.ptr);
         }
     }
     for (auto& b : _bindsStr) {
-        if (b.policy == PushAndPull || b.policy == PushOnly) {
-            b.node->setStr(b.name, *(b.ptr));
+        if (
+            (b.policy == PushAndPull || b.policy == PushOnly) &&
+            (!_isPushOnChange || *(b.ptr) != b.last)
+        ) {
+            _batch.setStr(b.handle, *(b.ptr));
+            b.last = *(b.ptr);
         }
     }
+    //Apply all updates at once
+    if (_batch.size() > 0) {
+        _batch.commit();
+    }
+}
+
+void Bind::setPushOnChange(bool isEnabled)
+{
+    _isPushOnChange = isEnabled;
 }
         
 void Bind::createPath(const std::string& path)
@@ -403,17 +515,6 @@ IONode* Bind::getChildPtr(const std::string& name) const
     }
 }
         
-std::string Bind::relativeName(const std::string& name) const
-{
-    //Extract relative value name
-    size_t pos = name.find_last_of("/");
-    if (pos != std::string::npos) {
-        return name.substr(pos+1);
-    } else {
-        return name;
-    }
-}
-        
 bool Bind::checkIsRegistered(const void* addr) const
 {
     for (size_t i=0;i<_bindsBool.size();i++) {
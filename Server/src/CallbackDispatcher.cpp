@@ -0,0 +1,121 @@
+#include <functional>
+#include "rhio_server/CallbackDispatcher.hpp"
+#include "rhio_server/ValueNode.hpp"
+#include "rhio_server/Stats.hpp"
+
+namespace RhIO {
+
+CallbackDispatcher::CallbackDispatcher() :
+    //Maximum queue length memory allocation
+    _queueBool(10000),
+    _queueInt(10000),
+    _queueFloat(10000),
+    _queueStr(10000),
+    _queueFloatArray(10000),
+    _mutex()
+{
+}
+
+bool CallbackDispatcher::pushBool(ValueNode* node,
+    ValueHotBool* ptrValue, bool val)
+{
+    return _queueBool.appendFromWriter({node, ptrValue, val});
+}
+bool CallbackDispatcher::pushInt(ValueNode* node,
+    ValueHotInt* ptrValue, int64_t val)
+{
+    return _queueInt.appendFromWriter({node, ptrValue, val});
+}
+bool CallbackDispatcher::pushFloat(ValueNode* node,
+    ValueHotFloat* ptrValue, double val)
+{
+    return _queueFloat.appendFromWriter({node, ptrValue, val});
+}
+bool CallbackDispatcher::pushStr(ValueNode* node,
+    ValueHotStr* ptrValue, const std::string& val)
+{
+    return _queueStr.appendFromWriter({node, ptrValue, val});
+}
+bool CallbackDispatcher::pushFloatArray(ValueNode* node,
+    ValueHotFloatArray* ptrValue, const std::vector<double>& val)
+{
+    return _queueFloatArray.appendFromWriter({node, ptrValue, val});
+}
+
+size_t CallbackDispatcher::dispatch()
+{
+    std::lock_guard<std::mutex> lock(_mutex);
+
+    size_t count = 0;
+    count += dispatchQueue(_queueBool);
+    count += dispatchQueue(_queueInt);
+    count += dispatchQueue(_queueFloat);
+    count += dispatchQueue(_queueStr);
+    count += dispatchQueue(_queueFloatArray);
+
+    return count;
+}
+
+void CallbackDispatcher::clear()
+{
+    std::lock_guard<std::mutex> lock(_mutex);
+
+    //Swapping twice empties both buffers
+    for (size_t i=0;i<2;i++) {
+        _queueBool.swapBufferFromReader();
+        _queueInt.swapBufferFromReader();
+        _queueFloat.swapBufferFromReader();
+        _queueStr.swapBufferFromReader();
+        _queueFloatArray.swapBufferFromReader();
+    }
+}
+
+uint64_t CallbackDispatcher::getCountDropped() const
+{
+    return
+        _queueBool.getCountDropped() +
+        _queueInt.getCountDropped() +
+        _queueFloat.getCountDropped() +
+        _queueStr.getCountDropped() +
+        _queueFloatArray.getCountDropped();
+}
+
+void CallbackDispatcher::updateStats() const
+{
+    statsQueue("callback/bool", _queueBool);
+    statsQueue("callback/int", _queueInt);
+    statsQueue("callback/float", _queueFloat);
+    statsQueue("callback/str", _queueStr);
+    statsQueue("callback/floatArray", _queueFloatArray);
+}
+
+template <typename V, typename T>
+size_t CallbackDispatcher::dispatchQueue(
+    LockFreeDoubleQueue<Deferred<V, T>>& queue)
+{
+    queue.swapBufferFromReader();
+    const std::vector<Deferred<V, T>>& buffer =
+        queue.getBufferFromReader();
+    size_t size = queue.getSizeFromReader();
+
+    const V* ptrLast = nullptr;
+    std::function<void(T)> callback;
+    for (size_t i=0;i<size;i++) {
+        //Copy the callback under the node lock
+        //(it may be concurrently replaced) and
+        //call it after the lock is released
+        if (buffer[i].ptrValue != ptrLast) {
+            std::lock_guard<std::mutex> lockNode(buffer[i].node->_mutex);
+            callback = buffer[i].ptrValue->meta().callback;
+            ptrLast = buffer[i].ptrValue;
+        }
+        if (callback) {
+            callback(buffer[i].value);
+        }
+    }
+
+    return size;
+}
+
+}
+
@@ -7,6 +7,7 @@ namespace RhIO {
 CommandNode& CommandNode::operator=(const CommandNode& node)
 {
     _commands = node._commands;
+    _commandsBinary = node._commandsBinary;
     _descriptions = node._descriptions;
 
     return *this;
@@ -40,6 +41,34 @@ std::string CommandNode::call(const std::string& name,
     }
 }
 
+bool CommandNode::commandBinaryExist(const std::string& name) const
+{
+    //Forward to subtree
+    std::string tmpName;
+    CommandNode* child = BaseNode::forwardFunc(name, tmpName, false);
+    if (child != nullptr) return child->commandBinaryExist(tmpName);
+    
+    std::lock_guard<std::mutex> lock(_mutex);
+    return (_commandsBinary.count(name) > 0);
+}
+        
+CommandData CommandNode::callBinary(const std::string& name, 
+    const CommandData& arguments)
+{
+    //Forward to subtree
+    std::string tmpName;
+    CommandNode* child = BaseNode::forwardFunc(name, tmpName, false);
+    if (child != nullptr) return child->callBinary(tmpName, arguments);
+
+    std::lock_guard<std::mutex> lock(_mutex);
+    if (_commandsBinary.count(name) > 0) {
+        return _commandsBinary.at(name)(arguments);
+    } else {
+        throw std::logic_error(
+            "RhIO unknown binary command name: " + name);
+    }
+}
+
 std::string CommandNode::commandDescription(
     const std::string& name) const
 {
@@ -79,6 +108,30 @@ void CommandNode::newCommand(const std::string& name,
     }
 }
         
+void CommandNode::newCommand(const std::string& name, 
+    const std::string& comment,
+    CommandFunc func,
+    CommandBinaryFunc funcBinary)
+{
+    //Forward to subtree
+    std::string tmpName;
+    CommandNode* child = BaseNode::forwardFunc(name, tmpName, true);
+    if (child != nullptr) {
+        child->newCommand(tmpName, comment, func, funcBinary);
+        return;
+    }
+
+    std::lock_guard<std::mutex> lock(_mutex);
+    if (_commands.count(name) == 0) {
+        _commands[name] = func;
+        _commandsBinary[name] = funcBinary;
+        _descriptions[name] = comment;
+    } else {
+        throw std::logic_error(
+            "RhIO already register command name: " + name);
+    }
+}
+        
 std::vector<std::string> CommandNode::listCommands() const
 {
     std::lock_guard<std::mutex> lock(_mutex);
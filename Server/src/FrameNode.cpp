@@ -1,4 +1,5 @@
 #include <stdexcept>
+#include <cstring>
 #include "rhio_server/FrameNode.hpp"
 #include "rhio_server/ServerPub.hpp"
 #include "RhIO.hpp"
@@ -8,6 +9,7 @@ namespace RhIO {
 FrameNode& FrameNode::operator=(const FrameNode& node)
 {
     _frames = node._frames;
+    _pools = node._pools;
 
     return *this;
 }
@@ -61,27 +63,35 @@ void FrameNode::framePush(const std::string& name,
     size_t width, size_t height,
     unsigned char* data, size_t size, 
     int64_t timestamp)
+{
+    if (size != 3*width*height) {
+        throw std::logic_error(
+            "RhIO frame size seems wrong: " + name);
+    }
+    //Copy into a pooled buffer
+    FrameBuffer* buffer = frameLease(name, width, height);
+    if (buffer != nullptr) {
+        std::memcpy(buffer->data.data(), data, size);
+        framePublish(buffer, timestamp);
+    }
+}
+
+FrameBuffer* FrameNode::frameLease(const std::string& name, 
+    size_t width, size_t height)
 {
     //Forward to subtree
     std::string tmpName;
     FrameNode* child = BaseNode::forwardFunc(name, tmpName, false);
     if (child != nullptr) {
-        child->framePush(tmpName, width, height, data, size);
-        return;
+        return child->frameLease(tmpName, width, height);
     }
     
     std::lock_guard<std::mutex> lock(_mutex);
     if (_frames.count(name) > 0) {
-        if (size != 3*width*height) {
-            throw std::logic_error(
-                "RhIO frame size seems wrong: " + name);
-        }
-        if (_frames.at(name).countWatchers > 0) {
-            if (ServerStream != nullptr) {
-                ServerStream->publishFrame(BaseNode::pwd + separator + name, 
-                    width, height, 
-                    data, size, timestamp);
-            }
+        if (_frames.at(name).countWatchers > 0 && ServerStream != nullptr) {
+            return _pools.at(name)->lease(width, height);
+        } else {
+            return nullptr;
         }
     } else {
         throw std::logic_error(
@@ -89,6 +99,17 @@ void FrameNode::framePush(const std::string& name,
     }
 }
 
+void FrameNode::framePublish(FrameBuffer* buffer,
+    int64_t timestamp)
+{
+    buffer->timestamp = timestamp;
+    if (ServerStream != nullptr) {
+        ServerStream->publishFrame(buffer);
+    } else {
+        buffer->pool->release(buffer);
+    }
+}
+
 void FrameNode::enableStreamingFrame(const std::string& name)
 {
     //Forward to subtree
@@ -161,6 +182,20 @@ void FrameNode::newFrame(const std::string& name,
         return;
     }
     
+    std::string path = BaseNode::pwd + separator + name;
+    {
+        std::lock_guard<std::mutex> lock(_mutex);
+        if (_frames.count(name) != 0) {
+            throw std::logic_error(
+                "RhIO already register frame name: '" + BaseNode::pwd + "/" + name + "'");
+        }
+    }
+
+    //Frame stream read only statistics updated by the 
+    //publisher through handles resolved once by the pool
+    std::shared_ptr<FramePool> pool = std::make_shared<FramePool>(path);
+    pool->bindCounters(Root);
+
     std::lock_guard<std::mutex> lock(_mutex);
     if (_frames.count(name) == 0) {
         _frames[name] = Frame();
@@ -168,6 +203,7 @@ void FrameNode::newFrame(const std::string& name,
         _frames.at(name).comment = comment;
         _frames.at(name).format = format;
         _frames.at(name).countWatchers = 0;
+        _pools[name] = pool;
     } else {
         throw std::logic_error(
             "RhIO already register frame name: '" + BaseNode::pwd + "/" + name + "'");
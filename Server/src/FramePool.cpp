@@ -0,0 +1,184 @@
+#include <stdexcept>
+#include "rhio_server/FramePool.hpp"
+#include "rhio_server/IONode.hpp"
+#include "rhio_server/Stats.hpp"
+
+namespace RhIO {
+
+FramePool::FramePool(const std::string& name, size_t count) :
+    _name(name),
+    _count(count),
+    _buffers(),
+    _free(0),
+    _pending(nullptr),
+    _countProduced(0),
+    _countSent(0),
+    _countOverwritten(0),
+    _handleProduced(),
+    _handleSent(),
+    _handleOverwritten()
+{
+    if (_count == 0 || _count > MaxCount) {
+        throw std::logic_error(
+            "RhIO frame pool invalid buffer count: " + name);
+    }
+    _buffers.reset(new FrameBuffer[_count]);
+    for (size_t i=0;i<_count;i++) {
+        _buffers[i].pool = this;
+        _buffers[i].size = 0;
+        _buffers[i].width = 0;
+        _buffers[i].height = 0;
+        _buffers[i].timestamp = 0;
+        _buffers[i].countRefs.store(0);
+    }
+    if (_count == MaxCount) {
+        _free.store(~(uint64_t)0);
+    } else {
+        _free.store(((uint64_t)1 << _count) - 1);
+    }
+}
+
+const std::string& FramePool::name() const
+{
+    return _name;
+}
+
+FrameBuffer* FramePool::lease(size_t width, size_t height)
+{
+    //Atomically take the first free buffer
+    uint64_t mask = _free.load();
+    size_t index = 0;
+    while (true) {
+        if (mask == 0) {
+            return nullptr;
+        }
+        index = 0;
+        while ((mask & ((uint64_t)1 << index)) == 0) {
+            index++;
+        }
+        if (_free.compare_exchange_weak(
+            mask, mask & ~((uint64_t)1 << index))
+        ) {
+            break;
+        }
+    }
+
+    FrameBuffer* buffer = &(_buffers[index]);
+    buffer->size = 3*width*height;
+    buffer->width = width;
+    buffer->height = height;
+    //Only grow the buffer if needed
+    if (buffer->data.size() < buffer->size) {
+        buffer->data.resize(buffer->size);
+    }
+    buffer->countRefs.store(1);
+
+    return buffer;
+}
+
+void FramePool::retain(FrameBuffer* buffer, size_t count)
+{
+    buffer->countRefs.fetch_add(count);
+}
+
+void FramePool::release(FrameBuffer* buffer)
+{
+    if (buffer->countRefs.fetch_sub(1) == 1) {
+        size_t index = buffer - _buffers.get();
+        _free.fetch_or((uint64_t)1 << index);
+    }
+}
+
+bool FramePool::publish(FrameBuffer* buffer)
+{
+    _countProduced++;
+    FrameBuffer* old = _pending.exchange(buffer);
+    if (old != nullptr) {
+        _countOverwritten++;
+        release(old);
+        return false;
+    } else {
+        return true;
+    }
+}
+
+FrameBuffer* FramePool::take()
+{
+    FrameBuffer* buffer = _pending.exchange(nullptr);
+    if (buffer != nullptr) {
+        _countSent++;
+    }
+
+    return buffer;
+}
+
+void FramePool::discard()
+{
+    FrameBuffer* buffer = _pending.exchange(nullptr);
+    if (buffer != nullptr) {
+        _countOverwritten++;
+        release(buffer);
+    }
+}
+
+size_t FramePool::countFree() const
+{
+    uint64_t mask = _free.load();
+    size_t count = 0;
+    while (mask != 0) {
+        count += mask & 1;
+        mask >>= 1;
+    }
+
+    return count;
+}
+
+int64_t FramePool::countProduced() const
+{
+    return _countProduced.load();
+}
+int64_t FramePool::countSent() const
+{
+    return _countSent.load();
+}
+int64_t FramePool::countOverwritten() const
+{
+    return _countOverwritten.load();
+}
+
+void FramePool::bindCounters(ValueNode& node)
+{
+    //Root level frames path 
+    //starts with a separator
+    std::string path = _name;
+    if (path.length() > 0 && path[0] == separator) {
+        path = path.substr(1);
+    }
+    path = StatsPath + separator + "frame" + separator + path + separator;
+    node.newInt(path + "produced")
+        ->comment("Number of published frames")
+        ->readOnly(true);
+    node.newInt(path + "sent")
+        ->comment("Number of sent frames")
+        ->readOnly(true);
+    node.newInt(path + "overwritten")
+        ->comment("Number of frames overwritten by a newer one before sent")
+        ->readOnly(true);
+    _handleProduced.bind(node, path + "produced");
+    _handleSent.bind(node, path + "sent");
+    _handleOverwritten.bind(node, path + "overwritten");
+}
+
+void FramePool::updateCounters()
+{
+    if (!_handleProduced.isBound()) {
+        return;
+    }
+    int64_t timestamp = getRhIOTime();
+    _handleProduced.setReadOnly(countProduced(), timestamp);
+    _handleSent.setReadOnly(countSent(), timestamp);
+    _handleOverwritten.setReadOnly(countOverwritten(), timestamp);
+}
+
+}
+
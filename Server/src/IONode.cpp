@@ -1,5 +1,7 @@
+#include <thread>
 #include "rhio_server/IONode.hpp"
 #include "rhio_server/Filesystem.hpp"
+#include "rhio_server/PathRegistry.hpp"
 
 namespace RhIO {
         
@@ -28,7 +30,8 @@ IONode::IONode() :
     _pwd("ERROR"),
     _parent(nullptr),
     _children(),
-    _mutex()
+    _mutex(),
+    _index(new PathIndex<IONode>())
 {
 }
 
@@ -57,14 +60,18 @@ IONode::IONode(const std::string& name, IONode* parent) :
     _pwd(""),
     _parent(parent),
     _children(),
-    _mutex()
+    _mutex(),
+    _index(nullptr)
 {
     if (_parent != nullptr) {
-        if (_parent->_name != "ROOT") {
+        if (_parent->_parent != nullptr) {
             _pwd = _parent->_pwd + separator + name;
         } else {
             _pwd = name;
         }
+        _index = _parent->_index;
+    } else {
+        _index = new PathIndex<IONode>();
     }
     BaseNode<ValueNode>::pwd = _pwd;
     BaseNode<CommandNode>::pwd = _pwd;
@@ -77,6 +84,9 @@ IONode::~IONode()
     for (const auto& it : _children) {
         delete it.second;
     }
+    if (_parent == nullptr) {
+        delete _index;
+    }
 }
         
 const std::string& IONode::name() const
@@ -187,7 +197,7 @@ void IONode::newChild(const std::string& name)
 
     std::lock_guard<std::mutex> lock(_mutex);
     if (_children.count(name) == 0) {
-        _children[name] = new IONode(name, this);
+        newChildNode(name);
     }
 }
         
@@ -277,7 +287,7 @@ void IONode::load(const std::string& path)
             list[i] != "." && list[i] != ".." && 
             _children.count(list[i]) == 0
         ) {
-            _children[list[i]] = new IONode(list[i], this);
+            newChildNode(list[i]);
         }
     }
     
@@ -322,8 +332,14 @@ IONode::IONode(const IONode& node) :
     _pwd(node._pwd),
     _parent(node._parent),
     _children(node._children),
-    _mutex()
+    _mutex(),
+    _index(nullptr)
 {
+    if (_parent != nullptr) {
+        _index = node._index;
+    } else {
+        _index = new PathIndex<IONode>();
+    }
     BaseNode<ValueNode>::pwd = _pwd;
     BaseNode<CommandNode>::pwd = _pwd;
     BaseNode<StreamNode>::pwd = _pwd;
@@ -371,52 +387,199 @@ IONode* IONode::forwardChildren(
     const std::string& name, std::string& newName,
     bool createBranch)
 {
-    IONode* pt = this;
-    bool isSubNode = false;
-    size_t pos = 0;
+    //Leading separator is only allowed from root
+    size_t posBegin = 0;
+    if (name.length() > 0 && name[0] == separator) {
+        if (_parent == nullptr) {
+            posBegin = 1;
+        } else {
+            throw std::logic_error("RhIO invalid name: " + name);
+        }
+    }
+    size_t posEnd = name.find_last_of(separator);
+    if (posEnd == std::string::npos) {
+        return nullptr;
+    }
+    if (posEnd < posBegin) {
+        newName = name.substr(posBegin);
+        return this;
+    }
+
+    //Fast path: lookup the whole branch 
+    //absolute name into the path index
+    IONode* pt = nullptr;
+    if (_parent == nullptr) {
+        pt = _index->find(name.substr(posBegin, posEnd-posBegin));
+    } else {
+        pt = _index->find(_pwd + separator + name.substr(0, posEnd));
+    }
+    if (pt != nullptr) {
+        newName = name.substr(posEnd+1);
+        return pt;
+    }
+
+    //Slow path: walk the tree (and create 
+    //the missing branch if asked)
+    pt = this;
+    size_t pos = posBegin;
     while (true) {
         size_t p = name.find_first_of(separator, pos);
         if (p == std::string::npos) {
-            if (isSubNode) {
-                newName = name.substr(pos);
-            }
+            newName = name.substr(pos);
             break;
         } else {
-            isSubNode = true;
-            if (p == 0) {
-                if (_parent == nullptr) {
-                    pos++;
-                    continue;
-                } else {
-                    throw std::logic_error("RhIO invalid name: " + name);
-                }
-            }
             std::string part = name.substr(pos, p-pos);
             pos = p+1;
-            if (createBranch) {
-                std::lock_guard<std::mutex> lock(pt->_mutex);
-                if (pt->_children.count(part) == 0) {
-                    pt->_children[part] = new IONode(part, pt);
-                }
+            std::lock_guard<std::mutex> lock(pt->_mutex);
+            auto it = pt->_children.find(part);
+            if (it != pt->_children.end()) {
+                pt = it->second;
+            } else if (createBranch) {
+                pt = pt->newChildNode(part);
             } else {
-                std::lock_guard<std::mutex> lock(_mutex);
-                if (pt->_children.count(part) == 0) {
-                    throw std::logic_error(
-                      "RhIO unknown node name: '" + part  + "' in '" + pwd() + "'");
+                throw std::logic_error(
+                  "RhIO unknown node name: '" + part  + "' in '" + pt->pwd() + "'");
+            }
+        }
+    }
+
+    return pt;
+}
+        
+IONode* IONode::newChildNode(const std::string& name)
+{
+    IONode* node = new IONode(name, this);
+    _children[name] = node;
+    _index->insert(node->_pwd, node);
+
+    return node;
+}
+        
+/**
+ * Maximum number of snapshot copy attempts
+ * while concurrent writes are detected
+ */
+static const size_t MaxSnapshotAttempts = 1000;
+
+Snapshot IONode::snapshot(const std::string& name) const
+{
+    //Retrieve all nodes of the subtree
+    const IONode* node = this;
+    if (name != "" && name != "/") {
+        node = &(child(name));
+    }
+    std::vector<const IONode*> nodes;
+    node->listSubtree(nodes);
+
+    //Retrieve all values structure
+    std::vector<const ValueHotBool*> listBool;
+    std::vector<const ValueHotInt*> listInt;
+    std::vector<const ValueHotFloat*> listFloat;
+    std::vector<const ValueHotStr*> listStr;
+    std::vector<const ValueHotFloatArray*> listFloatArray;
+    for (const IONode* n : nodes) {
+        n->listValuesPtr(listBool, listInt, 
+            listFloat, listStr, listFloatArray);
+    }
+
+    //Allocate the snapshot
+    Snapshot snapshot;
+    snapshot.isConsistent = false;
+    snapshot.valuesBool.resize(listBool.size());
+    snapshot.valuesInt.resize(listInt.size());
+    snapshot.valuesFloat.resize(listFloat.size());
+    snapshot.valuesStr.resize(listStr.size());
+    snapshot.valuesFloatArray.resize(listFloatArray.size());
+    for (size_t i=0;i<listBool.size();i++) {
+        snapshot.valuesBool[i].name = PathRegistry::path(listBool[i]->id);
+    }
+    for (size_t i=0;i<listInt.size();i++) {
+        snapshot.valuesInt[i].name = PathRegistry::path(listInt[i]->id);
+    }
+    for (size_t i=0;i<listFloat.size();i++) {
+        snapshot.valuesFloat[i].name = PathRegistry::path(listFloat[i]->id);
+    }
+    for (size_t i=0;i<listStr.size();i++) {
+        snapshot.valuesStr[i].name = PathRegistry::path(listStr[i]->id);
+    }
+    for (size_t i=0;i<listFloatArray.size();i++) {
+        snapshot.valuesFloatArray[i].name = 
+            PathRegistry::path(listFloatArray[i]->id);
+        snapshot.valuesFloatArray[i].value.resize(
+            listFloatArray[i]->value.size());
+    }
+
+    //Copy the values until no write has started
+    //or was in progress on any node during the copy
+    std::vector<uint64_t> countsBegin(nodes.size());
+    for (size_t k=0;k<MaxSnapshotAttempts;k++) {
+        bool isWriting = false;
+        for (size_t i=0;i<nodes.size();i++) {
+            uint64_t countEnd = nodes[i]->countWritesEnd();
+            countsBegin[i] = nodes[i]->countWritesBegin();
+            if (countsBegin[i] != countEnd) {
+                isWriting = true;
+            }
+        }
+        for (size_t i=0;i<listBool.size();i++) {
+            snapshot.valuesBool[i].value = listBool[i]->value.load();
+            snapshot.valuesBool[i].timestamp = 
+                listBool[i]->timestamp.load(std::memory_order_relaxed);
+        }
+        for (size_t i=0;i<listInt.size();i++) {
+            snapshot.valuesInt[i].value = listInt[i]->value.load();
+            snapshot.valuesInt[i].timestamp = 
+                listInt[i]->timestamp.load(std::memory_order_relaxed);
+        }
+        for (size_t i=0;i<listFloat.size();i++) {
+            snapshot.valuesFloat[i].value = listFloat[i]->value.load();
+            snapshot.valuesFloat[i].timestamp = 
+                listFloat[i]->timestamp.load(std::memory_order_relaxed);
+        }
+        for (size_t i=0;i<listStr.size();i++) {
+            snapshot.valuesStr[i].value = listStr[i]->value.load();
+            snapshot.valuesStr[i].timestamp = 
+                listStr[i]->timestamp.load(std::memory_order_relaxed);
+        }
+        for (size_t i=0;i<listFloatArray.size();i++) {
+            listFloatArray[i]->value.load(
+                snapshot.valuesFloatArray[i].value.data());
+            snapshot.valuesFloatArray[i].timestamp = listFloatArray[i]
+                ->timestamp.load(std::memory_order_relaxed);
+        }
+        if (!isWriting) {
+            bool isChanged = false;
+            for (size_t i=0;i<nodes.size();i++) {
+                if (nodes[i]->countWritesBegin() != countsBegin[i]) {
+                    isChanged = true;
                 }
             }
-            std::lock_guard<std::mutex> lock(_mutex);
-            pt = pt->_children.at(part);
+            if (!isChanged) {
+                snapshot.isConsistent = true;
+                break;
+            }
         }
+        std::this_thread::yield();
     }
 
-    if (isSubNode) {
-        return pt;
-    } else {
-        return nullptr;
+    return snapshot;
+}
+
+void IONode::listSubtree(std::vector<const IONode*>& nodes) const
+{
+    nodes.push_back(this);
+    std::vector<const IONode*> children;
+    {
+        std::lock_guard<std::mutex> lock(_mutex);
+        for (const auto& c : _children) {
+            children.push_back(c.second);
+        }
+    }
+    for (const IONode* c : children) {
+        c->listSubtree(nodes);
     }
 }
-        
+
 bool IONode::isNeededSave() const
 {
     std::lock_guard<std::mutex> lock(_mutex);
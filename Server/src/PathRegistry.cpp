@@ -0,0 +1,67 @@
+#include <atomic>
+#include <mutex>
+#include <stdexcept>
+#include <unordered_map>
+#include <functional>
+#include "rhio_server/PathRegistry.hpp"
+
+namespace RhIO {
+
+/**
+ * Paths are stored in fixed size chunks
+ * allocated on demand so that stored
+ * paths never move in memory
+ */
+static const size_t ChunkSize = 4096;
+static const size_t MaxChunks = 4096;
+
+/**
+ * Paths chunks storage, number of
+ * interned paths and path hash to id mapping
+ * (paths are only stored once in chunks)
+ */
+static std::atomic<std::string*> chunks[MaxChunks];
+static std::atomic<size_t> countPaths(0);
+static std::unordered_multimap<size_t, size_t> mapping;
+static std::mutex mutexRegistry;
+
+size_t PathRegistry::intern(const std::string& path)
+{
+    std::lock_guard<std::mutex> lock(mutexRegistry);
+
+    size_t hash = std::hash<std::string>()(path);
+    auto range = mapping.equal_range(hash);
+    for (auto it=range.first;it!=range.second;it++) {
+        if (PathRegistry::path(it->second) == path) {
+            return it->second;
+        }
+    }
+
+    size_t id = countPaths.load();
+    size_t indexChunk = id/ChunkSize;
+    if (indexChunk >= MaxChunks) {
+        throw std::logic_error(
+            "RhIO::PathRegistry::intern: too many values");
+    }
+    if (chunks[indexChunk].load() == nullptr) {
+        chunks[indexChunk].store(new std::string[ChunkSize]);
+    }
+    chunks[indexChunk].load()[id%ChunkSize] = path;
+    mapping.insert(std::make_pair(hash, id));
+    countPaths.store(id + 1);
+
+    return id;
+}
+
+const std::string& PathRegistry::path(size_t id)
+{
+    return chunks[id/ChunkSize].load()[id%ChunkSize];
+}
+
+size_t PathRegistry::size()
+{
+    return countPaths.load();
+}
+
+}
+
@@ -1,7 +1,10 @@
 #include <thread>
 #include <chrono>
 #include <atomic>
+#include <mutex>
 #include <stdexcept>
+#include <string>
+#include <cstdlib>
 #include <sys/prctl.h>
 #include <unistd.h>
 #include <signal.h>
@@ -9,6 +12,8 @@
 #include "rhio_server/ServerRep.hpp"
 #include "rhio_server/ServerPub.hpp"
 #include "rhio_server/ServerLog.hpp"
+#include "rhio_server/CallbackDispatcher.hpp"
+#include "rhio_server/Stats.hpp"
 
 namespace RhIO {
 
@@ -24,6 +29,16 @@ IONode Root("ROOT", nullptr);
 ServerPub* ServerStream = nullptr;
 ServerLog* ServerLogging = nullptr;
 
+/**
+ * Deferred callbacks dispatcher instance
+ * (never freed since the dispatcher thread may
+ * outlive static objects at exit)
+ * and default inline callback mode
+ */
+static CallbackDispatcher* dispatcherCallback = new CallbackDispatcher();
+std::atomic<CallbackDispatcher*> ServerCallback(nullptr);
+std::atomic<int64_t> ServerCallbackUsers(0);
+
 /**
  * Default initialization of 
  * time getter function
@@ -34,6 +49,15 @@ std::function<int64_t()> FuncGetTime =
             std::chrono::steady_clock::now().time_since_epoch()).count();
     };
 
+/**
+ * Default clock source, uncalibrated
+ * time stamp counter and unset
+ * thread cycle time
+ */
+TimeSource SourceGetTime = TimeSteady;
+TimeCalibrationTSC CalibrationTSC = {0, 0, 0.0};
+thread_local int64_t CycleTime = -1;
+
 /**
  * Atomic register storing the number
  * of initialized Server
@@ -55,8 +79,29 @@ static unsigned int portRep = PortServerRep;
 static unsigned int portPub = PortServerPub;
 static unsigned int period = 20;
 static unsigned int logLengthSecs = (unsigned int)-1;
+static size_t logCapacity = ServerLog::DefaultCapacity;
 static bool serverStarting = false;
 
+/**
+ * Publisher thread scheduling mode and
+ * event mode batching window in microseconds
+ */
+static std::atomic<PublishMode> publishMode(PublishPeriodic);
+static std::atomic<unsigned int> publishWindow(1000);
+
+/**
+ * Mutex protecting the statistics values 
+ * export by server threads from tree reset
+ */
+static std::mutex mutexStats;
+
+/**
+ * Callback dispatcher thread
+ * instance and quit state
+ */
+static std::thread* callbackThread = nullptr;
+static std::atomic<bool> callbackThreadOver(false);
+
 /**
  * In case of error exception in RhIO server 
  * threads, a signal is sent to self process.
@@ -85,6 +130,22 @@ static void raiseSignalAndHold(const std::string& msg)
     }
 }
 
+/**
+ * Return true and update given last time 
+ * if the statistics update period is elapsed
+ */
+static bool isStatsTime(int64_t& tsLast)
+{
+    int64_t now = std::chrono::duration_cast<std::chrono::microseconds>(
+        std::chrono::steady_clock::now().time_since_epoch()).count();
+    if (now - tsLast >= StatsPeriod) {
+        tsLast = now;
+        return true;
+    } else {
+        return false;
+    }
+}
+
 /**
  * Reply Server main loop handling
  * incomming Client request
@@ -134,7 +195,37 @@ static void runServerPub()
         //Set thread name
         prctl(PR_SET_NAME, "rhio_server_pub", 0, 0, 0);
 
+        int64_t tsLastSend = 0;
+        //First export after one period
+        int64_t tsStats = 0;
+        isStatsTime(tsStats);
         while (!serverThreadPubOver) {
+            //Export buffers statistics
+            if (isStatsTime(tsStats)) {
+                std::lock_guard<std::mutex> lock(mutexStats);
+                server.updateStats();
+                dispatcherCallback->updateStats();
+            }
+            if (publishMode.load() == PublishEvent) {
+                server.setWakeup(true);
+                //Wait for a published sample and let the
+                //following ones batch until the window 
+                //since last send is elapsed
+                if (server.waitForSamples(1000*(int64_t)period)) {
+                    int64_t elapsed = std::chrono::duration_cast<std::chrono::microseconds>(
+                        std::chrono::steady_clock::now().time_since_epoch()).count() 
+                        - tsLastSend;
+                    if (elapsed < (int64_t)publishWindow.load()) {
+                        std::this_thread::sleep_for(std::chrono::microseconds(
+                            publishWindow.load() - elapsed));
+                    }
+                }
+                tsLastSend = std::chrono::duration_cast<std::chrono::microseconds>(
+                    std::chrono::steady_clock::now().time_since_epoch()).count();
+                server.sendToClient();
+                continue;
+            }
+            server.setWakeup(false);
             int64_t tsStart = std::chrono::duration_cast<std::chrono::milliseconds>(
                 std::chrono::steady_clock::now().time_since_epoch()).count();
             server.sendToClient();
@@ -165,7 +256,7 @@ static void runServerLog()
 {
     try {
         //Allocating ServerLogging
-        ServerLog server;
+        ServerLog server(logCapacity);
         ServerLogging = &server;
         //Notify main thread 
         //for initialization ready
@@ -174,7 +265,15 @@ static void runServerLog()
         //Set thread name
         prctl(PR_SET_NAME, "rhio_server_log", 0, 0, 0);
 
+        //First export after one period
+        int64_t tsStats = 0;
+        isStatsTime(tsStats);
         while (!serverThreadLogOver) {
+            //Export buffers statistics
+            if (isStatsTime(tsStats)) {
+                std::lock_guard<std::mutex> lock(mutexStats);
+                server.updateStats();
+            }
             int64_t tsStart = std::chrono::duration_cast<std::chrono::milliseconds>(
                 std::chrono::steady_clock::now().time_since_epoch()).count();
             if (logLengthSecs == (unsigned int)-1) {
@@ -200,17 +299,88 @@ static void runServerLog()
         raiseSignalAndHold("");
     }
 }
+/**
+ * Callback dispatcher main loop calling
+ * deferred value callbacks
+ */
+static void runCallbackDispatcher()
+{
+    try {
+        //Set thread name
+        prctl(PR_SET_NAME, "rhio_callback", 0, 0, 0);
+
+        while (!callbackThreadOver.load()) {
+            //Poll for queued callbacks
+            if (dispatcherCallback->dispatch() == 0) {
+                std::this_thread::sleep_for(
+                    std::chrono::microseconds(500));
+            }
+        }
+    } catch (const std::string& e) {
+        raiseSignalAndHold(e);
+    } catch (const std::exception& e) {
+        raiseSignalAndHold(e.what());
+    } catch (...) {
+        raiseSignalAndHold("");
+    }
+}
+
+/**
+ * Wait for the callback
+ * dispatcher thread to stop
+ */
+static void stopCallbackThread()
+{
+    if (callbackThread != nullptr) {
+        callbackThreadOver.store(true);
+        callbackThread->join();
+        delete callbackThread;
+        callbackThread = nullptr;
+    }
+}
+
+/**
+ * Return the given log buffers capacity or
+ * if zero the RHIO_LOG_CAPACITY environment
+ * variable or the default capacity
+ */
+static size_t parseLogCapacity(size_t capacity)
+{
+    if (capacity != 0) {
+        return capacity;
+    }
+    const char* env = getenv("RHIO_LOG_CAPACITY");
+    if (env == nullptr) {
+        return ServerLog::DefaultCapacity;
+    }
+    std::string str(env);
+    size_t pos = 0;
+    try {
+        capacity = std::stoull(str, &pos);
+    } catch (const std::exception&) {
+        pos = 0;
+    }
+    if (capacity == 0 || pos != str.length()) {
+        throw std::logic_error(
+            "RhIO invalid RHIO_LOG_CAPACITY: " + str);
+    }
+
+    return capacity;
+}
+
 void start(
     unsigned int portRep_, 
     unsigned int portPub_, 
     unsigned int period_,
-    unsigned int logLengthSecs_)
+    unsigned int logLengthSecs_,
+    size_t logCapacity_)
 {
     serverStarting = true;
     portRep = portRep_;
     portPub = portPub_;
     period = period_;
     logLengthSecs = logLengthSecs_;
+    logCapacity = parseLogCapacity(logCapacity_);
 
     //Init atomic counter
     initServerCount = 0;
@@ -236,6 +406,7 @@ bool started()
 
 void stop()
 {
+    stopCallbackThread();
     if (initServerCount > 0) {
         //Wait the end of server thread
         serverThreadLogOver = true;
@@ -252,6 +423,10 @@ void stop()
 
 void reset()
 {
+    std::lock_guard<std::mutex> lock(mutexStats);
+    //Drop callbacks queued 
+    //on destroyed values
+    dispatcherCallback->clear();
     //Call destructor
     (&Root)->~IONode();
     //Call constructor with 
@@ -269,6 +444,69 @@ void writeLogs(const std::string& filepath)
 void setRhIOTimeFunc(std::function<int64_t()> func)
 {
     FuncGetTime = func;
+    SourceGetTime = TimeFunc;
+}
+
+void setRhIOTimeSource(TimeSource source)
+{
+#if defined(__x86_64__) || defined(__i386__)
+    if (source == TimeTSC) {
+        //Calibrate the time stamp counter 
+        //frequency against the monotonic clock
+        int64_t time1 = getRhIOClockPosix(CLOCK_MONOTONIC);
+        uint64_t ticks1 = __rdtsc();
+        std::this_thread::sleep_for(std::chrono::milliseconds(20));
+        int64_t time2 = getRhIOClockPosix(CLOCK_MONOTONIC);
+        uint64_t ticks2 = __rdtsc();
+        if (ticks2 <= ticks1 || time2 <= time1) {
+            throw std::runtime_error(
+                "RhIO unable to calibrate time stamp counter");
+        }
+        CalibrationTSC.originTicks = ticks2;
+        CalibrationTSC.originTime = time2;
+        CalibrationTSC.microsPerTick = 
+            (double)(time2 - time1)/(double)(ticks2 - ticks1);
+    }
+#endif
+    SourceGetTime = source;
+}
+
+void setCallbackMode(CallbackMode mode)
+{
+    stopCallbackThread();
+    if (mode == CallbackInline) {
+        ServerCallback.store(nullptr);
+        //Wait for the setters which loaded the
+        //dispatcher before to push their callback
+        while (ServerCallbackUsers.load() > 0) {
+            std::this_thread::yield();
+        }
+        //Flush remaining queued callbacks
+        dispatcherCallback->dispatch();
+    } else {
+        ServerCallback.store(dispatcherCallback);
+    }
+    if (mode == CallbackThread) {
+        callbackThreadOver.store(false);
+        callbackThread = new std::thread(runCallbackDispatcher);
+    }
+}
+
+void setPublishMode(PublishMode mode, 
+    unsigned int windowUs)
+{
+    publishWindow.store(windowUs);
+    publishMode.store(mode);
+}
+
+size_t dispatchCallbacks()
+{
+    return dispatcherCallback->dispatch();
+}
+
+uint64_t countDroppedCallbacks()
+{
+    return dispatcherCallback->getCountDropped();
 }
 
 /**
@@ -1,116 +1,179 @@
 #include <fstream>
 #include <stdexcept>
 #include "rhio_server/ServerLog.hpp"
+#include "rhio_server/PathRegistry.hpp"
+#include "rhio_server/Stats.hpp"
 
 namespace RhIO {
 
-ServerLog::ServerLog() :
-    _bufferBool(5000000),
-    _bufferInt(5000000),
-    _bufferFloat(5000000),
-    _bufferStr(5000000),
-    _mappingBool(),
-    _mappingInt(),
-    _mappingFloat(),
-    _mappingStr(),
+ServerLog::ServerLog(size_t capacity) :
+    _bufferBool(capacity, capacity, InitSize),
+    _bufferInt(capacity, capacity, InitSize),
+    _bufferFloat(capacity, capacity, InitSize),
+    _bufferStr(capacity, capacity, InitSize),
+    _bufferFloatArray(capacity, capacity, InitSize),
+    _droppedValues(PathRegistry::size()),
+    _isLoggedBool(),
+    _isLoggedInt(),
+    _isLoggedFloat(),
+    _isLoggedStr(),
+    _isLoggedFloatArray(),
     _valuesBool(),
     _valuesInt(),
     _valuesFloat(),
     _valuesStr(),
+    _valuesFloatArray(),
     _mutex()
 {
+    if (capacity == 0) {
+        throw std::logic_error(
+            "RhIO log buffer capacity must be positive");
+    }
 }
 
 void ServerLog::logBool(
-    const std::string& name, 
+    size_t id, 
     bool val, 
     int64_t timestamp)
 {
-    _bufferBool.appendFromWriter({name, timestamp, val});
+    if (!_bufferBool.appendFromWriter({id, timestamp, val})) {
+        _droppedValues.add(id);
+    }
 }
 void ServerLog::logInt(
-    const std::string& name, 
+    size_t id, 
     int64_t val, 
     int64_t timestamp)
 {
-    _bufferInt.appendFromWriter({name, timestamp, val});
+    if (!_bufferInt.appendFromWriter({id, timestamp, val})) {
+        _droppedValues.add(id);
+    }
 }
 void ServerLog::logFloat(
-    const std::string& name, 
+    size_t id, 
     double val, 
     int64_t timestamp)
 {
-    _bufferFloat.appendFromWriter({name, timestamp, val});
+    if (!_bufferFloat.appendFromWriter({id, timestamp, val})) {
+        _droppedValues.add(id);
+    }
 }
 void ServerLog::logStr(
-    const std::string& name, 
+    size_t id, 
     const std::string& val, 
     int64_t timestamp)
 {
-    _bufferStr.appendFromWriter({name, timestamp, val});
+    if (!_bufferStr.appendFromWriter({id, timestamp, val})) {
+        _droppedValues.add(id);
+    }
+}
+void ServerLog::logFloatArray(
+    size_t id, 
+    const double* data, 
+    size_t size,
+    int64_t timestamp)
+{
+    //Copy in place into the reserved cell
+    //to reuse its already allocated storage
+    bool isOk = _bufferFloatArray.appendBlockFromWriter(1, 
+        [id, data, size, timestamp](size_t i, LogValFloatArray& cell) {
+            (void)i;
+            cell.id = id;
+            cell.timestamp = timestamp;
+            cell.value.assign(data, data + size);
+        });
+    if (!isOk) {
+        _droppedValues.add(id);
+    }
+}
+        
+void ServerLog::logBatch(const ValueBatch& batch)
+{
+    appendBatch(_bufferBool, batch._updatesBool,
+        batch._updatesBool.size(), batch._timestamp);
+    appendBatch(_bufferInt, batch._updatesInt,
+        batch._updatesInt.size(), batch._timestamp);
+    appendBatch(_bufferFloat, batch._updatesFloat,
+        batch._updatesFloat.size(), batch._timestamp);
+    appendBatch(_bufferStr, batch._updatesStr,
+        batch._updatesStr.size(), batch._timestamp);
+    appendBatch(_bufferFloatArray, batch._updatesFloatArray,
+        batch._countFloatArray, batch._timestamp);
 }
         
 void ServerLog::tick(int64_t lengthHistory)
 {
     std::lock_guard<std::mutex> lock(_mutex);
     
+    //Grow the dropped samples counters
+    //with newly created values
+    _droppedValues.reserve(PathRegistry::size());
+
     //Swap double lock free 
     //buffer for all types
     _bufferBool.swapBufferFromReader();
     _bufferInt.swapBufferFromReader();
     _bufferFloat.swapBufferFromReader();
     _bufferStr.swapBufferFromReader();
+    _bufferFloatArray.swapBufferFromReader();
     
     //Reference on value buffer to be logged
-    const std::vector<LogNamedValBool>& bufBool = 
+    const std::vector<LogValBool>& bufBool = 
         _bufferBool.getBufferFromReader();
     size_t sizeBool = _bufferBool.getSizeFromReader();
-    const std::vector<LogNamedValInt>& bufInt = 
+    const std::vector<LogValInt>& bufInt = 
         _bufferInt.getBufferFromReader();
     size_t sizeInt = _bufferInt.getSizeFromReader();
-    const std::vector<LogNamedValFloat>& bufFloat = 
+    const std::vector<LogValFloat>& bufFloat = 
         _bufferFloat.getBufferFromReader();
     size_t sizeFloat = _bufferFloat.getSizeFromReader();
-    const std::vector<LogNamedValStr>& bufStr = 
+    const std::vector<LogValStr>& bufStr = 
         _bufferStr.getBufferFromReader();
     size_t sizeStr = _bufferStr.getSizeFromReader();
+    const std::vector<LogValFloatArray>& bufFloatArray = 
+        _bufferFloatArray.getBufferFromReader();
+    size_t sizeFloatArray = _bufferFloatArray.getSizeFromReader();
 
     //Log values
     for (size_t i=0;i<sizeBool;i++) {
-        if (_mappingBool.count(bufBool[i].name) == 0) {
-            _mappingBool.insert(std::make_pair(
-                bufBool[i].name, _mappingBool.size()));
+        size_t id = bufBool[i].id;
+        if (id >= _isLoggedBool.size()) {
+            _isLoggedBool.resize(id + 1, false);
         }
-        size_t id = _mappingBool.at(bufBool[i].name);
-        _valuesBool.push_back({
-            id, bufBool[i].timestamp, bufBool[i].value});
+        _isLoggedBool[id] = true;
+        _valuesBool.push_back(bufBool[i]);
     }
     for (size_t i=0;i<sizeInt;i++) {
-        if (_mappingInt.count(bufInt[i].name) == 0) {
-            _mappingInt.insert(std::make_pair(
-                bufInt[i].name, _mappingInt.size()));
+        size_t id = bufInt[i].id;
+        if (id >= _isLoggedInt.size()) {
+            _isLoggedInt.resize(id + 1, false);
         }
-        size_t id = _mappingInt.at(bufInt[i].name);
-        _valuesInt.push_back({
-            id, bufInt[i].timestamp, bufInt[i].value});
+        _isLoggedInt[id] = true;
+        _valuesInt.push_back(bufInt[i]);
     }
     for (size_t i=0;i<sizeFloat;i++) {
-        if (_mappingFloat.count(bufFloat[i].name) == 0) {
-            _mappingFloat.insert(std::make_pair(
-                bufFloat[i].name, _mappingFloat.size()));
+        size_t id = bufFloat[i].id;
+        if (id >= _isLoggedFloat.size()) {
+            _isLoggedFloat.resize(id + 1, false);
         }
-        size_t id = _mappingFloat.at(bufFloat[i].name);
-        _valuesFloat.push_back({
-            id, bufFloat[i].timestamp, bufFloat[i].value});
+        _isLoggedFloat[id] = true;
+        _valuesFloat.push_back(bufFloat[i]);
     }
     for (size_t i=0;i<sizeStr;i++) {
-        if (_mappingStr.count(bufStr[i].name) == 0) {
-            _mappingStr.insert(std::make_pair(
-                bufStr[i].name, _mappingStr.size()));
+        size_t id = bufStr[i].id;
+        if (id >= _isLoggedStr.size()) {
+            _isLoggedStr.resize(id + 1, false);
+        }
+        _isLoggedStr[id] = true;
+        _valuesStr.push_back(bufStr[i]);
+    }
+    for (size_t i=0;i<sizeFloatArray;i++) {
+        size_t id = bufFloatArray[i].id;
+        if (id >= _isLoggedFloatArray.size()) {
+            _isLoggedFloatArray.resize(id + 1, false);
         }
-        size_t id = _mappingStr.at(bufStr[i].name);
-        _valuesStr.push_back({
-            id, bufStr[i].timestamp, bufStr[i].value});
+        _isLoggedFloatArray[id] = true;
+        _valuesFloatArray.push_back(bufFloatArray[i]);
     }
 
     //Retrieve the last inserted timestamp
@@ -143,6 +206,13 @@ void ServerLog::tick(int64_t lengthHistory)
     ) {
         lastTime = _valuesStr.back().timestamp;
     }
+    if (
+        _valuesFloatArray.size() > 0 &&
+        (lastTime == (int64_t)-1 || 
+        _valuesFloatArray.back().timestamp > lastTime)
+    ) {
+        lastTime = _valuesFloatArray.back().timestamp;
+    }
 
     //Clamp history time length with respect to 
     //lastest inserted timestamp
@@ -171,24 +241,45 @@ void ServerLog::tick(int64_t lengthHistory)
         ) {
             _valuesStr.pop_front();
         }
+        while (
+            _valuesFloatArray.size() > 1 && 
+            _valuesFloatArray.front().timestamp < lastTime-lengthHistory
+        ) {
+            _valuesFloatArray.pop_front();
+        }
     }
 }
 
 void ServerLog::writeLogsToFile(const std::string& filepath)
 {
     std::lock_guard<std::mutex> lock(_mutex);
+    //Resolve logged values name
+    //to id mapping
+    std::map<std::string, size_t> mappingBool;
+    std::map<std::string, size_t> mappingInt;
+    std::map<std::string, size_t> mappingFloat;
+    std::map<std::string, size_t> mappingStr;
+    std::map<std::string, size_t> mappingFloatArray;
+    buildMapping(_isLoggedBool, mappingBool);
+    buildMapping(_isLoggedInt, mappingInt);
+    buildMapping(_isLoggedFloat, mappingFloat);
+    buildMapping(_isLoggedStr, mappingStr);
+    buildMapping(_isLoggedFloatArray, mappingFloatArray);
+
     std::ofstream file(filepath);
     if (file.is_open()) {
         RhIOWriteBinaryLog(
             file, 
-            _mappingBool,
-            _mappingInt,
-            _mappingFloat,
-            _mappingStr,
+            mappingBool,
+            mappingInt,
+            mappingFloat,
+            mappingStr,
+            mappingFloatArray,
             _valuesBool,
             _valuesInt,
             _valuesFloat,
-            _valuesStr);
+            _valuesStr,
+            _valuesFloatArray);
     } else {
         throw std::runtime_error(
             "RhIO::ServerLog::writeLogs: "
@@ -197,5 +288,53 @@ void ServerLog::writeLogsToFile(const std::string& filepath)
     }
 }
 
+template <typename T, typename U>
+void ServerLog::appendBatch(
+    LockFreeRingQueue<LogValue<T>>& buffer,
+    const std::vector<U>& updates,
+    size_t count,
+    int64_t timestamp)
+{
+    if (count == 0) {
+        return;
+    }
+    bool isOk = buffer.appendBlockFromWriter(count, 
+        [&updates, timestamp](size_t i, LogValue<T>& cell) {
+            cell.id = updates[i].ptrValue->id;
+            cell.timestamp = timestamp;
+            cell.value = updates[i].value;
+        });
+    if (!isOk) {
+        for (size_t i=0;i<count;i++) {
+            _droppedValues.add(updates[i].ptrValue->id);
+        }
+    }
+}
+
+void ServerLog::updateStats()
+{
+    statsQueue("log/bool", _bufferBool);
+    statsQueue("log/int", _bufferInt);
+    statsQueue("log/float", _bufferFloat);
+    statsQueue("log/str", _bufferStr);
+    statsQueue("log/floatArray", _bufferFloatArray);
+    statsValues("droppedLog", _droppedValues,
+        "Number of logged samples dropped because the buffer was full");
+    statsSetInt("log/droppedOther", _droppedValues.getOther(),
+        "Number of logged samples dropped of values without counter");
+}
+
+void ServerLog::buildMapping(
+    const std::vector<bool>& isLogged,
+    std::map<std::string, size_t>& mapping)
+{
+    for (size_t id=0;id<isLogged.size();id++) {
+        if (isLogged[id]) {
+            mapping.insert(std::make_pair(
+                PathRegistry::path(id), id));
+        }
+    }
+}
+
 }
 
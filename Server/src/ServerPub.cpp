@@ -1,10 +1,49 @@
+#include <cstring>
+#include <algorithm>
+#include <chrono>
+#include <random>
+#include <stdexcept>
+#include <unistd.h>
+#include <poll.h>
+#include <sys/eventfd.h>
 #include "rhio_server/ServerPub.hpp"
+#include "rhio_server/PathRegistry.hpp"
+#include "rhio_server/Stats.hpp"
 #include "rhio_common/Protocol.hpp"
 #include "rhio_common/DataBuffer.hpp"
 
 namespace RhIO {
 
-ServerPub::ServerPub(std::string endpoint) :
+/**
+ * Time in microseconds between 
+ * whole dictionary announcements
+ */
+static const int64_t DictionaryPeriod = 1000000;
+
+/**
+ * Maximum encoded size of 
+ * a variable length integer
+ */
+static const size_t CompactVarIntMax = 10;
+
+/**
+ * Minimum frame chunk data size
+ */
+static const size_t FrameChunkMin = 256;
+
+/**
+ * ZMQ release callback of frame chunk
+ * datagrams dropping one reference
+ * of their frame buffer
+ */
+static void releaseFrameChunk(void* data, void* hint)
+{
+    (void)data;
+    FrameBuffer* buffer = (FrameBuffer*)hint;
+    buffer->pool->release(buffer);
+}
+
+ServerPub::ServerPub(std::string endpoint, size_t packetSize) :
     _context(1),
     _socket(_context, ZMQ_RADIO),
     //Maximum buffer length memory allocation
@@ -12,12 +51,39 @@ ServerPub::ServerPub(std::string endpoint) :
     _bufferInt(10000),
     _bufferFloat(10000),
     _bufferStr(10000),
+    _bufferFloatArray(10000),
     _bufferStream(10000),
-    _isWritingTo1(true),
-    _queue1Frame(),
-    _queue2Frame(),
-    _mutexQueueFrame()
+    _latestBool(10000),
+    _latestInt(10000),
+    _latestFloat(10000),
+    _bufferFrame(1000),
+    _bufferPending(10000),
+    _pending(),
+    _droppedValues(PathRegistry::size()),
+    _droppedStream(0),
+    _packetSize(packetSize),
+    _packetData(),
+    _packetLength(0),
+    _packetCount(0),
+    _packetHeader(MsgStreamBatch),
+    _packetTimestamp(0),
+    _dictionaryTypes(),
+    _dictionaryIds(),
+    _dictionaryPending(),
+    _dictionaryRepeat(),
+    _dictionaryData(),
+    _dictionaryTime(0),
+    _sessionData(),
+    _sessionLength(0),
+    _wakeupFd(-1),
+    _isWakeup(false),
+    _isSignaled(false),
+    _frameSeq(0),
+    _sentPackets(0),
+    _sentBytes(0)
 {
+    //Reserve packing buffer with header
+    _packetData.resize(sizeof(MsgType) + _packetSize);
     if (endpoint == "") {
         std::stringstream ss;
         ss << "udp://" << AddressMulticast << ":" << PortServerPub;
@@ -25,79 +91,141 @@ ServerPub::ServerPub(std::string endpoint) :
     }
 
     _socket.connect(endpoint.c_str());
+
+    //Draw the session id announced 
+    //with the value dictionary
+    std::random_device random;
+    DataBuffer session(_sessionData, sizeof(_sessionData));
+    session.writeVarInt((uint32_t)random());
+    _sessionLength = session.offset();
+
+    _wakeupFd = eventfd(0, EFD_NONBLOCK);
+    if (_wakeupFd == -1) {
+        throw std::runtime_error(
+            "RhIO unable to create publisher wakeup event");
+    }
 }
 
-void ServerPub::publishBool(const std::string& name,
-    bool val, int64_t timestamp)
+ServerPub::~ServerPub()
 {
-    _bufferBool.appendFromWriter({name, val, timestamp});
+    close(_wakeupFd);
 }
-void ServerPub::publishInt(const std::string& name,
-    int64_t val, int64_t timestamp)
+
+void ServerPub::publishBool(size_t id,
+    bool val, int64_t timestamp, bool isLatest)
+{
+    if (!isLatest || !_latestBool.writeFromWriter(id, val, timestamp)) {
+        if (!_bufferBool.appendFromWriter({id, val, timestamp})) {
+            _droppedValues.add(id);
+        }
+    }
+    notifyWriter();
+}
+void ServerPub::publishInt(size_t id,
+    int64_t val, int64_t timestamp, bool isLatest)
 {
-    _bufferInt.appendFromWriter({name, val, timestamp});
+    if (!isLatest || !_latestInt.writeFromWriter(id, val, timestamp)) {
+        if (!_bufferInt.appendFromWriter({id, val, timestamp})) {
+            _droppedValues.add(id);
+        }
+    }
+    notifyWriter();
 }
-void ServerPub::publishFloat(const std::string& name,
-    double val, int64_t timestamp)
+void ServerPub::publishFloat(size_t id,
+    double val, int64_t timestamp, bool isLatest)
 {
-    _bufferFloat.appendFromWriter({name, val, timestamp});
+    if (!isLatest || !_latestFloat.writeFromWriter(id, val, timestamp)) {
+        if (!_bufferFloat.appendFromWriter({id, val, timestamp})) {
+            _droppedValues.add(id);
+        }
+    }
+    notifyWriter();
 }
-void ServerPub::publishStr(const std::string& name,
+void ServerPub::publishStr(size_t id,
     const std::string& val, int64_t timestamp)
 {
-    _bufferStr.appendFromWriter({name, val, timestamp});
+    if (!_bufferStr.appendFromWriter({id, val, timestamp})) {
+        _droppedValues.add(id);
+    }
+    notifyWriter();
+}
+void ServerPub::publishFloatArray(size_t id,
+    const double* data, size_t size, int64_t timestamp)
+{
+    //Copy in place into the reserved cell
+    //to reuse its already allocated storage
+    bool isOk = _bufferFloatArray.appendBlockFromWriter(1, 
+        [id, data, size, timestamp](size_t i, PubValFloatArray& cell) {
+            (void)i;
+            cell.id = id;
+            cell.value.assign(data, data + size);
+            cell.timestamp = timestamp;
+        });
+    if (!isOk) {
+        _droppedValues.add(id);
+    }
+    notifyWriter();
+}
+
+bool ServerPub::publishPending(size_t id)
+{
+    return _bufferPending.appendFromWriter(id);
+}
+
+void ServerPub::publishBatch(const ValueBatch& batch)
+{
+    appendLatest(_latestBool, _bufferBool, batch._updatesBool,
+        batch._timestamp);
+    appendLatest(_latestInt, _bufferInt, batch._updatesInt,
+        batch._timestamp);
+    appendLatest(_latestFloat, _bufferFloat, batch._updatesFloat,
+        batch._timestamp);
+    appendBatch(_bufferBool, _latestBool.size(), batch._updatesBool,
+        batch._updatesBool.size(), batch._timestamp);
+    appendBatch(_bufferInt, _latestInt.size(), batch._updatesInt,
+        batch._updatesInt.size(), batch._timestamp);
+    appendBatch(_bufferFloat, _latestFloat.size(), batch._updatesFloat,
+        batch._updatesFloat.size(), batch._timestamp);
+    appendBatch(_bufferStr, 0, batch._updatesStr,
+        batch._updatesStr.size(), batch._timestamp);
+    appendBatch(_bufferFloatArray, 0, batch._updatesFloatArray,
+        batch._countFloatArray, batch._timestamp);
+    notifyWriter();
 }
 
 void ServerPub::publishStream(const std::string& name,
     const std::string& val, int64_t timestamp)
 {
-    _bufferStream.appendFromWriter({name, val, timestamp});
+    if (!_bufferStream.appendFromWriter({name, val, timestamp})) {
+        _droppedStream.fetch_add(1, std::memory_order_relaxed);
+    }
+    notifyWriter();
 }
 
-void ServerPub::publishFrame(const std::string& name,
-    size_t width, size_t height,
-    unsigned char* data, size_t size,
-    int64_t timestamp)
+void ServerPub::publishFrame(FrameBuffer* buffer)
 {
-    //Directly allocate message data
-    std::lock_guard<std::mutex> lock(_mutexQueueFrame);
-    if (_isWritingTo1) {
-        _queue1Frame.clear();
-        _queue1Frame.push_back(zmq::message_t(
-            sizeof(MsgType)
-            + sizeof(int64_t)
-            + name.length()
-            + 4*sizeof(int64_t)
-            + size
-        ));
-        DataBuffer pub(_queue1Frame.back().data(), _queue1Frame.back().size());
-        pub.writeType(MsgStreamFrame);
-        pub.writeStr(name);
-        pub.writeInt(timestamp);
-        pub.writeInt((uint64_t)width);
-        pub.writeInt((uint64_t)height);
-        pub.writeData(data, size);
-    } else {
-        _queue2Frame.clear();
-        _queue2Frame.push_back(zmq::message_t(
-            sizeof(MsgType)
-            + sizeof(int64_t)
-            + name.length()
-            + 4*sizeof(int64_t)
-            + size
-        ));
-        DataBuffer pub(_queue2Frame.back().data(), _queue2Frame.back().size());
-        pub.writeType(MsgStreamFrame);
-        pub.writeStr(name);
-        pub.writeInt(timestamp);
-        pub.writeInt((uint64_t)width);
-        pub.writeInt((uint64_t)height);
-        pub.writeData(data, size);
+    //Only the first pending frame since
+    //last sent one announces the pool
+    FramePool* pool = buffer->pool;
+    if (pool->publish(buffer)) {
+        //Drop the frame if the queue is full
+        if (!_bufferFrame.appendFromWriter(pool)) {
+            pool->discard();
+        }
+        notifyWriter();
     }
 }
 
 void ServerPub::sendToClient()
 {
+    //Grow the dropped samples counters
+    //with newly created values
+    _droppedValues.reserve(PathRegistry::size());
+    //Publish expired rate limited samples
+    flushPending();
+    //Rearm the writers wakeup signal before
+    //swapping so that no later sample is missed
+    _isSignaled.store(false);
     //Swap double buffer
     //Later network communication is lock-free
     swapBuffer();
@@ -111,109 +239,180 @@ void ServerPub::sendToClient()
     size_t sizeFloat = _bufferFloat.getSizeFromReader();
     const std::vector<PubValStr>& bufStr = _bufferStr.getBufferFromReader();
     size_t sizeStr = _bufferStr.getSizeFromReader();
-    const std::vector<PubValStr>& bufStream = _bufferStream.getBufferFromReader();
+    const std::vector<PubValFloatArray>& bufFloatArray = _bufferFloatArray.getBufferFromReader();
+    size_t sizeFloatArray = _bufferFloatArray.getSizeFromReader();
+    const std::vector<PubStream>& bufStream = _bufferStream.getBufferFromReader();
     size_t sizeStream = _bufferStream.getSizeFromReader();
-    std::list<zmq::message_t>& queueFrame =
-        (_isWritingTo1) ? _queue2Frame : _queue1Frame;
+    const std::vector<FramePool*>& bufFrame = _bufferFrame.getBufferFromReader();
+    size_t sizeFrame = _bufferFrame.getSizeFromReader();
+
+    //Periodically repeat the whole dictionary
+    //for late joining or lossy clients
+    int64_t now = std::chrono::duration_cast<std::chrono::microseconds>(
+        std::chrono::steady_clock::now().time_since_epoch()).count();
+    if (now - _dictionaryTime >= DictionaryPeriod) {
+        _dictionaryTime = now;
+        sendDictionary(_dictionaryIds);
+    } else if (_dictionaryRepeat.size() > 0) {
+        //Repeat the entries announced
+        //during the previous cycle
+        sendDictionary(_dictionaryRepeat);
+    }
+    _dictionaryRepeat.clear();
 
     //Sending values Bool
     for (size_t i=0;i<sizeBool;i++) {
-        //Allocate message data
-        zmq::message_t packet(
-            sizeof(MsgType) + sizeof(int64_t)
-            + bufBool[i].name.length()
-            + sizeof(int64_t) + sizeof(uint8_t));
-        DataBuffer pub(packet.data(), packet.size());
-        pub.writeType(MsgStreamBool);
-        pub.writeStr(bufBool[i].name);
-        pub.writeInt(bufBool[i].timestamp);
-        pub.writeBool(bufBool[i].value);
-
-        //Send packet
-        packet.set_group("rhio");
-        _socket.send(packet);
+        packBool(bufBool[i].id, bufBool[i].value, bufBool[i].timestamp);
+    }
+    //Sending latest values Bool
+    for (size_t i=0;i<_latestBool.getSizeFromReader();i++) {
+        size_t id;
+        bool val;
+        int64_t timestamp;
+        _latestBool.readFromReader(i, id, val, timestamp);
+        packBool(id, val, timestamp);
     }
     //Sending values Int
     for (size_t i=0;i<sizeInt;i++) {
-        //Allocate message data
-        zmq::message_t packet(
-            sizeof(MsgType) + sizeof(int64_t)
-            + bufInt[i].name.length()
-            + sizeof(int64_t) + sizeof(int64_t));
-        DataBuffer pub(packet.data(), packet.size());
-        pub.writeType(MsgStreamInt);
-        pub.writeStr(bufInt[i].name);
-        pub.writeInt(bufInt[i].timestamp);
-        pub.writeInt(bufInt[i].value);
-
-        //Send packet
-        packet.set_group("rhio");
-        _socket.send(packet);
+        packInt(bufInt[i].id, bufInt[i].value, bufInt[i].timestamp);
+    }
+    //Sending latest values Int
+    for (size_t i=0;i<_latestInt.getSizeFromReader();i++) {
+        size_t id;
+        int64_t val;
+        int64_t timestamp;
+        _latestInt.readFromReader(i, id, val, timestamp);
+        packInt(id, val, timestamp);
     }
     //Sending values Float
     for (size_t i=0;i<sizeFloat;i++) {
-        //Allocate message data
-        zmq::message_t packet(
-            sizeof(MsgType) + sizeof(int64_t)
-            + bufFloat[i].name.length()
-            + sizeof(int64_t) + sizeof(double));
-        DataBuffer pub(packet.data(), packet.size());
-        pub.writeType(MsgStreamFloat);
-        pub.writeStr(bufFloat[i].name);
-        pub.writeInt(bufFloat[i].timestamp);
-        pub.writeFloat(bufFloat[i].value);
-
-        //Send packet
-        packet.set_group("rhio");
-        _socket.send(packet);
+        packFloat(bufFloat[i].id, bufFloat[i].value, bufFloat[i].timestamp);
+    }
+    //Sending latest values Float
+    for (size_t i=0;i<_latestFloat.getSizeFromReader();i++) {
+        size_t id;
+        double val;
+        int64_t timestamp;
+        _latestFloat.readFromReader(i, id, val, timestamp);
+        packFloat(id, val, timestamp);
     }
     //Sending values Str
     for (size_t i=0;i<sizeStr;i++) {
-        //Allocate message data
-        zmq::message_t packet(
-            sizeof(MsgType) + sizeof(int64_t)
-            + bufStr[i].name.length()
-            + sizeof(int64_t) + sizeof(int64_t)
-            + bufStr[i].value.length());
-        DataBuffer pub(packet.data(), packet.size());
-        pub.writeType(MsgStreamStr);
-        pub.writeStr(bufStr[i].name);
-        pub.writeInt(bufStr[i].timestamp);
-        pub.writeStr(bufStr[i].value);
-
-        //Send packet
-        packet.set_group("rhio");
-        _socket.send(packet);
+        packStr(bufStr[i].id, bufStr[i].value, bufStr[i].timestamp);
+    }
+    //Sending values FloatArray
+    for (size_t i=0;i<sizeFloatArray;i++) {
+        packFloatArray(bufFloatArray[i].id, 
+            bufFloatArray[i].value, bufFloatArray[i].timestamp);
     }
     //Sending values Stream
     for (size_t i=0;i<sizeStream;i++) {
-        //Allocate message data
-        zmq::message_t packet(
+        //Reserve sample record in packed datagram
+        DataBuffer pub = packetRecord(
             sizeof(MsgType) + sizeof(int64_t)
             + bufStream[i].name.length()
             + sizeof(int64_t) + sizeof(int64_t)
             + bufStream[i].value.length());
-        DataBuffer pub(packet.data(), packet.size());
         pub.writeType(MsgStreamStream);
         pub.writeStr(bufStream[i].name);
         pub.writeInt(bufStream[i].timestamp);
         pub.writeStr(bufStream[i].value);
-
-        //Send packet
-        packet.set_group("rhio");
-        _socket.send(packet);
     }
+    //Send last partially filled datagram
+    packetFlush();
     //Sending values Frame
-    while (!queueFrame.empty()) {
-        //Send packet
-        queueFrame.front().set_group("rhio");
-        _socket.send(queueFrame.front());
+    for (size_t i=0;i<sizeFrame;i++) {
+        //Send the newest frame
+        FrameBuffer* buffer = bufFrame[i]->take();
+        if (buffer != nullptr) {
+            sendFrame(buffer);
+        }
+        bufFrame[i]->updateCounters();
+    }
+}
 
-        //Pop value
-        queueFrame.pop_front();
+void ServerPub::setWakeup(bool isEnabled)
+{
+    _isWakeup.store(isEnabled);
+}
+
+bool ServerPub::waitForSamples(int64_t timeout)
+{
+    struct pollfd fd;
+    fd.fd = _wakeupFd;
+    fd.events = POLLIN;
+    fd.revents = 0;
+    struct timespec ts;
+    ts.tv_sec = timeout/1000000;
+    ts.tv_nsec = (timeout%1000000)*1000;
+    int ret = ppoll(&fd, 1, &ts, nullptr);
+    if (ret > 0) {
+        //Reset the event counter
+        uint64_t count;
+        if (read(_wakeupFd, &count, sizeof(count)) != sizeof(count)) {
+            return false;
+        }
+        return true;
+    } else {
+        return false;
     }
 }
 
+void ServerPub::flushPending()
+{
+    _bufferPending.swapBufferFromReader();
+    const std::vector<size_t>& bufPending = _bufferPending.getBufferFromReader();
+    size_t sizePending = _bufferPending.getSizeFromReader();
+    _pending.insert(_pending.end(), 
+        bufPending.begin(), bufPending.begin() + sizePending);
+    if (_pending.size() == 0) {
+        return;
+    }
+    //Keep the samples still pending
+    int64_t timestamp = getRhIOTime();
+    size_t count = 0;
+    for (size_t i=0;i<_pending.size();i++) {
+        bool isDone = true;
+        try {
+            isDone = RhIO::Root.flushStreamingValue(
+                PathRegistry::path(_pending[i]), timestamp);
+        } catch (const std::logic_error& e) {
+            //Deleted value
+        }
+        if (!isDone) {
+            _pending[count] = _pending[i];
+            count++;
+        }
+    }
+    _pending.resize(count);
+}
+
+void ServerPub::updateStats()
+{
+    statsQueue("pub/bool", _bufferBool);
+    statsQueue("pub/int", _bufferInt);
+    statsQueue("pub/float", _bufferFloat);
+    statsQueue("pub/str", _bufferStr);
+    statsQueue("pub/floatArray", _bufferFloatArray);
+    statsQueue("pub/stream", _bufferStream);
+    statsQueue("pub/frame", _bufferFrame);
+    statsValues("droppedPub", _droppedValues,
+        "Number of streamed samples dropped because the buffer was full");
+    statsSetInt("pub/droppedOther", _droppedValues.getOther(),
+        "Number of streamed samples dropped of values without counter");
+    statsSetInt("pub/droppedStream", _droppedStream.load(),
+        "Number of text stream samples dropped because the buffer was full");
+}
+
+uint64_t ServerPub::getSentPackets() const
+{
+    return _sentPackets;
+}
+uint64_t ServerPub::getSentBytes() const
+{
+    return _sentBytes;
+}
+
 void ServerPub::swapBuffer()
 {
     //Lock all publisher buffer for all types
@@ -221,11 +420,345 @@ void ServerPub::swapBuffer()
     _bufferInt.swapBufferFromReader();
     _bufferFloat.swapBufferFromReader();
     _bufferStr.swapBufferFromReader();
+    _bufferFloatArray.swapBufferFromReader();
     _bufferStream.swapBufferFromReader();
-    std::lock_guard<std::mutex> lockFrame(_mutexQueueFrame);
-    //Swap buffer
-    _isWritingTo1 = !_isWritingTo1;
+    _latestBool.swapBufferFromReader();
+    _latestInt.swapBufferFromReader();
+    _latestFloat.swapBufferFromReader();
+    _bufferFrame.swapBufferFromReader();
+}
+
+void ServerPub::notifyWriter()
+{
+    if (
+        _isWakeup.load(std::memory_order_relaxed) && 
+        !_isSignaled.load() &&
+        !_isSignaled.exchange(true)
+    ) {
+        uint64_t count = 1;
+        if (write(_wakeupFd, &count, sizeof(count)) != sizeof(count)) {
+            //Event counter overflow,
+            //the publisher is already signaled
+        }
+    }
+}
+
+DataBuffer ServerPub::packetReserve(size_t size, MsgType header)
+{
+    //Send current datagram if the new record 
+    //does not fit in or has another format
+    if (
+        _packetCount > 0 && 
+        (_packetHeader != header || _packetLength + size > _packetSize)
+    ) {
+        packetFlush();
+    }
+    _packetHeader = header;
+    //Grow the buffer for records 
+    //larger than a datagram
+    size_t offset = sizeof(MsgType) + _packetLength;
+    if (_packetData.size() < offset + size) {
+        _packetData.resize(offset + size);
+    }
+
+    return DataBuffer(_packetData.data() + offset, size);
+}
+
+void ServerPub::packetCommit(size_t size)
+{
+    _packetLength += size;
+    _packetCount++;
+}
+
+DataBuffer ServerPub::packetRecord(size_t size)
+{
+    DataBuffer pub = packetReserve(size, MsgStreamBatch);
+    packetCommit(size);
+
+    return pub;
+}
+
+void ServerPub::packetFlush()
+{
+    if (_packetCount == 0) {
+        return;
+    }
+    //Announce new values before 
+    //their first compact samples
+    if (
+        _packetHeader == MsgStreamCompact && 
+        _dictionaryPending.size() > 0
+    ) {
+        sendDictionary(_dictionaryPending);
+        _dictionaryRepeat.insert(_dictionaryRepeat.end(),
+            _dictionaryPending.begin(), _dictionaryPending.end());
+        _dictionaryPending.clear();
+    }
+    //A single batch record is sent as is
+    //and other datagrams with their header
+    size_t offset = 0;
+    if (_packetHeader == MsgStreamBatch && _packetCount == 1) {
+        offset = sizeof(MsgType);
+    } else {
+        _packetData[0] = _packetHeader;
+    }
+    sendPacket(_packetData.data() + offset, 
+        sizeof(MsgType) + _packetLength - offset,
+        _packetHeader == MsgStreamCompact);
+    _packetLength = 0;
+    _packetCount = 0;
+    _packetTimestamp = 0;
 }
 
+void ServerPub::sendPacket(const uint8_t* data, 
+    size_t size, bool isSession)
+{
+    size_t sizeSession = isSession ? _sessionLength : 0;
+    zmq::message_t packet(size + sizeSession);
+    uint8_t* dst = (uint8_t*)packet.data();
+    if (isSession) {
+        dst[0] = data[0];
+        std::memcpy(dst + sizeof(MsgType), _sessionData, sizeSession);
+        std::memcpy(dst + sizeof(MsgType) + sizeSession, 
+            data + sizeof(MsgType), size - sizeof(MsgType));
+    } else {
+        std::memcpy(dst, data, size);
+    }
+    packet.set_group("rhio");
+    _sentPackets++;
+    _sentBytes += size + sizeSession;
+    _socket.send(packet);
+}
+
+void ServerPub::sendDictionary(const std::vector<size_t>& ids)
+{
+    size_t length = sizeof(MsgType);
+    for (size_t i=0;i<ids.size();i++) {
+        const std::string& name = PathRegistry::path(ids[i]);
+        size_t size = CompactVarIntMax + sizeof(MsgType) 
+            + CompactVarIntMax + name.length();
+        //Send current datagram if the entry does not fit in
+        if (length > sizeof(MsgType) && length + size > _packetSize) {
+            _dictionaryData[0] = MsgStreamDictionary;
+            sendPacket(_dictionaryData.data(), length, true);
+            length = sizeof(MsgType);
+        }
+        if (_dictionaryData.size() < length + size) {
+            _dictionaryData.resize(length + size);
+        }
+        DataBuffer pub(_dictionaryData.data() + length, size);
+        pub.writeVarInt(ids[i]);
+        pub.writeType(_dictionaryTypes[ids[i]]);
+        pub.writeVarInt(name.length());
+        pub.writeRaw(name.data(), name.length());
+        length += pub.offset();
+    }
+    if (length > sizeof(MsgType)) {
+        _dictionaryData[0] = MsgStreamDictionary;
+        sendPacket(_dictionaryData.data(), length, true);
+    }
+}
+
+void ServerPub::sendFrame(FrameBuffer* frame)
+{
+    //Chunk data size fitting in
+    //a datagram with its header
+    const std::string& name = frame->pool->name();
+    size_t sizeHeader = sizeof(MsgType) 
+        + CompactVarIntMax + name.length()
+        + 7*CompactVarIntMax;
+    size_t sizeChunk = FrameChunkMin;
+    if (_packetSize > sizeHeader + FrameChunkMin) {
+        sizeChunk = _packetSize - sizeHeader;
+    }
+    size_t size = frame->size;
+    size_t count = (size + sizeChunk - 1)/sizeChunk;
+    if (count == 0) {
+        count = 1;
+    }
+    //Only grow the chunk datagrams storage if needed
+    size_t stride = sizeHeader + sizeChunk;
+    if (frame->packets.size() < count*stride) {
+        frame->packets.resize(count*stride);
+    }
+
+    _frameSeq++;
+    //Each chunk datagram holds a reference
+    //released once sent by ZMQ
+    frame->pool->retain(frame, count);
+    for (size_t i=0;i<count;i++) {
+        size_t offset = i*sizeChunk;
+        size_t length = std::min(sizeChunk, size - offset);
+        uint8_t* packet = frame->packets.data() + i*stride;
+        DataBuffer pub(packet, stride);
+        pub.writeType(MsgStreamFrameChunk);
+        pub.writeVarInt(name.length());
+        pub.writeRaw(name.data(), name.length());
+        pub.writeVarInt(_frameSeq);
+        pub.writeVarIntSigned(frame->timestamp);
+        pub.writeVarInt(frame->width);
+        pub.writeVarInt(frame->height);
+        pub.writeVarInt(size);
+        pub.writeVarInt(i);
+        pub.writeVarInt(count);
+        pub.writeRaw(frame->data.data() + offset, length);
+        zmq::message_t message(packet, pub.offset(), 
+            releaseFrameChunk, frame);
+        message.set_group("rhio");
+        _sentPackets++;
+        _sentBytes += pub.offset();
+        _socket.send(message);
+    }
+    //Drop the publisher reference
+    frame->pool->release(frame);
 }
 
+void ServerPub::packCompact(DataBuffer& pub, 
+    size_t id, MsgType type, int64_t timestamp)
+{
+    //Register values not yet announced
+    if (id >= _dictionaryTypes.size()) {
+        _dictionaryTypes.resize(id + 1, 0);
+    }
+    if (_dictionaryTypes[id] != type) {
+        if (_dictionaryTypes[id] == 0) {
+            _dictionaryIds.push_back(id);
+        }
+        _dictionaryTypes[id] = type;
+        _dictionaryPending.push_back(id);
+    }
+    //Write value id and timestamp delta
+    pub.writeVarInt(id);
+    pub.writeVarIntSigned(timestamp - _packetTimestamp);
+    _packetTimestamp = timestamp;
+}
+
+void ServerPub::packBool(size_t id, bool val, int64_t timestamp)
+{
+    DataBuffer pub = packetReserve(
+        2*CompactVarIntMax + sizeof(uint8_t), MsgStreamCompact);
+    packCompact(pub, id, MsgStreamBool, timestamp);
+    pub.writeBool(val);
+    packetCommit(pub.offset());
+}
+void ServerPub::packInt(size_t id, int64_t val, int64_t timestamp)
+{
+    DataBuffer pub = packetReserve(
+        3*CompactVarIntMax, MsgStreamCompact);
+    packCompact(pub, id, MsgStreamInt, timestamp);
+    pub.writeVarIntSigned(val);
+    packetCommit(pub.offset());
+}
+void ServerPub::packFloat(size_t id, double val, int64_t timestamp)
+{
+    DataBuffer pub = packetReserve(
+        2*CompactVarIntMax + sizeof(double), MsgStreamCompact);
+    packCompact(pub, id, MsgStreamFloat, timestamp);
+    pub.writeFloat(val);
+    packetCommit(pub.offset());
+}
+void ServerPub::packStr(size_t id, 
+    const std::string& val, int64_t timestamp)
+{
+    DataBuffer pub = packetReserve(
+        3*CompactVarIntMax + val.length(), MsgStreamCompact);
+    packCompact(pub, id, MsgStreamStr, timestamp);
+    pub.writeVarInt(val.length());
+    pub.writeRaw(val.data(), val.length());
+    packetCommit(pub.offset());
+}
+void ServerPub::packFloatArray(size_t id, 
+    const std::vector<double>& val, int64_t timestamp)
+{
+    DataBuffer pub = packetReserve(
+        3*CompactVarIntMax + val.size()*sizeof(double), 
+        MsgStreamCompact);
+    packCompact(pub, id, MsgStreamFloatArray, timestamp);
+    pub.writeVarInt(val.size());
+    pub.writeRaw(val.data(), val.size()*sizeof(double));
+    packetCommit(pub.offset());
+}
+
+/**
+ * Return true if given streamed batch update
+ * is coalesced into latest slots of given size
+ */
+template <typename U>
+static bool isLatestUpdate(const U& update, size_t latestSize)
+{
+    return 
+        update.isStreamed &&
+        update.ptrValue->streamFilter.latestOnly &&
+        update.ptrValue->id < latestSize;
+}
+
+template <typename T, typename U>
+void ServerPub::appendLatest(
+    LockFreeLatestSlots<T>& slots,
+    LockFreeRingQueue<PubValue<T>>& buffer,
+    const std::vector<U>& updates,
+    int64_t timestamp)
+{
+    for (const U& update : updates) {
+        if (
+            isLatestUpdate(update, slots.size()) &&
+            !slots.writeFromWriter(
+                update.ptrValue->id, update.value, timestamp) &&
+            !buffer.appendFromWriter(
+                {update.ptrValue->id, update.value, timestamp})
+        ) {
+            _droppedValues.add(update.ptrValue->id);
+        }
+    }
+}
+
+template <typename T, typename U>
+void ServerPub::appendBatch(
+    LockFreeRingQueue<PubValue<T>>& buffer,
+    size_t latestSize,
+    const std::vector<U>& updates,
+    size_t count,
+    int64_t timestamp)
+{
+    //Count streamed not coalesced values
+    size_t countStreamed = 0;
+    for (size_t i=0;i<count;i++) {
+        if (
+            updates[i].isStreamed && 
+            !isLatestUpdate(updates[i], latestSize)
+        ) {
+            countStreamed++;
+        }
+    }
+    if (countStreamed == 0) {
+        return;
+    }
+    //Append them as one block
+    size_t index = 0;
+    bool isOk = buffer.appendBlockFromWriter(countStreamed, 
+        [&updates, &index, latestSize, timestamp](size_t i, PubValue<T>& cell) {
+            (void)i;
+            while (
+                !updates[index].isStreamed || 
+                isLatestUpdate(updates[index], latestSize)
+            ) {
+                index++;
+            }
+            cell.id = updates[index].ptrValue->id;
+            cell.value = updates[index].value;
+            cell.timestamp = timestamp;
+            index++;
+        });
+    if (!isOk) {
+        for (size_t i=0;i<count;i++) {
+            if (
+                updates[i].isStreamed && 
+                !isLatestUpdate(updates[i], latestSize)
+            ) {
+                _droppedValues.add(updates[i].ptrValue->id);
+            }
+        }
+    }
+}
+
+}
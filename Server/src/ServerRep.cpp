@@ -62,6 +62,9 @@ void ServerRep::handleRequest()
             case MsgAskValuesStr:
                 listValuesStr(req);
                 return;
+            case MsgAskValuesFloatArray:
+                listValuesFloatArray(req);
+                return;
             case MsgGetBool:
                 getBool(req);
                 return;
@@ -74,6 +77,9 @@ void ServerRep::handleRequest()
             case MsgGetStr:
                 getStr(req);
                 return;
+            case MsgGetFloatArray:
+                getFloatArray(req);
+                return;
             case MsgSetBool:
                   setBool(req);
                   return;
@@ -86,6 +92,9 @@ void ServerRep::handleRequest()
             case MsgSetStr:
                   setStr(req);
                   return;
+            case MsgSetFloatArray:
+                  setFloatArray(req);
+                  return;
             case MsgAskMetaBool:
                   valMetaBool(req);
                   return;
@@ -98,6 +107,9 @@ void ServerRep::handleRequest()
             case MsgAskMetaStr:
                   valMetaStr(req);
                   return;
+            case MsgAskMetaFloatArray:
+                  valMetaFloatArray(req);
+                  return;
             case MsgEnableStreamingValue:
                   enableStreamingValue(req);
                   return;
@@ -107,6 +119,9 @@ void ServerRep::handleRequest()
             case MsgCheckStreamingValue:
                   checkStreamingValue(req);
                   return;
+            case MsgSetStreamFilter:
+                  setStreamFilter(req);
+                  return;
             case MsgEnableStreamingStream:
                   enableStreamingStream(req);
                   return;
@@ -143,6 +158,9 @@ void ServerRep::handleRequest()
             case MsgAskCall:
                   callResult(req);
                   return;
+            case MsgAskCallBinary:
+                  callBinaryResult(req);
+                  return;
             case MsgAskStreams:
                   listStreams(req);
                   return;
@@ -155,6 +173,9 @@ void ServerRep::handleRequest()
             case MsgAskMetaFrame:
                   valMetaFrame(req);
                   return;
+            case MsgAskSnapshot:
+                  snapshot(req);
+                  return;
             default:
                 //Unknown message type
                 error("Message type not implemented");
@@ -303,6 +324,33 @@ void ServerRep::listValuesStr(DataBuffer& buffer)
     //Send reply
     _socket.send(reply);
 }
+void ServerRep::listValuesFloatArray(DataBuffer& buffer)
+{
+    //Get asked node name
+    std::string name = buffer.readStr();
+    RhIO::IONode* node = getNode(name);
+    if (node == nullptr) return;
+
+    //Compute message size
+    size_t size = sizeof(MsgType);
+    size += sizeof(int64_t);
+    std::vector<std::string> list = node->listValuesFloatArray();
+    for (size_t i=0;i<list.size();i++) {
+        size += sizeof(int64_t) + list[i].length();
+    }
+
+    //Allocate message data
+    zmq::message_t reply(size);
+    DataBuffer rep(reply.data(), reply.size());
+    rep.writeType(MsgListNames);
+    rep.writeInt(list.size());
+    for (size_t i=0;i<list.size();i++) {
+        rep.writeStr(list[i]);
+    }
+
+    //Send reply
+    _socket.send(reply);
+}
 
 void ServerRep::getBool(DataBuffer& buffer)
 {
@@ -382,6 +430,27 @@ void ServerRep::getStr(DataBuffer& buffer)
     //Send reply
     _socket.send(reply);
 }
+void ServerRep::getFloatArray(DataBuffer& buffer)
+{
+    //Get asked node name
+    std::string name = buffer.readStr();
+    //Check value name
+    if (RhIO::Root.getValueType(name) != TypeFloatArray) {
+        error("Unknown value name: " + name);
+        return;
+    }
+
+    //Allocate message data
+    std::vector<double> val = RhIO::Root.getFloatArray(name);
+    zmq::message_t reply(
+        sizeof(MsgType) + sizeof(int64_t) + val.size()*sizeof(double));
+    DataBuffer rep(reply.data(), reply.size());
+    rep.writeType(MsgValFloatArray);
+    rep.writeFloatArray(val);
+
+    //Send reply
+    _socket.send(reply);
+}
 
 void ServerRep::setBool(DataBuffer& buffer)
 {
@@ -467,6 +536,33 @@ void ServerRep::setStr(DataBuffer& buffer)
     //Send reply
     _socket.send(reply);
 }
+void ServerRep::setFloatArray(DataBuffer& buffer)
+{
+    //Get asked node name
+    std::string name = buffer.readStr();
+    //Check value name
+    if (RhIO::Root.getValueType(name) != TypeFloatArray) {
+        error("Unknown value name: " + name);
+        return;
+    }
+    //Check value length
+    std::vector<double> val = buffer.readFloatArray();
+    if (RhIO::Root.getValueFloatArray(name).value.size() != val.size()) {
+        error("Invalid array length: " + name);
+        return;
+    }
+
+    //Update value
+    RhIO::Root.setFloatArray(name, val);
+
+    //Allocate message data
+    zmq::message_t reply(sizeof(MsgType));
+    DataBuffer rep(reply.data(), reply.size());
+    rep.writeType(MsgSetOk);
+
+    //Send reply
+    _socket.send(reply);
+}
 
 void ServerRep::valMetaBool(DataBuffer& buffer)
 {
@@ -593,6 +689,39 @@ void ServerRep::valMetaStr(DataBuffer& buffer)
     //Send reply
     _socket.send(reply);
 }
+void ServerRep::valMetaFloatArray(DataBuffer& buffer)
+{
+    //Get asked node name
+    std::string name = buffer.readStr();
+    //Check value name
+    if (RhIO::Root.getValueType(name) != TypeFloatArray) {
+        error("Unknown value name: " + name);
+        return;
+    }
+
+    ValueFloatArray val = RhIO::Root.getValueFloatArray(name);
+
+    //Allocate message data
+    zmq::message_t reply(
+        sizeof(MsgType) + sizeof(int64_t) + val.comment.length()
+        + 3*sizeof(uint8_t) + sizeof(int64_t) + 3*sizeof(int64_t) 
+        + (val.min.size() + val.max.size() 
+        + val.valuePersisted.size())*sizeof(double));
+    DataBuffer rep(reply.data(), reply.size());
+    rep.writeType(MsgValMetaFloatArray);
+    rep.writeStr(val.comment);
+    rep.writeBool(val.hasMin);
+    rep.writeBool(val.hasMax);
+    rep.writeBool(val.persisted);
+    rep.writeInt(val.streamWatchers.load());
+    
+    rep.writeFloatArray(val.min);
+    rep.writeFloatArray(val.max);
+    rep.writeFloatArray(val.valuePersisted);
+
+    //Send reply
+    _socket.send(reply);
+}
         
 void ServerRep::enableStreamingValue(DataBuffer& buffer)
 {
@@ -639,6 +768,28 @@ void ServerRep::checkStreamingValue(DataBuffer& buffer)
     //Send reply
     _socket.send(reply);
 }
+
+void ServerRep::setStreamFilter(DataBuffer& buffer)
+{
+    //Get asked value name and filter
+    std::string name = buffer.readStr();
+    StreamFilter filter;
+    filter.onChange = buffer.readBool();
+    filter.deadbandAbs = buffer.readFloat();
+    filter.deadbandRel = buffer.readFloat();
+    filter.periodMin = buffer.readInt();
+    filter.latestOnly = buffer.readBool();
+    //Update streaming filter
+    RhIO::Root.setStreamFilter(name, filter);
+
+    //Allocate message data
+    zmq::message_t reply(sizeof(MsgType));
+    DataBuffer rep(reply.data(), reply.size());
+    rep.writeType(MsgStreamingOK);
+
+    //Send reply
+    _socket.send(reply);
+}
     
 void ServerRep::enableStreamingStream(DataBuffer& buffer)
 {
@@ -922,6 +1073,39 @@ void ServerRep::callResult(DataBuffer& buffer)
     //Send reply
     _socket.send(reply);
 }
+void ServerRep::callBinaryResult(DataBuffer& buffer)
+{
+    //Get asked command name
+    std::string name = buffer.readStr();
+    //Check command name
+    if (!RhIO::Root.commandBinaryExist(name)) {
+        error("Unknown binary command name: " + name);
+        return;
+    }
+
+    //Retrieve encoded arguments
+    size_t size;
+    unsigned char* data = buffer.readData(size);
+    CommandData arguments(data, data + size);
+    //Call command
+    CommandData result;
+    try {
+        result = RhIO::Root.callBinary(name, arguments);
+    } catch (const std::exception& e) {
+        error(std::string("Command exception: ") + e.what());
+        return;
+    }
+
+    //Allocate message data
+    zmq::message_t reply(
+        sizeof(MsgType) + sizeof(int64_t) + result.size());
+    DataBuffer rep(reply.data(), reply.size());
+    rep.writeType(MsgCallResultBinary);
+    rep.writeData(result.data(), result.size());
+
+    //Send reply
+    _socket.send(reply);
+}
         
 void ServerRep::listStreams(DataBuffer& buffer)
 {
@@ -1028,6 +1212,81 @@ void ServerRep::valMetaFrame(DataBuffer& buffer)
     //Send reply
     _socket.send(reply);
 }
+
+void ServerRep::snapshot(DataBuffer& buffer)
+{
+    //Get asked node name
+    std::string name = buffer.readStr();
+    RhIO::IONode* node = getNode(name);
+    if (node == nullptr) return;
+
+    Snapshot snapshot = node->snapshot();
+
+    //Compute message size
+    size_t size = sizeof(MsgType);
+    size += sizeof(uint8_t);
+    size += 5*sizeof(int64_t);
+    for (const SnapshotBool& val : snapshot.valuesBool) {
+        size += sizeof(int64_t) + val.name.length();
+        size += sizeof(int64_t) + sizeof(uint8_t);
+    }
+    for (const SnapshotInt& val : snapshot.valuesInt) {
+        size += sizeof(int64_t) + val.name.length();
+        size += sizeof(int64_t) + sizeof(int64_t);
+    }
+    for (const SnapshotFloat& val : snapshot.valuesFloat) {
+        size += sizeof(int64_t) + val.name.length();
+        size += sizeof(int64_t) + sizeof(double);
+    }
+    for (const SnapshotStr& val : snapshot.valuesStr) {
+        size += sizeof(int64_t) + val.name.length();
+        size += sizeof(int64_t) + sizeof(int64_t) + val.value.length();
+    }
+    for (const SnapshotFloatArray& val : snapshot.valuesFloatArray) {
+        size += sizeof(int64_t) + val.name.length();
+        size += sizeof(int64_t) + sizeof(int64_t) 
+            + val.value.size()*sizeof(double);
+    }
+
+    //Allocate message data
+    zmq::message_t reply(size);
+    DataBuffer rep(reply.data(), reply.size());
+    rep.writeType(MsgSnapshot);
+    rep.writeBool(snapshot.isConsistent);
+    rep.writeInt(snapshot.valuesBool.size());
+    for (const SnapshotBool& val : snapshot.valuesBool) {
+        rep.writeStr(val.name);
+        rep.writeInt(val.timestamp);
+        rep.writeBool(val.value);
+    }
+    rep.writeInt(snapshot.valuesInt.size());
+    for (const SnapshotInt& val : snapshot.valuesInt) {
+        rep.writeStr(val.name);
+        rep.writeInt(val.timestamp);
+        rep.writeInt(val.value);
+    }
+    rep.writeInt(snapshot.valuesFloat.size());
+    for (const SnapshotFloat& val : snapshot.valuesFloat) {
+        rep.writeStr(val.name);
+        rep.writeInt(val.timestamp);
+        rep.writeFloat(val.value);
+    }
+    rep.writeInt(snapshot.valuesStr.size());
+    for (const SnapshotStr& val : snapshot.valuesStr) {
+        rep.writeStr(val.name);
+        rep.writeInt(val.timestamp);
+        rep.writeStr(val.value);
+    }
+    rep.writeInt(snapshot.valuesFloatArray.size());
+    for (const SnapshotFloatArray& val : snapshot.valuesFloatArray) {
+        rep.writeStr(val.name);
+        rep.writeInt(val.timestamp);
+        rep.writeFloatArray(val.value);
+    }
+
+    //Send reply
+    _socket.send(reply);
+}
         
 void ServerRep::error(const std::string& msg)
 {
@@ -0,0 +1,47 @@
+#include "rhio_server/Stats.hpp"
+#include "rhio_server/PathRegistry.hpp"
+#include "RhIO.hpp"
+
+namespace RhIO {
+
+const std::string StatsPath = "rhio/stats";
+const int64_t StatsPeriod = 1000000;
+
+void statsSetInt(const std::string& name, 
+    int64_t val, const std::string& comment)
+{
+    std::string path = StatsPath + separator + name;
+    if (Root.getValueType(path) == NoValue) {
+        Root.newInt(path)
+            ->comment(comment)
+            ->readOnly(true);
+    }
+    Root.setReadOnlyInt(path, val);
+}
+
+void statsValues(const std::string& name, 
+    const LockFreeCounters& counters,
+    const std::string& comment)
+{
+    size_t size = PathRegistry::size();
+    if (size > counters.size()) {
+        size = counters.size();
+    }
+    for (size_t id=0;id<size;id++) {
+        uint64_t count = counters.get(id);
+        if (count == 0) {
+            continue;
+        }
+        //Root level values path 
+        //starts with a separator
+        std::string path = PathRegistry::path(id);
+        if (path.length() > 0 && path[0] == separator) {
+            path = path.substr(1);
+        }
+        statsSetInt(std::string("values") + separator 
+            + path + separator + name, count, comment);
+    }
+}
+
+}
+
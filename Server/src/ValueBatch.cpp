@@ -0,0 +1,351 @@
+#include <stdexcept>
+#include <algorithm>
+#include <cstdint>
+#include "rhio_server/ValueBatch.hpp"
+#include "rhio_server/ServerPub.hpp"
+#include "rhio_server/ServerLog.hpp"
+#include "RhIO.hpp"
+
+namespace RhIO {
+
+ValueBatch::ValueBatch(ValueNode& node) :
+    _node(&node),
+    _nodes(),
+    _countNodes(0),
+    _nodesTable(),
+    _updatesBool(),
+    _updatesInt(),
+    _updatesFloat(),
+    _updatesStr(),
+    _updatesFloatArray(),
+    _countFloatArray(0),
+    _timestamp(0)
+{
+}
+
+void ValueBatch::setBool(const std::string& name, bool val)
+{
+    ValueNode* node = nullptr;
+    ValueHotBool* ptrValue = nullptr;
+    _node->handleResolve(name, node, ptrValue);
+    ValueNode::checkWritable(*ptrValue);
+    addNode(node).indexesBool.push_back(_updatesBool.size());
+    _updatesBool.push_back({ptrValue, val, false, false});
+}
+void ValueBatch::setInt(const std::string& name, int64_t val)
+{
+    ValueNode* node = nullptr;
+    ValueHotInt* ptrValue = nullptr;
+    _node->handleResolve(name, node, ptrValue);
+    ValueNode::checkWritable(*ptrValue);
+    addNode(node).indexesInt.push_back(_updatesInt.size());
+    _updatesInt.push_back({ptrValue, val, false, false});
+}
+void ValueBatch::setFloat(const std::string& name, double val)
+{
+    ValueNode* node = nullptr;
+    ValueHotFloat* ptrValue = nullptr;
+    _node->handleResolve(name, node, ptrValue);
+    ValueNode::checkWritable(*ptrValue);
+    addNode(node).indexesFloat.push_back(_updatesFloat.size());
+    _updatesFloat.push_back({ptrValue, val, false, false});
+}
+void ValueBatch::setStr(const std::string& name, const std::string& val)
+{
+    ValueNode* node = nullptr;
+    ValueHotStr* ptrValue = nullptr;
+    _node->handleResolve(name, node, ptrValue);
+    ValueNode::checkWritable(*ptrValue);
+    addNode(node).indexesStr.push_back(_updatesStr.size());
+    _updatesStr.push_back({ptrValue, val, false, false});
+}
+void ValueBatch::setFloatArray(const std::string& name,
+    const std::vector<double>& val)
+{
+    ValueNode* node = nullptr;
+    ValueHotFloatArray* ptrValue = nullptr;
+    _node->handleResolve(name, node, ptrValue);
+    ValueNode::checkWritable(*ptrValue);
+    if (ptrValue->value.size() != val.size()) {
+        throw std::logic_error(
+            "RhIO::ValueBatch::setFloatArray: invalid length: " + name);
+    }
+    addNode(node).indexesFloatArray.push_back(_countFloatArray);
+    //Copy into a previously used update
+    //to reuse its allocated storage
+    if (_countFloatArray == _updatesFloatArray.size()) {
+        _updatesFloatArray.push_back({ptrValue, val, false, false});
+    } else {
+        UpdateFloatArray& update = _updatesFloatArray[_countFloatArray];
+        update.ptrValue = ptrValue;
+        update.value.assign(val.begin(), val.end());
+        update.isStreamed = false;
+        update.isApplied = false;
+    }
+    _countFloatArray++;
+}
+
+void ValueBatch::setBool(const ValueHandleBool& handle, bool val)
+{
+    if (handle._node == nullptr || handle._ptrValue == nullptr) {
+        throw std::logic_error(
+            "RhIO::ValueBatch::setBool: uninitialized handle");
+    }
+    ValueNode::checkWritable(*handle._ptrValue);
+    addNode(handle._node).indexesBool.push_back(_updatesBool.size());
+    _updatesBool.push_back({handle._ptrValue, val, false, false});
+}
+void ValueBatch::setInt(const ValueHandleInt& handle, int64_t val)
+{
+    if (handle._node == nullptr || handle._ptrValue == nullptr) {
+        throw std::logic_error(
+            "RhIO::ValueBatch::setInt: uninitialized handle");
+    }
+    ValueNode::checkWritable(*handle._ptrValue);
+    addNode(handle._node).indexesInt.push_back(_updatesInt.size());
+    _updatesInt.push_back({handle._ptrValue, val, false, false});
+}
+void ValueBatch::setFloat(const ValueHandleFloat& handle, double val)
+{
+    if (handle._node == nullptr || handle._ptrValue == nullptr) {
+        throw std::logic_error(
+            "RhIO::ValueBatch::setFloat: uninitialized handle");
+    }
+    ValueNode::checkWritable(*handle._ptrValue);
+    addNode(handle._node).indexesFloat.push_back(_updatesFloat.size());
+    _updatesFloat.push_back({handle._ptrValue, val, false, false});
+}
+void ValueBatch::setStr(const ValueHandleStr& handle, const std::string& val)
+{
+    if (handle._node == nullptr || handle._ptrValue == nullptr) {
+        throw std::logic_error(
+            "RhIO::ValueBatch::setStr: uninitialized handle");
+    }
+    ValueNode::checkWritable(*handle._ptrValue);
+    addNode(handle._node).indexesStr.push_back(_updatesStr.size());
+    _updatesStr.push_back({handle._ptrValue, val, false, false});
+}
+
+size_t ValueBatch::size() const
+{
+    return
+        _updatesBool.size() +
+        _updatesInt.size() +
+        _updatesFloat.size() +
+        _updatesStr.size() +
+        _countFloatArray;
+}
+
+void ValueBatch::clear()
+{
+    _countNodes = 0;
+    std::fill(_nodesTable.begin(), _nodesTable.end(), 0);
+    _updatesBool.clear();
+    _updatesInt.clear();
+    _updatesFloat.clear();
+    _updatesStr.clear();
+    _countFloatArray = 0;
+}
+
+void ValueBatch::commit(bool noCallblack, int64_t timestamp)
+{
+    _timestamp = timestamp;
+    try {
+        applyUpdates(noCallblack, timestamp);
+    } catch (...) {
+        //A callback has thrown. Publish and log
+        //the already applied updates, discard the
+        //batch and forward the error
+        removeNotApplied();
+        publishUpdates();
+        clear();
+        throw;
+    }
+    publishUpdates();
+    clear();
+}
+
+void ValueBatch::applyUpdates(bool noCallblack, int64_t timestamp)
+{
+    //Mark the whole batch as one write
+    //on every owning node and apply all
+    //updates taking each owning node
+    //mutex only once. Callbacks are called
+    //once their update is marked applied so
+    //that a throwing callback does not 
+    //prevent its update to be published.
+    CommitGuard guard(*this);
+    for (size_t i=0;i<_countNodes;i++) {
+        NodeUpdates& group = _nodes[i];
+        ValueNode* node = group.node;
+        std::lock_guard<std::mutex> lock(node->_mutex);
+        for (size_t index : group.indexesBool) {
+            UpdateBool& update = _updatesBool[index];
+            update.value = node->updateBool(
+                *update.ptrValue, update.value,
+                true, timestamp);
+            update.isStreamed = ValueNode::isStreamed(
+                *update.ptrValue, update.value, timestamp);
+            update.isApplied = true;
+            if (!noCallblack) {
+                node->callbackBool(*update.ptrValue, update.value);
+            }
+        }
+        for (size_t index : group.indexesInt) {
+            UpdateInt& update = _updatesInt[index];
+            update.value = node->updateInt(
+                *update.ptrValue, update.value,
+                true, timestamp);
+            update.isStreamed = ValueNode::isStreamed(
+                *update.ptrValue, update.value, timestamp);
+            update.isApplied = true;
+            if (!noCallblack) {
+                node->callbackInt(*update.ptrValue, update.value);
+            }
+        }
+        for (size_t index : group.indexesFloat) {
+            UpdateFloat& update = _updatesFloat[index];
+            update.value = node->updateFloat(
+                *update.ptrValue, update.value,
+                true, timestamp);
+            update.isStreamed = ValueNode::isStreamed(
+                *update.ptrValue, update.value, timestamp);
+            update.isApplied = true;
+            if (!noCallblack) {
+                node->callbackFloat(*update.ptrValue, update.value);
+            }
+        }
+        for (size_t index : group.indexesStr) {
+            UpdateStr& update = _updatesStr[index];
+            const std::string& valBound = node->updateStr(
+                *update.ptrValue, update.value,
+                true, timestamp);
+            if (&valBound != &update.value) {
+                update.value = valBound;
+            }
+            update.isStreamed = ValueNode::isStreamed(
+                *update.ptrValue, update.value, timestamp);
+            update.isApplied = true;
+            if (!noCallblack) {
+                node->callbackStr(*update.ptrValue, update.value);
+            }
+        }
+        for (size_t index : group.indexesFloatArray) {
+            UpdateFloatArray& update = _updatesFloatArray[index];
+            const double* dataBound = node->updateFloatArray(
+                *update.ptrValue, update.value.data(),
+                true, timestamp);
+            if (dataBound != update.value.data()) {
+                update.value.assign(
+                    dataBound, dataBound + update.value.size());
+            }
+            update.isStreamed = ValueNode::isStreamed(
+                *update.ptrValue, update.value.data(), timestamp);
+            update.isApplied = true;
+            if (!noCallblack) {
+                node->callbackFloatArray(
+                    *update.ptrValue, update.value.data());
+            }
+        }
+    }
+}
+
+/**
+ * Remove from given update list
+ * the updates not applied
+ */
+template <typename T>
+static void eraseNotApplied(std::vector<T>& updates)
+{
+    updates.erase(std::remove_if(
+        updates.begin(), updates.end(), 
+        [](const T& update) {
+            return !update.isApplied;
+        }),
+        updates.end());
+}
+
+void ValueBatch::removeNotApplied()
+{
+    eraseNotApplied(_updatesBool);
+    eraseNotApplied(_updatesInt);
+    eraseNotApplied(_updatesFloat);
+    eraseNotApplied(_updatesStr);
+    //FloatArray updates are moved after the
+    //used ones to keep their storage for reuse
+    auto it = std::stable_partition(
+        _updatesFloatArray.begin(), 
+        _updatesFloatArray.begin() + _countFloatArray, 
+        [](const UpdateFloatArray& update) {
+            return update.isApplied;
+        });
+    _countFloatArray = it - _updatesFloatArray.begin();
+}
+
+void ValueBatch::publishUpdates()
+{
+    //Publish values
+    if (ServerStream != nullptr) {
+        ServerStream->publishBatch(*this);
+    }
+    //Log values
+    if (ServerLogging != nullptr) {
+        ServerLogging->logBatch(*this);
+    }
+}
+
+ValueBatch::NodeUpdates& ValueBatch::addNode(ValueNode* node)
+{
+    //Consecutive updates often
+    //belong to the same node
+    if (_countNodes > 0 && _nodes[_countNodes-1].node == node) {
+        return _nodes[_countNodes-1];
+    }
+    //Grow the hash table to keep
+    //it at most half full
+    if (2*(_countNodes + 1) > _nodesTable.size()) {
+        _nodesTable.assign(
+            std::max((size_t)16, 2*_nodesTable.size()), 0);
+        for (size_t i=0;i<_countNodes;i++) {
+            _nodesTable[findNode(_nodes[i].node)] = i + 1;
+        }
+    }
+    size_t slot = findNode(node);
+    if (_nodesTable[slot] != 0) {
+        return _nodes[_nodesTable[slot] - 1];
+    }
+    //Register the node reusing
+    //previously allocated lists
+    if (_countNodes == _nodes.size()) {
+        _nodes.push_back(NodeUpdates());
+    }
+    NodeUpdates& group = _nodes[_countNodes];
+    group.node = node;
+    group.indexesBool.clear();
+    group.indexesInt.clear();
+    group.indexesFloat.clear();
+    group.indexesStr.clear();
+    group.indexesFloatArray.clear();
+    _countNodes++;
+    _nodesTable[slot] = _countNodes;
+
+    return group;
+}
+
+size_t ValueBatch::findNode(ValueNode* node) const
+{
+    size_t mask = _nodesTable.size() - 1;
+    size_t hash = (size_t)((uintptr_t)node >> 4)*0x9E3779B97F4A7C15ULL;
+    size_t slot = (hash ^ (hash >> 29)) & mask;
+    while (
+        _nodesTable[slot] != 0 &&
+        _nodes[_nodesTable[slot] - 1].node != node
+    ) {
+        slot = (slot + 1) & mask;
+    }
+
+    return slot;
+}
+
+}
+
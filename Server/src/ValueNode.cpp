@@ -1,20 +1,85 @@
 #include <stdexcept>
 #include <iomanip>
 #include <fstream>
+#include <cmath>
+#include <functional>
 #include <yaml-cpp/yaml.h>
 #include "rhio_server/ValueNode.hpp"
+#include "rhio_server/ValueBatch.hpp"
+#include "rhio_server/PathRegistry.hpp"
 #include "rhio_server/ServerPub.hpp"
 #include "rhio_server/ServerLog.hpp"
+#include "rhio_server/CallbackDispatcher.hpp"
 #include "RhIO.hpp"
 
 namespace RhIO {
 
+/**
+ * Scoped access to the deferred callback
+ * dispatcher (null if callbacks are inline).
+ * Setters are counted while they may push into
+ * the dispatcher so that setCallbackMode() never
+ * flushes it before their push.
+ */
+class CallbackAccess
+{
+    public:
+
+        CallbackAccess()
+        {
+            ServerCallbackUsers.fetch_add(1);
+            _dispatcher = ServerCallback.load();
+            //Inline callbacks are not waited for
+            if (_dispatcher == nullptr) {
+                ServerCallbackUsers.fetch_sub(1);
+            }
+        }
+
+        ~CallbackAccess()
+        {
+            if (_dispatcher != nullptr) {
+                ServerCallbackUsers.fetch_sub(1);
+            }
+        }
+
+        CallbackDispatcher* get() const
+        {
+            return _dispatcher;
+        }
+
+    private:
+
+        CallbackDispatcher* _dispatcher;
+};
+
 ValueNode& ValueNode::operator=(const ValueNode& node)
 {
     _valuesBool = node._valuesBool;
     _valuesInt = node._valuesInt;
     _valuesFloat = node._valuesFloat;
     _valuesStr = node._valuesStr;
+    _valuesFloatArray = node._valuesFloatArray;
+    //Rebuild lookup indexes
+    _indexBool.clear();
+    _indexInt.clear();
+    _indexFloat.clear();
+    _indexStr.clear();
+    _indexFloatArray.clear();
+    for (const auto& v : _valuesBool) {
+        _indexBool.insert(v.first, &v.second);
+    }
+    for (const auto& v : _valuesInt) {
+        _indexInt.insert(v.first, &v.second);
+    }
+    for (const auto& v : _valuesFloat) {
+        _indexFloat.insert(v.first, &v.second);
+    }
+    for (const auto& v : _valuesStr) {
+        _indexStr.insert(v.first, &v.second);
+    }
+    for (const auto& v : _valuesFloatArray) {
+        _indexFloatArray.insert(v.first, &v.second);
+    }
 
     return *this;
 }
@@ -30,15 +95,16 @@ ValueType ValueNode::getValueType(const std::string& name) const
         return NoValue;
     }
 
-    std::lock_guard<std::mutex> lock(_mutex);
-    if (_valuesBool.count(name) > 0) {
+    if (_indexBool.find(name) != nullptr) {
         return TypeBool;
-    } else if (_valuesInt.count(name) > 0) {
+    } else if (_indexInt.find(name) != nullptr) {
         return TypeInt;
-    } else if (_valuesFloat.count(name) > 0) {
+    } else if (_indexFloat.find(name) != nullptr) {
         return TypeFloat;
-    } else if (_valuesStr.count(name) > 0) {
+    } else if (_indexStr.find(name) != nullptr) {
         return TypeStr;
+    } else if (_indexFloatArray.find(name) != nullptr) {
+        return TypeFloatArray;
     } else {
         return NoValue;
     }
@@ -51,12 +117,12 @@ bool ValueNode::getBool(const std::string& name) const
     ValueNode* child = BaseNode::forwardFunc(name, tmpName, false);
     if (child != nullptr) return child->getBool(tmpName);
 
-    std::lock_guard<std::mutex> lock(_mutex);
-    if (_valuesBool.count(name) == 0) {
+    const ValueHotBool* value = _indexBool.find(name);
+    if (value == nullptr) {
         throw std::logic_error("RhIO unknown value Bool name: '" + name + "' in '"
             + BaseNode::pwd + "'");
     } else {
-        return _valuesBool.at(name).value;
+        return value->value.load();
     }
 }
 int64_t ValueNode::getInt(const std::string& name) const
@@ -66,12 +132,12 @@ int64_t ValueNode::getInt(const std::string& name) const
     ValueNode* child = BaseNode::forwardFunc(name, tmpName, false);
     if (child != nullptr) return child->getInt(tmpName);
 
-    std::lock_guard<std::mutex> lock(_mutex);
-    if (_valuesInt.count(name) == 0) {
+    const ValueHotInt* value = _indexInt.find(name);
+    if (value == nullptr) {
         throw std::logic_error("RhIO unknown Int value name: '" + name + "' in '"
             + BaseNode::pwd + "'");
     } else {
-        return _valuesInt.at(name).value;
+        return value->value.load();
     }
 }
 double ValueNode::getFloat(const std::string& name) const
@@ -81,58 +147,111 @@ double ValueNode::getFloat(const std::string& name) const
     ValueNode* child = BaseNode::forwardFunc(name, tmpName, false);
     if (child != nullptr) return child->getFloat(tmpName);
 
-    std::lock_guard<std::mutex> lock(_mutex);
-    if (_valuesFloat.count(name) == 0) {
+    const ValueHotFloat* value = _indexFloat.find(name);
+    if (value == nullptr) {
         throw std::logic_error("RhIO unknown Float value name: '" + name + "' in '"
             + BaseNode::pwd + "'");
     } else {
-        return _valuesFloat.at(name).value;
+        return value->value.load();
     }
 }
-const std::string& ValueNode::getStr(const std::string& name) const
+std::string ValueNode::getStr(const std::string& name) const
 {
     //Forward to subtree
     std::string tmpName;
     ValueNode* child = BaseNode::forwardFunc(name, tmpName, false);
     if (child != nullptr) return child->getStr(tmpName);
 
-    std::lock_guard<std::mutex> lock(_mutex);
-    if (_valuesStr.count(name) == 0) {
+    const ValueHotStr* value = _indexStr.find(name);
+    if (value == nullptr) {
         throw std::logic_error("RhIO unknown Str value name: '" + name + "' in '"
             + BaseNode::pwd + "'");
     } else {
-        return _valuesStr.at(name).value;
+        return value->value.load();
+    }
+}
+std::vector<double> ValueNode::getFloatArray(const std::string& name) const
+{
+    //Forward to subtree
+    std::string tmpName;
+    ValueNode* child = BaseNode::forwardFunc(name, tmpName, false);
+    if (child != nullptr) return child->getFloatArray(tmpName);
+
+    const ValueHotFloatArray* value = _indexFloatArray.find(name);
+    if (value == nullptr) {
+        throw std::logic_error("RhIO unknown FloatArray value name: '" + name + "' in '"
+            + BaseNode::pwd + "'");
+    } else {
+        return value->value.load();
     }
 }
 
 bool ValueNode::getRTBool(const std::string& name) const
 {
-    if (_valuesBool.count(name) == 0) {
+    const ValueHotBool* value = _indexBool.find(name);
+    if (value == nullptr) {
         throw std::logic_error(
             "RhIO unknown value Bool name: '" + name + "' in '"
             + BaseNode::pwd + "'");
     } else {
-        return _valuesBool.at(name).value.load();
+        return value->value.load();
     }
 }
 int64_t ValueNode::getRTInt(const std::string& name) const
 {
-    if (_valuesInt.count(name) == 0) {
+    const ValueHotInt* value = _indexInt.find(name);
+    if (value == nullptr) {
         throw std::logic_error(
             "RhIO unknown value Int name: '" + name + "' in '"
             + BaseNode::pwd + "'");
     } else {
-        return _valuesInt.at(name).value.load();
+        return value->value.load();
     }
 }
 double ValueNode::getRTFloat(const std::string& name) const
 {
-    if (_valuesFloat.count(name) == 0) {
+    const ValueHotFloat* value = _indexFloat.find(name);
+    if (value == nullptr) {
         throw std::logic_error(
             "RhIO unknown value Float name: '" + name + "' in '"
             + BaseNode::pwd + "'");
     } else {
-        return _valuesFloat.at(name).value.load();
+        return value->value.load();
+    }
+}
+std::string ValueNode::getRTStr(const std::string& name) const
+{
+    const ValueHotStr* value = _indexStr.find(name);
+    if (value == nullptr) {
+        throw std::logic_error(
+            "RhIO unknown value Str name: '" + name + "' in '"
+            + BaseNode::pwd + "'");
+    } else {
+        return value->value.load();
+    }
+}
+void ValueNode::getRTStr(const std::string& name, 
+    std::string& val) const
+{
+    const ValueHotStr* value = _indexStr.find(name);
+    if (value == nullptr) {
+        throw std::logic_error(
+            "RhIO unknown value Str name: '" + name + "' in '"
+            + BaseNode::pwd + "'");
+    } else {
+        value->value.load(val);
+    }
+}
+void ValueNode::getRTFloatArray(const std::string& name, 
+    double* data) const
+{
+    const ValueHotFloatArray* value = _indexFloatArray.find(name);
+    if (value == nullptr) {
+        throw std::logic_error(
+            "RhIO unknown value FloatArray name: '" + name + "' in '"
+            + BaseNode::pwd + "'");
+    } else {
+        value->value.load(data);
     }
 }
 
@@ -153,40 +272,7 @@ void ValueNode::setBool(const std::string& name, bool val,
         throw std::logic_error("RhIO unknown value Bool name: '" + name + "' in '"
             + BaseNode::pwd + "'");
     } else {
-        //Bound to min/max
-        if (
-            _valuesBool.at(name).hasMin && 
-            val < _valuesBool.at(name).min
-        ) {
-            val = _valuesBool.at(name).min;
-        }
-        if (
-            _valuesBool.at(name).hasMax && 
-            val > _valuesBool.at(name).max
-        ) {
-            val = _valuesBool.at(name).max;
-        }
-        //Update value
-        _valuesBool[name].value = val;
-        _valuesBool[name].timestamp = timestamp;
-        //Call callback
-        if (!noCallblack) {
-            _valuesBool[name].callback(val);
-        }
-        //Publish value
-        if (_valuesBool.at(name).streamWatchers.load() > 0) {
-            if (ServerStream != nullptr) {
-                ServerStream->publishBool(
-                    _valuesBool[name].path,
-                    val, timestamp);
-            }
-        }
-        //Log value
-        if (ServerLogging != nullptr) {
-            ServerLogging->logBool(
-                _valuesBool[name].path,
-                val, timestamp);
-        }
+        assignBool(_valuesBool.at(name), val, noCallblack, timestamp);
     }
 }
 void ValueNode::setInt(const std::string& name, int64_t val,
@@ -206,40 +292,7 @@ void ValueNode::setInt(const std::string& name, int64_t val,
         throw std::logic_error("RhIO unknown value Int name: '" + name + "' in '"
             + BaseNode::pwd + "'");
     } else {
-        //Bound to min/max
-        if (
-            _valuesInt.at(name).hasMin && 
-            val < _valuesInt.at(name).min
-        ) {
-            val = _valuesInt.at(name).min;
-        }
-        if (
-            _valuesInt.at(name).hasMax && 
-            val > _valuesInt.at(name).max
-        ) {
-            val = _valuesInt.at(name).max;
-        }
-        //Update value
-        _valuesInt[name].value = val;
-        _valuesInt[name].timestamp = timestamp;
-        //Call callback
-        if (!noCallblack) {
-            _valuesInt[name].callback(val);
-        }
-        //Publish value
-        if (_valuesInt.at(name).streamWatchers.load() > 0) {
-            if (ServerStream != nullptr) {
-                ServerStream->publishInt(
-                    _valuesInt[name].path,
-                    val, timestamp);
-            }
-        }
-        //Log value
-        if (ServerLogging != nullptr) {
-            ServerLogging->logInt(
-                _valuesInt[name].path,
-                val, timestamp);
-        }
+        assignInt(_valuesInt.at(name), val, noCallblack, timestamp);
     }
 }
 void ValueNode::setFloat(const std::string& name, double val,
@@ -259,40 +312,7 @@ void ValueNode::setFloat(const std::string& name, double val,
         throw std::logic_error("RhIO unknown value Float name: '" + name + "' in '"
             + BaseNode::pwd + "'");
     } else {
-        //Bound to min/max
-        if (
-            _valuesFloat.at(name).hasMin && 
-            val < _valuesFloat.at(name).min
-        ) {
-            val = _valuesFloat.at(name).min;
-        }
-        if (
-            _valuesFloat.at(name).hasMax && 
-            val > _valuesFloat.at(name).max
-        ) {
-            val = _valuesFloat.at(name).max;
-        }
-        //Update value
-        _valuesFloat[name].value = val;
-        _valuesFloat[name].timestamp = timestamp;
-        //Call callback
-        if (!noCallblack) {
-            _valuesFloat[name].callback(val);
-        }
-        //Publish value
-        if (_valuesFloat.at(name).streamWatchers.load() > 0) {
-            if (ServerStream != nullptr) {
-                ServerStream->publishFloat(
-                    _valuesFloat[name].path,
-                    val, timestamp);
-            }
-        }
-        //Log value
-        if (ServerLogging != nullptr) {
-            ServerLogging->logFloat(
-                _valuesFloat[name].path,
-                val, timestamp);
-        }
+        assignFloat(_valuesFloat.at(name), val, noCallblack, timestamp);
     }
 }
 void ValueNode::setStr(const std::string& name, const std::string& val,
@@ -312,100 +332,150 @@ void ValueNode::setStr(const std::string& name, const std::string& val,
         throw std::logic_error("RhIO unknown value Str name: '" + name + "' in '"
             + BaseNode::pwd + "'");
     } else {
-        //Update value
-        _valuesStr[name].value = val;
-        _valuesStr[name].timestamp = timestamp;
-        //Bound to min/max
-        if (
-            _valuesStr.at(name).hasMin && 
-            val < _valuesStr.at(name).min
-        ) {
-            _valuesStr[name].value = _valuesStr.at(name).min;
-        }
-        if (
-            _valuesStr.at(name).hasMax && 
-            val > _valuesStr.at(name).max
-        ) {
-            _valuesStr[name].value = _valuesStr.at(name).max;
-        }
-        //Call callback
-        if (!noCallblack) {
-            _valuesStr[name].callback(_valuesStr[name].value);
-        }
-        //Publish value
-        if (_valuesStr.at(name).streamWatchers.load() > 0) {
-            if (ServerStream != nullptr) {
-                ServerStream->publishStr(
-                    _valuesStr[name].path,
-                    val, timestamp);
-            }
-        }
-        //Log value
-        if (ServerLogging != nullptr) {
-            ServerLogging->logStr(
-                _valuesStr[name].path,
-                val, timestamp);
-        }
+        assignStr(_valuesStr.at(name), val, noCallblack, timestamp);
+    }
+}
+void ValueNode::setFloatArray(const std::string& name, 
+    const std::vector<double>& val,
+    bool noCallblack,
+    int64_t timestamp)
+{
+    //Forward to subtree
+    std::string tmpName;
+    ValueNode* child = BaseNode::forwardFunc(name, tmpName, false);
+    if (child != nullptr) {
+        child->setFloatArray(tmpName, val, noCallblack, timestamp);
+        return;
+    }
+
+    std::lock_guard<std::mutex> lock(_mutex);
+    if (_valuesFloatArray.count(name) == 0) {
+        throw std::logic_error("RhIO unknown value FloatArray name: '" + name + "' in '"
+            + BaseNode::pwd + "'");
+    } else if (_valuesFloatArray.at(name).value.size() != val.size()) {
+        throw std::logic_error("RhIO invalid FloatArray length: '" + name + "' in '"
+            + BaseNode::pwd + "'");
+    } else {
+        assignFloatArray(_valuesFloatArray.at(name), 
+            val.data(), noCallblack, timestamp);
     }
 }
 
 void ValueNode::setRTBool(const std::string& name, bool val,
     int64_t timestamp)
 {
-    if (_valuesBool.count(name) == 0) {
+    ValueHotBool* value = _indexBool.find(name);
+    if (value == nullptr) {
         throw std::logic_error(
             "RhIO unknown value Bool name: '" + name + "' in '"
             + BaseNode::pwd + "'");
     } else {
-        assignRTBool(_valuesBool.at(name), val, timestamp);
+        assignRTBool(*value, val, timestamp);
     }
 }
 void ValueNode::setRTInt(const std::string& name, int64_t val,
     int64_t timestamp)
 {
-    if (_valuesInt.count(name) == 0) {
+    ValueHotInt* value = _indexInt.find(name);
+    if (value == nullptr) {
         throw std::logic_error(
             "RhIO unknown value Int name: '" + name + "' in '"
             + BaseNode::pwd + "'");
     } else {
-        assignRTInt(_valuesInt.at(name), val, timestamp);
+        assignRTInt(*value, val, timestamp);
     }
 }
 void ValueNode::setRTFloat(const std::string& name, double val,
     int64_t timestamp)
 {
-    if (_valuesFloat.count(name) == 0) {
+    ValueHotFloat* value = _indexFloat.find(name);
+    if (value == nullptr) {
         throw std::logic_error(
             "RhIO unknown value Float name: '" + name + "' in '"
             + BaseNode::pwd + "'");
     } else {
-        assignRTFloat(_valuesFloat.at(name), val, timestamp);
+        assignRTFloat(*value, val, timestamp);
+    }
+}
+void ValueNode::setRTStr(const std::string& name, const std::string& val,
+    int64_t timestamp)
+{
+    ValueHotStr* value = _indexStr.find(name);
+    if (value == nullptr) {
+        throw std::logic_error(
+            "RhIO unknown value Str name: '" + name + "' in '"
+            + BaseNode::pwd + "'");
+    } else {
+        assignRTStr(*value, val, timestamp);
+    }
+}
+void ValueNode::setRTFloatArray(const std::string& name, const double* data,
+    int64_t timestamp)
+{
+    ValueHotFloatArray* value = _indexFloatArray.find(name);
+    if (value == nullptr) {
+        throw std::logic_error(
+            "RhIO unknown value FloatArray name: '" + name + "' in '"
+            + BaseNode::pwd + "'");
+    } else {
+        assignRTFloatArray(*value, data, timestamp);
     }
 }
 
-int64_t ValueNode::addRTInt(const std::string& name, int64_t val,
+void ValueNode::setReadOnlyInt(const std::string& name, int64_t val,
     int64_t timestamp)
 {
+    //Forward to subtree
+    std::string tmpName;
+    ValueNode* child = BaseNode::forwardFunc(name, tmpName, false);
+    if (child != nullptr) {
+        child->setReadOnlyInt(tmpName, val, timestamp);
+        return;
+    }
+
+    std::lock_guard<std::mutex> lock(_mutex);
     if (_valuesInt.count(name) == 0) {
+        throw std::logic_error("RhIO unknown value Int name: '" + name + "' in '"
+            + BaseNode::pwd + "'");
+    }
+    ValueHotInt& valueStruct = _valuesInt.at(name);
+    if (!valueStruct.readOnly) {
+        throw std::logic_error("RhIO not read-only value Int name: '" + name + "' in '"
+            + BaseNode::pwd + "'");
+    }
+    assignReadOnlyInt(valueStruct, val, timestamp);
+}
+
+int64_t ValueNode::addRTInt(const std::string& name, int64_t val,
+    int64_t timestamp)
+{
+    ValueHotInt* value = _indexInt.find(name);
+    if (value == nullptr) {
         throw std::logic_error(
             "RhIO unknown value Int name: '" + name + "' in '"
             + BaseNode::pwd + "'");
     } else {
+        checkWritable(*value);
         //Update value
-        int64_t fetch = _valuesInt[name].value.fetch_add(val);
-        _valuesInt[name].timestamp = timestamp;
+        int64_t fetch;
+        {
+            WriteGuard guard(*this);
+            fetch = value->value.fetch_add(val);
+            value->timestamp.store(timestamp, std::memory_order_relaxed);
+        }
         //Publish value
-        if (_valuesInt.at(name).streamWatchers.load() > 0) {
+        if (isStreamed(*value, fetch + val, timestamp)) {
             if (ServerStream != nullptr) {
                 ServerStream->publishInt(
-                    _valuesInt[name].path,
-                    fetch + val, timestamp);
+                    value->id,
+                    fetch + val, timestamp,
+                    value->streamFilter.latestOnly);
             }
         }
         //Log value
         if (ServerLogging != nullptr) {
             ServerLogging->logInt(
-                _valuesInt[name].path,
+                value->id,
                 fetch + val, timestamp);
         }
         return fetch;
@@ -414,25 +484,32 @@ int64_t ValueNode::addRTInt(const std::string& name, int64_t val,
 int64_t ValueNode::subRTInt(const std::string& name, int64_t val,
     int64_t timestamp)
 {
-    if (_valuesInt.count(name) == 0) {
+    ValueHotInt* value = _indexInt.find(name);
+    if (value == nullptr) {
         throw std::logic_error(
             "RhIO unknown value Int name: '" + name + "' in '"
             + BaseNode::pwd + "'");
     } else {
+        checkWritable(*value);
         //Update value
-        int64_t fetch = _valuesInt[name].value.fetch_sub(val);
-        _valuesInt[name].timestamp = timestamp;
+        int64_t fetch;
+        {
+            WriteGuard guard(*this);
+            fetch = value->value.fetch_sub(val);
+            value->timestamp.store(timestamp, std::memory_order_relaxed);
+        }
         //Publish value
-        if (_valuesInt.at(name).streamWatchers.load() > 0) {
+        if (isStreamed(*value, fetch - val, timestamp)) {
             if (ServerStream != nullptr) {
                 ServerStream->publishInt(
-                    _valuesInt[name].path,
-                    fetch - val, timestamp);
+                    value->id,
+                    fetch - val, timestamp,
+                    value->streamFilter.latestOnly);
             }
         }
         if (ServerLogging != nullptr) {
             ServerLogging->logInt(
-                _valuesInt[name].path,
+                value->id,
                 fetch - val, timestamp);
         }
         return fetch;
@@ -442,25 +519,32 @@ int64_t ValueNode::subRTInt(const std::string& name, int64_t val,
 bool ValueNode::toggleRTBool(const std::string& name,
     int64_t timestamp)
 {
-    if (_valuesBool.count(name) == 0) {
+    ValueHotBool* value = _indexBool.find(name);
+    if (value == nullptr) {
         throw std::logic_error(
             "RhIO unknown value Bool name: '" + name + "' in '"
             + BaseNode::pwd + "'");
     } else {
+        checkWritable(*value);
         //Update value
-        int64_t fetch = _valuesBool[name].value.fetch_xor(1);
-        _valuesBool[name].timestamp = timestamp;
+        int64_t fetch;
+        {
+            WriteGuard guard(*this);
+            fetch = value->value.fetch_xor(1);
+            value->timestamp.store(timestamp, std::memory_order_relaxed);
+        }
         //Publish value
-        if (_valuesBool.at(name).streamWatchers.load() > 0) {
+        if (isStreamed(*value, !(bool)fetch, timestamp)) {
             if (ServerStream != nullptr) {
                 ServerStream->publishBool(
-                    _valuesBool[name].path,
-                    (!(bool)fetch), timestamp);
+                    value->id,
+                    (!(bool)fetch), timestamp,
+                    value->streamFilter.latestOnly);
             }
         }
         if (ServerLogging != nullptr) {
             ServerLogging->logBool(
-                _valuesBool[name].path,
+                value->id,
                 (!(bool)fetch), timestamp);
         }
         return (bool)fetch;
@@ -471,31 +555,45 @@ bool ValueNode::toggleRTBool(const std::string& name,
  * Callback logging newly created persisted value
  * (log default parameter values)
  */
-static std::function<void(ValueBool& val)> callbackNewBool = [](ValueBool& val) {
-    if (val.persisted) {
+static std::function<void(ValueHotBool& val)> callbackNewBool = [](ValueHotBool& val) {
+    if (val.meta().persisted) {
         if (ServerLogging != nullptr) {
             ServerLogging->logBool(
-                val.path, val.value, val.timestamp);
+                val.id, val.value, val.timestamp);
         }
     }
 };
-static std::function<void(ValueInt& val)> callbackNewInt = [](ValueInt& val) {
-    if (val.persisted) {
+static std::function<void(ValueHotInt& val)> callbackNewInt = [](ValueHotInt& val) {
+    if (val.meta().persisted) {
         if (ServerLogging != nullptr) {
             ServerLogging->logInt(
-                val.path, val.value, val.timestamp);
+                val.id, val.value, val.timestamp);
         }
     }
 };
-static std::function<void(ValueFloat& val)> callbackNewFloat = [](ValueFloat& val) {
-    if (val.persisted) {
+static std::function<void(ValueHotFloat& val)> callbackNewFloat = [](ValueHotFloat& val) {
+    if (val.meta().persisted) {
         if (ServerLogging != nullptr) {
             ServerLogging->logFloat(
-                val.path, val.value, val.timestamp);
+                val.id, val.value, val.timestamp);
+        }
+    }
+};
+static std::function<void(ValueHotFloatArray& val)> callbackNewFloatArray = [](ValueHotFloatArray& val) {
+    if (val.meta().persisted) {
+        if (ServerLogging != nullptr) {
+            std::vector<double> data = val.value.load();
+            ServerLogging->logFloatArray(
+                val.id, data.data(), data.size(), val.timestamp);
         }
     }
 };
 
+ValueBatch ValueNode::batch()
+{
+    return ValueBatch(*this);
+}
+
 std::unique_ptr<ValueBuilderBool> ValueNode::newBool(
     const std::string& name, int64_t timestamp)
 {
@@ -514,15 +612,17 @@ std::unique_ptr<ValueBuilderBool> ValueNode::newBool(
         } else {
             //No conflic
             return std::unique_ptr<ValueBuilderBool>(
-                new ValueBuilderBool(_valuesBool[name], true, callbackNewBool));
+                new ValueBuilderBool(*_indexBool.find(name), true, callbackNewBool));
         }
     } else {
         //Creating a really new value
         std::lock_guard<std::mutex> lock(_mutex);
-        _valuesBool[name] = ValueBool();
-        _valuesBool[name].name = name;
-        _valuesBool[name].timestamp = timestamp;
-        _valuesBool[name].path = BaseNode::pwd + separator + name;
+        _valuesBool[name] = ValueHotBool();
+        _valuesBool[name].timestamp.store(
+            timestamp, std::memory_order_relaxed);
+        _valuesBool[name].id = PathRegistry::intern(
+            BaseNode::pwd + separator + name);
+        _indexBool.insert(name, &_valuesBool.at(name));
         return std::unique_ptr<ValueBuilderBool>(
             new ValueBuilderBool(_valuesBool[name], false, callbackNewBool));
     }
@@ -545,15 +645,17 @@ std::unique_ptr<ValueBuilderInt> ValueNode::newInt(
         } else {
             //No conflic
             return std::unique_ptr<ValueBuilderInt>(
-                new ValueBuilderInt(_valuesInt[name], true, callbackNewInt));
+                new ValueBuilderInt(*_indexInt.find(name), true, callbackNewInt));
         }
     } else {
         //Creating a really new value
         std::lock_guard<std::mutex> lock(_mutex);
-        _valuesInt[name] = ValueInt();
-        _valuesInt[name].name = name;
-        _valuesInt[name].timestamp = timestamp;
-        _valuesInt[name].path = BaseNode::pwd + separator + name; 
+        _valuesInt[name] = ValueHotInt();
+        _valuesInt[name].timestamp.store(
+            timestamp, std::memory_order_relaxed);
+        _valuesInt[name].id = PathRegistry::intern(
+            BaseNode::pwd + separator + name);
+        _indexInt.insert(name, &_valuesInt.at(name));
         return std::unique_ptr<ValueBuilderInt>(
             new ValueBuilderInt(_valuesInt[name], false, callbackNewInt));
     }
@@ -576,15 +678,17 @@ std::unique_ptr<ValueBuilderFloat> ValueNode::newFloat(
         } else {
             //No conflic
             return std::unique_ptr<ValueBuilderFloat>(
-                new ValueBuilderFloat(_valuesFloat[name], true, callbackNewFloat));
+                new ValueBuilderFloat(*_indexFloat.find(name), true, callbackNewFloat));
         }
     } else {
         //Creating a really new value
         std::lock_guard<std::mutex> lock(_mutex);
-        _valuesFloat[name] = ValueFloat();
-        _valuesFloat[name].name = name;
-        _valuesFloat[name].timestamp = timestamp;
-        _valuesFloat[name].path = BaseNode::pwd + separator + name; 
+        _valuesFloat[name] = ValueHotFloat();
+        _valuesFloat[name].timestamp.store(
+            timestamp, std::memory_order_relaxed);
+        _valuesFloat[name].id = PathRegistry::intern(
+            BaseNode::pwd + separator + name);
+        _indexFloat.insert(name, &_valuesFloat.at(name));
         return std::unique_ptr<ValueBuilderFloat>(
             new ValueBuilderFloat(_valuesFloat[name], false, callbackNewFloat));
     }
@@ -607,19 +711,65 @@ std::unique_ptr<ValueBuilderStr> ValueNode::newStr(
         } else {
             //No conflic
             return std::unique_ptr<ValueBuilderStr>(
-                new ValueBuilderStr(_valuesStr[name], true));
+                new ValueBuilderStr(*_indexStr.find(name), true));
         }
     } else {
         //Creating a really new value
         std::lock_guard<std::mutex> lock(_mutex);
-        _valuesStr[name] = ValueStr();
-        _valuesStr[name].name = name;
-        _valuesStr[name].timestamp = timestamp;
-        _valuesStr[name].path = BaseNode::pwd + separator + name; 
+        _valuesStr[name] = ValueHotStr();
+        _valuesStr[name].timestamp.store(
+            timestamp, std::memory_order_relaxed);
+        _valuesStr[name].id = PathRegistry::intern(
+            BaseNode::pwd + separator + name);
+        _indexStr.insert(name, &_valuesStr.at(name));
         return std::unique_ptr<ValueBuilderStr>(
             new ValueBuilderStr(_valuesStr[name], false));
     }
 }
+std::unique_ptr<ValueBuilderFloatArray> ValueNode::newFloatArray(
+    const std::string& name, size_t size, int64_t timestamp)
+{
+    //Forward to subtree
+    std::string tmpName;
+    ValueNode* child = BaseNode::forwardFunc(name, tmpName, true);
+    if (child != nullptr) return child->newFloatArray(tmpName, size, timestamp);
+
+    if (getValueType(name) != NoValue) {
+        //The value is already registered
+        if (getValueType(name) != TypeFloatArray) {
+            //Error if type conflic
+            throw std::logic_error(
+                "RhIO value already known with other type: '" + name + "' in '"
+                + BaseNode::pwd + "'");
+        } else if (_indexFloatArray.find(name)->value.size() != size) {
+            //Error if length conflic
+            throw std::logic_error(
+                "RhIO value already known with other length: '" + name + "' in '"
+                + BaseNode::pwd + "'");
+        } else {
+            //No conflic
+            return std::unique_ptr<ValueBuilderFloatArray>(
+                new ValueBuilderFloatArray(*_indexFloatArray.find(name), 
+                    true, callbackNewFloatArray));
+        }
+    } else {
+        //Creating a really new value
+        std::lock_guard<std::mutex> lock(_mutex);
+        _valuesFloatArray[name] = ValueHotFloatArray();
+        _valuesFloatArray[name].timestamp.store(
+            timestamp, std::memory_order_relaxed);
+        _valuesFloatArray[name].id = PathRegistry::intern(
+            BaseNode::pwd + separator + name);
+        _indexFloatArray.insert(name, &_valuesFloatArray.at(name));
+        std::unique_ptr<ValueBuilderFloatArray> builder(
+            new ValueBuilderFloatArray(_valuesFloatArray[name], 
+                false, callbackNewFloatArray));
+        //Fixed length zero initialization
+        _valuesFloatArray[name].value = std::vector<double>(size, 0.0);
+        _valuesFloatArray[name].meta().valuePersisted = std::vector<double>(size, 0.0);
+        return builder;
+    }
+}
         
 void ValueNode::setCallbackBool(const std::string& name,
     std::function<void(bool)> func)
@@ -635,7 +785,8 @@ void ValueNode::setCallbackBool(const std::string& name,
         throw std::logic_error("RhIO unknown value Bool name: '" + name + "' in '"
             + BaseNode::pwd + "'");
     } else {
-        _valuesBool.at(name).callback = func;
+        _valuesBool.at(name).meta().callback = func;
+        _valuesBool.at(name).hasCallback = (bool)func;
     }
 }
 void ValueNode::setCallbackInt(const std::string& name,
@@ -652,7 +803,8 @@ void ValueNode::setCallbackInt(const std::string& name,
         throw std::logic_error("RhIO unknown value Int name: '" + name + "' in '"
             + BaseNode::pwd + "'");
     } else {
-        _valuesInt.at(name).callback = func;
+        _valuesInt.at(name).meta().callback = func;
+        _valuesInt.at(name).hasCallback = (bool)func;
     }
 }
 void ValueNode::setCallbackFloat(const std::string& name,
@@ -669,7 +821,8 @@ void ValueNode::setCallbackFloat(const std::string& name,
         throw std::logic_error("RhIO unknown value Float name: '" + name + "' in '"
             + BaseNode::pwd + "'");
     } else {
-        _valuesFloat.at(name).callback = func;
+        _valuesFloat.at(name).meta().callback = func;
+        _valuesFloat.at(name).hasCallback = (bool)func;
     }
 }
 void ValueNode::setCallbackStr(const std::string& name,
@@ -686,11 +839,30 @@ void ValueNode::setCallbackStr(const std::string& name,
         throw std::logic_error("RhIO unknown value Str name: '" + name + "' in '"
             + BaseNode::pwd + "'");
     } else {
-        _valuesStr.at(name).callback = func;
+        _valuesStr.at(name).meta().callback = func;
+        _valuesStr.at(name).hasCallback = (bool)func;
+    }
+}
+void ValueNode::setCallbackFloatArray(const std::string& name,
+    std::function<void(std::vector<double>)> func)
+{
+    //Forward to subtree
+    std::string tmpName;
+    ValueNode* child = BaseNode::forwardFunc(name, tmpName, false);
+    if (child != nullptr) return child->setCallbackFloatArray(tmpName, func);
+
+    //Assign new callback
+    std::lock_guard<std::mutex> lock(_mutex);
+    if (_valuesFloatArray.count(name) == 0) {
+        throw std::logic_error("RhIO unknown value FloatArray name: '" + name + "' in '"
+            + BaseNode::pwd + "'");
+    } else {
+        _valuesFloatArray.at(name).meta().callback = func;
+        _valuesFloatArray.at(name).hasCallback = (bool)func;
     }
 }
 
-const ValueBool& ValueNode::getValueBool(const std::string& name) const
+ValueBool ValueNode::getValueBool(const std::string& name) const
 {
     //Forward to subtree
     std::string tmpName;
@@ -702,10 +874,10 @@ const ValueBool& ValueNode::getValueBool(const std::string& name) const
         throw std::logic_error("RhIO unknown value Bool name: '" + name + "' in '"
             + BaseNode::pwd + "'");
     } else {
-        return _valuesBool.at(name);
+        return ValueBool(_valuesBool.at(name));
     }
 }
-const ValueInt& ValueNode::getValueInt(const std::string& name) const
+ValueInt ValueNode::getValueInt(const std::string& name) const
 {
     //Forward to subtree
     std::string tmpName;
@@ -717,10 +889,10 @@ const ValueInt& ValueNode::getValueInt(const std::string& name) const
         throw std::logic_error("RhIO unknown value Int name: '" + name + "' in '"
             + BaseNode::pwd + "'");
     } else {
-        return _valuesInt.at(name);
+        return ValueInt(_valuesInt.at(name));
     }
 }
-const ValueFloat& ValueNode::getValueFloat(const std::string& name) const
+ValueFloat ValueNode::getValueFloat(const std::string& name) const
 {
     //Forward to subtree
     std::string tmpName;
@@ -732,10 +904,10 @@ const ValueFloat& ValueNode::getValueFloat(const std::string& name) const
         throw std::logic_error("RhIO unknown value Float name: '" + name + "' in '"
             + BaseNode::pwd + "'");
     } else {
-        return _valuesFloat.at(name);
+        return ValueFloat(_valuesFloat.at(name));
     }
 }
-const ValueStr& ValueNode::getValueStr(const std::string& name) const
+ValueStr ValueNode::getValueStr(const std::string& name) const
 {
     //Forward to subtree
     std::string tmpName;
@@ -747,7 +919,23 @@ const ValueStr& ValueNode::getValueStr(const std::string& name) const
         throw std::logic_error("RhIO unknown value Str name: '" + name + "' in '"
             + BaseNode::pwd + "'");
     } else {
-        return _valuesStr.at(name);
+        return ValueStr(_valuesStr.at(name));
+    }
+}
+ValueFloatArray ValueNode::getValueFloatArray(
+    const std::string& name) const
+{
+    //Forward to subtree
+    std::string tmpName;
+    ValueNode* child = BaseNode::forwardFunc(name, tmpName, false);
+    if (child != nullptr) return child->getValueFloatArray(tmpName);
+
+    std::lock_guard<std::mutex> lock(_mutex);
+    if (_valuesFloatArray.count(name) == 0) {
+        throw std::logic_error("RhIO unknown value FloatArray name: '" + name + "' in '"
+            + BaseNode::pwd + "'");
+    } else {
+        return ValueFloatArray(_valuesFloatArray.at(name));
     }
 }
         
@@ -764,12 +952,19 @@ void ValueNode::enableStreamingValue(const std::string& name)
     std::lock_guard<std::mutex> lock(_mutex);
     if (_valuesBool.count(name) > 0) {
         _valuesBool.at(name).streamWatchers++;
+        _valuesBool.at(name).streamHasLast.store(false);
     } else if (_valuesInt.count(name) > 0) {
         _valuesInt.at(name).streamWatchers++;
+        _valuesInt.at(name).streamHasLast.store(false);
     } else if (_valuesFloat.count(name) > 0) {
         _valuesFloat.at(name).streamWatchers++;
+        _valuesFloat.at(name).streamHasLast.store(false);
     } else if (_valuesStr.count(name) > 0) {
         _valuesStr.at(name).streamWatchers++;
+        _valuesStr.at(name).streamHasLast.store(false);
+    } else if (_valuesFloatArray.count(name) > 0) {
+        _valuesFloatArray.at(name).streamWatchers++;
+        _valuesFloatArray.at(name).streamHasLast.store(false);
     } else {
         throw std::logic_error(
             "RhIO unknown value name: '" + name + "' in '"
@@ -807,6 +1002,11 @@ void ValueNode::disableStreamingValue(const std::string& name)
         if (_valuesStr.at(name).streamWatchers.load() < 0) {
             _valuesStr.at(name).streamWatchers.store(0);
         }
+    } else if (_valuesFloatArray.count(name) > 0) {
+        _valuesFloatArray.at(name).streamWatchers--;
+        if (_valuesFloatArray.at(name).streamWatchers.load() < 0) {
+            _valuesFloatArray.at(name).streamWatchers.store(0);
+        }
     } else {
         throw std::logic_error(
             "RhIO unknown value name: '" + name + "' in '"
@@ -840,6 +1040,10 @@ void ValueNode::checkStreamingValue(const std::string& name)
         if (_valuesStr.at(name).streamWatchers.load() <= 0) {
             _valuesStr.at(name).streamWatchers.store(1);
         }
+    } else if (_valuesFloatArray.count(name) > 0) {
+        if (_valuesFloatArray.at(name).streamWatchers.load() <= 0) {
+            _valuesFloatArray.at(name).streamWatchers.store(1);
+        }
     } else {
         throw std::logic_error(
             "RhIO unknown value name: '" + name + "' in '"
@@ -847,15 +1051,47 @@ void ValueNode::checkStreamingValue(const std::string& name)
     }
 }
 
-std::vector<std::string> ValueNode::listValuesBool() const
+void ValueNode::setStreamFilter(const std::string& name, 
+    const StreamFilter& filter)
 {
-    std::lock_guard<std::mutex> lock(_mutex);
-    std::vector<std::string> list;
-    for (const auto& v : _valuesBool) {
-        list.push_back(v.first);
+    //Forward to subtree
+    std::string tmpName;
+    ValueNode* child = BaseNode::forwardFunc(name, tmpName, false);
+    if (child != nullptr) {
+        child->setStreamFilter(tmpName, filter);
+        return;
     }
-
-    return list;
+    
+    std::lock_guard<std::mutex> lock(_mutex);
+    ValueStream* ptrValue = nullptr;
+    if (_valuesBool.count(name) > 0) {
+        ptrValue = &(_valuesBool.at(name));
+    } else if (_valuesInt.count(name) > 0) {
+        ptrValue = &(_valuesInt.at(name));
+    } else if (_valuesFloat.count(name) > 0) {
+        ptrValue = &(_valuesFloat.at(name));
+    } else if (_valuesStr.count(name) > 0) {
+        ptrValue = &(_valuesStr.at(name));
+    } else if (_valuesFloatArray.count(name) > 0) {
+        ptrValue = &(_valuesFloatArray.at(name));
+    } else {
+        throw std::logic_error(
+            "RhIO unknown value name: '" + name + "' in '"
+            + BaseNode::pwd + "'");
+    }
+    ptrValue->streamFilter.store(filter);
+    ptrValue->streamHasLast.store(false);
+}
+
+std::vector<std::string> ValueNode::listValuesBool() const
+{
+    std::lock_guard<std::mutex> lock(_mutex);
+    std::vector<std::string> list;
+    for (const auto& v : _valuesBool) {
+        list.push_back(v.first);
+    }
+
+    return list;
 }
 std::vector<std::string> ValueNode::listValuesInt() const
 {
@@ -887,6 +1123,16 @@ std::vector<std::string> ValueNode::listValuesStr() const
 
     return list;
 }
+std::vector<std::string> ValueNode::listValuesFloatArray() const
+{
+    std::lock_guard<std::mutex> lock(_mutex);
+    std::vector<std::string> list;
+    for (const auto& v : _valuesFloatArray) {
+        list.push_back(v.first);
+    }
+
+    return list;
+}
         
 bool ValueNode::isNeededSaveValue() const
 {
@@ -894,16 +1140,19 @@ bool ValueNode::isNeededSaveValue() const
 
     bool hasValues = false;
     for (const auto& v : _valuesBool) {
-        if (v.second.persisted) hasValues = true;
+        if (v.second.meta().persisted) hasValues = true;
     }
     for (const auto& v : _valuesInt) {
-        if (v.second.persisted) hasValues = true;
+        if (v.second.meta().persisted) hasValues = true;
     }
     for (const auto& v : _valuesFloat) {
-        if (v.second.persisted) hasValues = true;
+        if (v.second.meta().persisted) hasValues = true;
     }
     for (const auto& v : _valuesStr) {
-        if (v.second.persisted) hasValues = true;
+        if (v.second.meta().persisted) hasValues = true;
+    }
+    for (const auto& v : _valuesFloatArray) {
+        if (v.second.meta().persisted) hasValues = true;
     }
 
     return hasValues;
@@ -939,48 +1188,64 @@ void ValueNode::saveValues(const std::string& path)
     out.SetIndent(4);
     out << YAML::BeginMap;
     //Write Bool values
-    for (auto& v : _valuesBool) {
-        if (v.second.persisted) {
-            out << YAML::Key << v.second.name;
+    for (const auto& v : _valuesBool) {
+        if (v.second.meta().persisted) {
+            out << YAML::Key << v.second.meta().name;
             if (v.second.value) {
                 out << YAML::Value << "true";
             } else {
                 out << YAML::Value << "false";
             }
             //Update persisted value
-            v.second.valuePersisted = v.second.value;
+            v.second.meta().valuePersisted = v.second.value;
         }
     }
     //Write Int values
-    for (auto& v : _valuesInt) {
-        if (v.second.persisted) {
+    for (const auto& v : _valuesInt) {
+        if (v.second.meta().persisted) {
             std::ostringstream ss;
             ss << (int64_t)v.second.value;
-            out << YAML::Key << v.second.name;
+            out << YAML::Key << v.second.meta().name;
             out << YAML::Value << ss.str();
             //Update persisted value
-            v.second.valuePersisted = v.second.value;
+            v.second.meta().valuePersisted = v.second.value;
         }
     }
     //Write Float values
-    for (auto& v : _valuesFloat) {
-        if (v.second.persisted) {
+    for (const auto& v : _valuesFloat) {
+        if (v.second.meta().persisted) {
             std::ostringstream ss;
             ss << std::fixed << std::setprecision(15) 
                 << (double)v.second.value;
-            out << YAML::Key << v.second.name;
+            out << YAML::Key << v.second.meta().name;
             out << YAML::Value << ss.str();
             //Update persisted value
-            v.second.valuePersisted = v.second.value;
+            v.second.meta().valuePersisted = v.second.value;
         }
     }
     //Write Str values
-    for (auto& v : _valuesStr) {
-        if (v.second.persisted) {
-            out << YAML::Key << v.second.name;
-            out << YAML::Value << v.second.value;
+    for (const auto& v : _valuesStr) {
+        if (v.second.meta().persisted) {
+            out << YAML::Key << v.second.meta().name;
+            out << YAML::Value << v.second.value.load();
+            //Update persisted value
+            v.second.meta().valuePersisted = v.second.value.load();
+        }
+    }
+    //Write FloatArray values as sequences
+    for (const auto& v : _valuesFloatArray) {
+        if (v.second.meta().persisted) {
+            std::vector<double> data = v.second.value.load();
+            out << YAML::Key << v.second.meta().name;
+            out << YAML::Value << YAML::Flow << YAML::BeginSeq;
+            for (size_t i=0;i<data.size();i++) {
+                std::ostringstream ss;
+                ss << std::fixed << std::setprecision(15) << data[i];
+                out << ss.str();
+            }
+            out << YAML::EndSeq;
             //Update persisted value
-            v.second.valuePersisted = v.second.value;
+            v.second.meta().valuePersisted = data;
         }
     }
     out << YAML::EndMap;
@@ -1021,6 +1286,26 @@ void ValueNode::loadValues(const std::string& path)
                 throw std::runtime_error(
                     "RhIO invalid name (separator): " + name);
             }
+            if (it.second.IsSequence()) {
+                //FloatArray type
+                std::vector<double> data = 
+                    it.second.as<std::vector<double>>();
+                if (_valuesFloatArray.count(name) == 0) {
+                    _valuesFloatArray[name] = ValueHotFloatArray();
+                    ValueBuilderFloatArray(_valuesFloatArray[name], false);
+                    _valuesFloatArray[name].id = PathRegistry::intern(
+                        BaseNode::pwd + separator + name);
+                    _valuesFloatArray.at(name).value = data;
+                    _indexFloatArray.insert(name, &_valuesFloatArray.at(name));
+                } else if (_valuesFloatArray.at(name).value.size() != data.size()) {
+                    throw std::runtime_error(
+                        "RhIO invalid FloatArray length: " + name);
+                } else {
+                    _valuesFloatArray.at(name).value.store(data);
+                }
+                _valuesFloatArray.at(name).meta().valuePersisted = data;
+                continue;
+            }
             if (!it.second.IsScalar()) {
                 throw std::runtime_error(
                     "RhIO invalid format (map type)");
@@ -1059,44 +1344,48 @@ void ValueNode::loadValues(const std::string& path)
                 ) {
                     //Bool type
                     if (_valuesBool.count(name) == 0) {
-                        _valuesBool[name] = ValueBool();
-                        _valuesBool[name].name = name;
-                        _valuesBool[name].path = BaseNode::pwd + separator + name, 
+                        _valuesBool[name] = ValueHotBool();
                         ValueBuilderBool(_valuesBool[name], false);
+                        _valuesBool[name].id = PathRegistry::intern(
+                            BaseNode::pwd + separator + name);
+                        _indexBool.insert(name, &_valuesBool.at(name));
                     }
                     _valuesBool.at(name).value = it.second.as<bool>();
-                    _valuesBool.at(name).valuePersisted = it.second.as<bool>();
+                    _valuesBool.at(name).meta().valuePersisted = it.second.as<bool>();
                 } else {
                     //String type
                     if (_valuesStr.count(name) == 0) {
-                        _valuesStr[name] = ValueStr();
-                        _valuesStr[name].name = name;
-                        _valuesStr[name].path = BaseNode::pwd + separator + name, 
+                        _valuesStr[name] = ValueHotStr();
                         ValueBuilderStr(_valuesStr[name], false);
+                        _valuesStr[name].id = PathRegistry::intern(
+                            BaseNode::pwd + separator + name);
+                        _indexStr.insert(name, &_valuesStr.at(name));
                     }
                     _valuesStr.at(name).value = it.second.as<std::string>();
-                    _valuesStr.at(name).valuePersisted = it.second.as<std::string>();
+                    _valuesStr.at(name).meta().valuePersisted = it.second.as<std::string>();
                 }
             } else if (!isInt && isFloat && isStr) {
                 //Float type
                 if (_valuesFloat.count(name) == 0) {
-                    _valuesFloat[name] = ValueFloat();
-                    _valuesFloat[name].name = name;
-                    _valuesFloat[name].path = BaseNode::pwd + separator + name, 
+                    _valuesFloat[name] = ValueHotFloat();
                     ValueBuilderFloat(_valuesFloat[name], false);
+                    _valuesFloat[name].id = PathRegistry::intern(
+                        BaseNode::pwd + separator + name);
+                    _indexFloat.insert(name, &_valuesFloat.at(name));
                 }
                 _valuesFloat.at(name).value = it.second.as<double>();
-                _valuesFloat.at(name).valuePersisted = it.second.as<double>();
+                _valuesFloat.at(name).meta().valuePersisted = it.second.as<double>();
             } else if (isInt && isFloat && isStr) {
                 //Int type
                 if (_valuesInt.count(name) == 0) {
-                    _valuesInt[name] = ValueInt();
-                    _valuesInt[name].name = name;
-                    _valuesInt[name].path = BaseNode::pwd + separator + name, 
+                    _valuesInt[name] = ValueHotInt();
                     ValueBuilderInt(_valuesInt[name], false);
+                    _valuesInt[name].id = PathRegistry::intern(
+                        BaseNode::pwd + separator + name);
+                    _indexInt.insert(name, &_valuesInt.at(name));
                 }
                 _valuesInt.at(name).value = it.second.as<int64_t>();
-                _valuesInt.at(name).valuePersisted = it.second.as<int64_t>();
+                _valuesInt.at(name).meta().valuePersisted = it.second.as<int64_t>();
             } else {
                 throw std::runtime_error(
                     "RhIO unknown type: " + name);
@@ -1108,7 +1397,41 @@ void ValueNode::loadValues(const std::string& path)
     }
 }
 
-ValueBool& ValueNode::accessValueBool(const std::string& name)
+void ValueNode::listValuesPtr(
+    std::vector<const ValueHotBool*>& listBool,
+    std::vector<const ValueHotInt*>& listInt,
+    std::vector<const ValueHotFloat*>& listFloat,
+    std::vector<const ValueHotStr*>& listStr,
+    std::vector<const ValueHotFloatArray*>& listFloatArray) const
+{
+    std::lock_guard<std::mutex> lock(_mutex);
+    for (const auto& it : _valuesBool) {
+        listBool.push_back(&(it.second));
+    }
+    for (const auto& it : _valuesInt) {
+        listInt.push_back(&(it.second));
+    }
+    for (const auto& it : _valuesFloat) {
+        listFloat.push_back(&(it.second));
+    }
+    for (const auto& it : _valuesStr) {
+        listStr.push_back(&(it.second));
+    }
+    for (const auto& it : _valuesFloatArray) {
+        listFloatArray.push_back(&(it.second));
+    }
+}
+
+uint64_t ValueNode::countWritesBegin() const
+{
+    return _writesBegin.load();
+}
+uint64_t ValueNode::countWritesEnd() const
+{
+    return _writesEnd.load();
+}
+
+ValueHotBool& ValueNode::accessValueBool(const std::string& name)
 {
     //Forward to subtree
     std::string tmpName;
@@ -1123,7 +1446,7 @@ ValueBool& ValueNode::accessValueBool(const std::string& name)
         return _valuesBool.at(name);
     }
 }
-ValueInt& ValueNode::accessValueInt(const std::string& name)
+ValueHotInt& ValueNode::accessValueInt(const std::string& name)
 {
     //Forward to subtree
     std::string tmpName;
@@ -1138,7 +1461,7 @@ ValueInt& ValueNode::accessValueInt(const std::string& name)
         return _valuesInt.at(name);
     }
 }
-ValueFloat& ValueNode::accessValueFloat(const std::string& name)
+ValueHotFloat& ValueNode::accessValueFloat(const std::string& name)
 {
     //Forward to subtree
     std::string tmpName;
@@ -1153,7 +1476,7 @@ ValueFloat& ValueNode::accessValueFloat(const std::string& name)
         return _valuesFloat.at(name);
     }
 }
-ValueStr& ValueNode::accessValueStr(const std::string& name)
+ValueHotStr& ValueNode::accessValueStr(const std::string& name)
 {
     //Forward to subtree
     std::string tmpName;
@@ -1168,11 +1491,364 @@ ValueStr& ValueNode::accessValueStr(const std::string& name)
         return _valuesStr.at(name);
     }
 }
+ValueHotFloatArray& ValueNode::accessValueFloatArray(const std::string& name)
+{
+    //Forward to subtree
+    std::string tmpName;
+    ValueNode* child = BaseNode::forwardFunc(name, tmpName, false);
+    if (child != nullptr) return child->accessValueFloatArray(tmpName);
+
+    std::lock_guard<std::mutex> lock(_mutex);
+    if (_valuesFloatArray.count(name) == 0) {
+        throw std::logic_error("RhIO unknown value FloatArray name: '" + name + "' in '"
+            + BaseNode::pwd + "'");
+    } else {
+        return _valuesFloatArray.at(name);
+    }
+}
+
+/**
+ * Scoped try lock of the streaming filter 
+ * state of a value. Concurrent updates 
+ * of the same value never wait.
+ */
+class StreamFilterLock
+{
+    public:
+        StreamFilterLock(ValueStream& valueStruct) :
+            _valueStruct(valueStruct),
+            _isLocked(!valueStruct.streamBusy.exchange(
+                true, std::memory_order_acquire))
+        {
+        }
+        ~StreamFilterLock()
+        {
+            if (_isLocked) {
+                _valueStruct.streamBusy.store(
+                    false, std::memory_order_release);
+            }
+        }
+        bool isLocked() const
+        {
+            return _isLocked;
+        }
+    private:
+        ValueStream& _valueStruct;
+        bool _isLocked;
+};
+
+/**
+ * Return true if given timestamp is within
+ * given filter max rate period after given 
+ * last published timestamp
+ */
+static bool isRateLimited(const StreamFilter& filter, 
+    int64_t lastTimestamp, int64_t timestamp)
+{
+    return
+        filter.periodMin > 0 &&
+        timestamp >= lastTimestamp &&
+        timestamp - lastTimestamp < filter.periodMin;
+}
+
+/**
+ * Mark the last sample of given value as
+ * suppressed by the max rate and register it
+ * to the streaming server to be published
+ * once the period expires
+ */
+static void setStreamPending(ValueStream& valueStruct, size_t id)
+{
+    if (
+        !valueStruct.streamPending.exchange(true) &&
+        ServerStream != nullptr &&
+        !ServerStream->publishPending(id)
+    ) {
+        valueStruct.streamPending.store(false);
+    }
+}
+
+/**
+ * Store given published sample 
+ * as the filter last state
+ */
+static void setStreamLast(ValueStream& valueStruct, 
+    double val, size_t hash, int64_t timestamp)
+{
+    valueStruct.streamLastValue.store(val);
+    valueStruct.streamLastHash.store(hash);
+    valueStruct.streamLastTimestamp.store(timestamp);
+    valueStruct.streamHasLast.store(true);
+    valueStruct.streamPending.store(false);
+}
+
+/**
+ * Streaming filter check and update
+ * for numeric values (see isStreamed)
+ */
+template <typename T>
+static bool isStreamedNumber(T& valueStruct, 
+    double val, int64_t timestamp)
+{
+    if (valueStruct.streamWatchers.load() <= 0) {
+        return false;
+    }
+    StreamFilter filter = valueStruct.streamFilter.load();
+    if (!filter.isEnabled()) {
+        return true;
+    }
+    //Concurrently updated sample is published
+    //without checking the filter state
+    StreamFilterLock lock(valueStruct);
+    if (!lock.isLocked()) {
+        return true;
+    }
+    //Always publish the first value
+    if (valueStruct.streamHasLast.load()) {
+        //Change and deadbands
+        double last = valueStruct.streamLastValue.load();
+        double delta = std::fabs(val - last);
+        if (
+            (filter.onChange && delta == 0.0) ||
+            (filter.deadbandAbs > 0.0 && delta <= filter.deadbandAbs) ||
+            (filter.deadbandRel > 0.0 && 
+                delta <= filter.deadbandRel*std::fabs(last))
+        ) {
+            //Back to the last published value
+            valueStruct.streamPending.store(false);
+            return false;
+        }
+        //Max rate decimation
+        if (isRateLimited(filter, 
+            valueStruct.streamLastTimestamp.load(), timestamp)
+        ) {
+            setStreamPending(valueStruct, valueStruct.id);
+            return false;
+        }
+    }
+    setStreamLast(valueStruct, val, 0, timestamp);
+
+    return true;
+}
+/**
+ * Streaming filter check and update
+ * for hashed values (see isStreamed)
+ */
+template <typename T>
+static bool isStreamedHash(T& valueStruct, 
+    size_t hash, int64_t timestamp)
+{
+    StreamFilter filter = valueStruct.streamFilter.load();
+    //Concurrently updated sample is published
+    //without checking the filter state
+    StreamFilterLock lock(valueStruct);
+    if (!lock.isLocked()) {
+        return true;
+    }
+    if (valueStruct.streamHasLast.load()) {
+        if (
+            filter.onChange && 
+            hash == valueStruct.streamLastHash.load()
+        ) {
+            //Back to the last published value
+            valueStruct.streamPending.store(false);
+            return false;
+        }
+        //Max rate decimation
+        if (isRateLimited(filter, 
+            valueStruct.streamLastTimestamp.load(), timestamp)
+        ) {
+            setStreamPending(valueStruct, valueStruct.id);
+            return false;
+        }
+    }
+    setStreamLast(valueStruct, 0.0, hash, timestamp);
+
+    return true;
+}
+
+/**
+ * Check if the pending sample of given value
+ * (see setStreamPending) has to be published at 
+ * given time with given current value or hash 
+ * and update the filter state.
+ * isPublished is set if the current value has to 
+ * be published. Return false if the sample 
+ * is still pending.
+ */
+template <typename T>
+static bool isStreamedPending(T& valueStruct, 
+    double val, size_t hash, int64_t timestamp, bool& isPublished)
+{
+    isPublished = false;
+    StreamFilterLock lock(valueStruct);
+    if (!lock.isLocked()) {
+        return false;
+    }
+    if (!valueStruct.streamPending.load()) {
+        return true;
+    }
+    if (valueStruct.streamWatchers.load() <= 0) {
+        valueStruct.streamPending.store(false);
+        return true;
+    }
+    StreamFilter filter = valueStruct.streamFilter.load();
+    if (isRateLimited(filter, 
+        valueStruct.streamLastTimestamp.load(), timestamp)
+    ) {
+        return false;
+    }
+    setStreamLast(valueStruct, 
+        val, hash, valueStruct.timestamp.load());
+    isPublished = true;
+
+    return true;
+}
+
+/**
+ * Hash of float array data for
+ * streaming filter (FNV-1a over raw bytes)
+ */
+static size_t hashFloatArray(const double* data, size_t size)
+{
+    const unsigned char* bytes = (const unsigned char*)data;
+    size_t length = size*sizeof(double);
+    uint64_t hash = 14695981039346656037ULL;
+    for (size_t i=0;i<length;i++) {
+        hash ^= bytes[i];
+        hash *= 1099511628211ULL;
+    }
+    return (size_t)hash;
+}
+
+void ValueNode::checkWritable(const ValueBase& valueStruct)
+{
+    if (valueStruct.readOnly) {
+        throw std::logic_error(
+            "RhIO read-only value: '" + valueStruct.getName() + "'");
+    }
+}
+
+bool ValueNode::isStreamed(ValueHotBool& valueStruct, 
+    double val, int64_t timestamp)
+{
+    return isStreamedNumber(valueStruct, val, timestamp);
+}
+bool ValueNode::isStreamed(ValueHotInt& valueStruct, 
+    double val, int64_t timestamp)
+{
+    return isStreamedNumber(valueStruct, val, timestamp);
+}
+bool ValueNode::isStreamed(ValueHotFloat& valueStruct, 
+    double val, int64_t timestamp)
+{
+    return isStreamedNumber(valueStruct, val, timestamp);
+}
+bool ValueNode::isStreamed(ValueHotStr& valueStruct, 
+    const std::string& val, int64_t timestamp)
+{
+    if (valueStruct.streamWatchers.load() <= 0) {
+        return false;
+    }
+    if (!valueStruct.streamFilter.load().isEnabled()) {
+        return true;
+    }
+    //Deadbands are ignored for strings
+    return isStreamedHash(valueStruct, 
+        std::hash<std::string>()(val), timestamp);
+}
+bool ValueNode::isStreamed(ValueHotFloatArray& valueStruct, 
+    const double* data, int64_t timestamp)
+{
+    if (valueStruct.streamWatchers.load() <= 0) {
+        return false;
+    }
+    if (!valueStruct.streamFilter.load().isEnabled()) {
+        return true;
+    }
+    //Deadbands are ignored for arrays
+    return isStreamedHash(valueStruct, 
+        hashFloatArray(data, valueStruct.value.size()), timestamp);
+}
+
+bool ValueNode::flushStreamingValue(const std::string& name, 
+    int64_t timestamp)
+{
+    //Forward to subtree
+    std::string tmpName;
+    ValueNode* child = BaseNode::forwardFunc(name, tmpName, false);
+    if (child != nullptr) {
+        return child->flushStreamingValue(tmpName, timestamp);
+    }
+    
+    std::lock_guard<std::mutex> lock(_mutex);
+    bool isDone = false;
+    bool isPublished = false;
+    if (_valuesBool.count(name) > 0) {
+        ValueHotBool& valueStruct = _valuesBool.at(name);
+        bool val = valueStruct.value.load();
+        isDone = isStreamedPending(valueStruct, 
+            val, 0, timestamp, isPublished);
+        if (isPublished && ServerStream != nullptr) {
+            ServerStream->publishBool(valueStruct.id, 
+                val, valueStruct.timestamp.load(), 
+                valueStruct.streamFilter.latestOnly);
+        }
+    } else if (_valuesInt.count(name) > 0) {
+        ValueHotInt& valueStruct = _valuesInt.at(name);
+        int64_t val = valueStruct.value.load();
+        isDone = isStreamedPending(valueStruct, 
+            val, 0, timestamp, isPublished);
+        if (isPublished && ServerStream != nullptr) {
+            ServerStream->publishInt(valueStruct.id, 
+                val, valueStruct.timestamp.load(), 
+                valueStruct.streamFilter.latestOnly);
+        }
+    } else if (_valuesFloat.count(name) > 0) {
+        ValueHotFloat& valueStruct = _valuesFloat.at(name);
+        double val = valueStruct.value.load();
+        isDone = isStreamedPending(valueStruct, 
+            val, 0, timestamp, isPublished);
+        if (isPublished && ServerStream != nullptr) {
+            ServerStream->publishFloat(valueStruct.id, 
+                val, valueStruct.timestamp.load(), 
+                valueStruct.streamFilter.latestOnly);
+        }
+    } else if (_valuesStr.count(name) > 0) {
+        ValueHotStr& valueStruct = _valuesStr.at(name);
+        std::string val = valueStruct.value.load();
+        isDone = isStreamedPending(valueStruct, 
+            0.0, std::hash<std::string>()(val), timestamp, isPublished);
+        if (isPublished && ServerStream != nullptr) {
+            ServerStream->publishStr(valueStruct.id, 
+                val, valueStruct.timestamp.load());
+        }
+    } else if (_valuesFloatArray.count(name) > 0) {
+        ValueHotFloatArray& valueStruct = _valuesFloatArray.at(name);
+        std::vector<double> val(valueStruct.value.size());
+        valueStruct.value.load(val.data());
+        isDone = isStreamedPending(valueStruct, 
+            0.0, hashFloatArray(val.data(), val.size()), 
+            timestamp, isPublished);
+        if (isPublished && ServerStream != nullptr) {
+            ServerStream->publishFloatArray(valueStruct.id, 
+                val.data(), val.size(), 
+                valueStruct.timestamp.load());
+        }
+    } else {
+        throw std::logic_error(
+            "RhIO unknown value name: '" + name + "' in '"
+            + BaseNode::pwd + "'");
+    }
+
+    return isDone;
+}
 
 void ValueNode::assignRTBool(
-    ValueBool& valueStruct,
+    ValueHotBool& valueStruct,
     double val, int64_t timestamp)
 {
+    checkWritable(valueStruct);
     //Bound to min/max
     if (
         valueStruct.hasMin && 
@@ -1187,27 +1863,32 @@ void ValueNode::assignRTBool(
         val = valueStruct.max;
     }
     //Update value
-    valueStruct.value.store(val);
-    valueStruct.timestamp = timestamp;
+    {
+        WriteGuard guard(*this);
+        valueStruct.value.store(val);
+        valueStruct.timestamp.store(timestamp, std::memory_order_relaxed);
+    }
     //Publish value
-    if (valueStruct.streamWatchers.load() > 0) {
+    if (isStreamed(valueStruct, val, timestamp)) {
         if (ServerStream != nullptr) {
             ServerStream->publishBool(
-                valueStruct.path,
-                val, timestamp);
+                valueStruct.id,
+                val, timestamp,
+                valueStruct.streamFilter.latestOnly);
         }
     }
     //Log value
     if (ServerLogging != nullptr) {
         ServerLogging->logBool(
-            valueStruct.path,
+            valueStruct.id,
             val, timestamp);
     }
 }
 void ValueNode::assignRTInt(
-    ValueInt& valueStruct,
+    ValueHotInt& valueStruct,
     double val, int64_t timestamp)
 {
+    checkWritable(valueStruct);
     //Bound to min/max
     if (
         valueStruct.hasMin && 
@@ -1222,27 +1903,32 @@ void ValueNode::assignRTInt(
         val = valueStruct.max;
     }
     //Update value
-    valueStruct.value.store(val);
-    valueStruct.timestamp = timestamp;
+    {
+        WriteGuard guard(*this);
+        valueStruct.value.store(val);
+        valueStruct.timestamp.store(timestamp, std::memory_order_relaxed);
+    }
     //Publish value
-    if (valueStruct.streamWatchers.load() > 0) {
+    if (isStreamed(valueStruct, val, timestamp)) {
         if (ServerStream != nullptr) {
             ServerStream->publishInt(
-                valueStruct.path,
-                val, timestamp);
+                valueStruct.id,
+                val, timestamp,
+                valueStruct.streamFilter.latestOnly);
         }
     }
     //Log value
     if (ServerLogging != nullptr) {
         ServerLogging->logInt(
-            valueStruct.path,
+            valueStruct.id,
             val, timestamp);
     }
 }
 void ValueNode::assignRTFloat(
-    ValueFloat& valueStruct,
+    ValueHotFloat& valueStruct,
     double val, int64_t timestamp)
 {
+    checkWritable(valueStruct);
     //Bound to min/max
     if (
         valueStruct.hasMin && 
@@ -1257,23 +1943,628 @@ void ValueNode::assignRTFloat(
         val = valueStruct.max;
     }
     //Update value
-    valueStruct.value.store(val);
-    valueStruct.timestamp = timestamp;
+    {
+        WriteGuard guard(*this);
+        valueStruct.value.store(val);
+        valueStruct.timestamp.store(timestamp, std::memory_order_relaxed);
+    }
     //Publish value
-    if (valueStruct.streamWatchers.load() > 0) {
+    if (isStreamed(valueStruct, val, timestamp)) {
         if (ServerStream != nullptr) {
             ServerStream->publishFloat(
-                valueStruct.path,
-                val, timestamp);
+                valueStruct.id,
+                val, timestamp,
+                valueStruct.streamFilter.latestOnly);
         }
     }
     //Log value
     if (ServerLogging != nullptr) {
         ServerLogging->logFloat(
-            valueStruct.path,
+            valueStruct.id,
             val, timestamp);
     }
 }
+void ValueNode::assignRTStr(
+    ValueHotStr& valueStruct,
+    const std::string& val, int64_t timestamp)
+{
+    checkWritable(valueStruct);
+    //Bound to min/max
+    const std::string* ptrVal = &val;
+    if (
+        valueStruct.hasMin && 
+        val < valueStruct.min
+    ) {
+        ptrVal = &valueStruct.min;
+    }
+    if (
+        valueStruct.hasMax && 
+        val > valueStruct.max
+    ) {
+        ptrVal = &valueStruct.max;
+    }
+    //Update value
+    {
+        WriteGuard guard(*this);
+        valueStruct.value.store(*ptrVal);
+        valueStruct.timestamp.store(timestamp, std::memory_order_relaxed);
+    }
+    //Publish value
+    if (isStreamed(valueStruct, *ptrVal, timestamp)) {
+        if (ServerStream != nullptr) {
+            ServerStream->publishStr(
+                valueStruct.id,
+                *ptrVal, timestamp);
+        }
+    }
+    //Log value
+    if (ServerLogging != nullptr) {
+        ServerLogging->logStr(
+            valueStruct.id,
+            *ptrVal, timestamp);
+    }
+}
+void ValueNode::assignRTFloatArray(
+    ValueHotFloatArray& valueStruct,
+    const double* data, int64_t timestamp)
+{
+    checkWritable(valueStruct);
+    //Bound to min/max
+    const double* ptrData = boundFloatArray(valueStruct, data);
+    //Update value
+    {
+        WriteGuard guard(*this);
+        valueStruct.value.store(ptrData);
+        valueStruct.timestamp.store(timestamp, std::memory_order_relaxed);
+    }
+    //Publish value
+    if (isStreamed(valueStruct, ptrData, timestamp)) {
+        if (ServerStream != nullptr) {
+            ServerStream->publishFloatArray(
+                valueStruct.id,
+                ptrData, valueStruct.value.size(), timestamp);
+        }
+    }
+    //Log value
+    if (ServerLogging != nullptr) {
+        ServerLogging->logFloatArray(
+            valueStruct.id,
+            ptrData, valueStruct.value.size(), timestamp);
+    }
+}
+
+const double* ValueNode::boundFloatArray(
+    const ValueHotFloatArray& valueStruct, const double* data)
+{
+    if (!valueStruct.hasMin && !valueStruct.hasMax) {
+        return data;
+    }
+    //Element wise clamping into a per thread
+    //buffer only reallocated on length increase
+    thread_local std::vector<double> buffer;
+    size_t size = valueStruct.value.size();
+    if (buffer.size() < size) {
+        buffer.resize(size);
+    }
+    for (size_t i=0;i<size;i++) {
+        double val = data[i];
+        if (
+            valueStruct.hasMin && 
+            i < valueStruct.min.size() &&
+            val < valueStruct.min[i]
+        ) {
+            val = valueStruct.min[i];
+        }
+        if (
+            valueStruct.hasMax && 
+            i < valueStruct.max.size() &&
+            val > valueStruct.max[i]
+        ) {
+            val = valueStruct.max[i];
+        }
+        buffer[i] = val;
+    }
+
+    return buffer.data();
+}
+
+
+bool ValueNode::updateBool(
+    ValueHotBool& valueStruct, bool val,
+    bool noCallblack, int64_t timestamp)
+{
+    checkWritable(valueStruct);
+    //Bound to min/max
+    if (
+        valueStruct.hasMin && 
+        val < valueStruct.min
+    ) {
+        val = valueStruct.min;
+    }
+    if (
+        valueStruct.hasMax && 
+        val > valueStruct.max
+    ) {
+        val = valueStruct.max;
+    }
+    //Update value
+    {
+        WriteGuard guard(*this);
+        valueStruct.value = val;
+        valueStruct.timestamp.store(timestamp, std::memory_order_relaxed);
+    }
+    //Call or defer callback
+    if (!noCallblack) {
+        callbackBool(valueStruct, val);
+    }
+
+    return val;
+}
+int64_t ValueNode::updateInt(
+    ValueHotInt& valueStruct, int64_t val,
+    bool noCallblack, int64_t timestamp)
+{
+    checkWritable(valueStruct);
+    //Bound to min/max
+    if (
+        valueStruct.hasMin && 
+        val < valueStruct.min
+    ) {
+        val = valueStruct.min;
+    }
+    if (
+        valueStruct.hasMax && 
+        val > valueStruct.max
+    ) {
+        val = valueStruct.max;
+    }
+    //Update value
+    {
+        WriteGuard guard(*this);
+        valueStruct.value = val;
+        valueStruct.timestamp.store(timestamp, std::memory_order_relaxed);
+    }
+    //Call or defer callback
+    if (!noCallblack) {
+        callbackInt(valueStruct, val);
+    }
+
+    return val;
+}
+double ValueNode::updateFloat(
+    ValueHotFloat& valueStruct, double val,
+    bool noCallblack, int64_t timestamp)
+{
+    checkWritable(valueStruct);
+    //Bound to min/max
+    if (
+        valueStruct.hasMin && 
+        val < valueStruct.min
+    ) {
+        val = valueStruct.min;
+    }
+    if (
+        valueStruct.hasMax && 
+        val > valueStruct.max
+    ) {
+        val = valueStruct.max;
+    }
+    //Update value
+    {
+        WriteGuard guard(*this);
+        valueStruct.value = val;
+        valueStruct.timestamp.store(timestamp, std::memory_order_relaxed);
+    }
+    //Call or defer callback
+    if (!noCallblack) {
+        callbackFloat(valueStruct, val);
+    }
+
+    return val;
+}
+const std::string& ValueNode::updateStr(
+    ValueHotStr& valueStruct, const std::string& val,
+    bool noCallblack, int64_t timestamp)
+{
+    checkWritable(valueStruct);
+    //Bound to min/max
+    const std::string* ptrVal = &val;
+    if (
+        valueStruct.hasMin && 
+        val < valueStruct.min
+    ) {
+        ptrVal = &valueStruct.min;
+    }
+    if (
+        valueStruct.hasMax && 
+        val > valueStruct.max
+    ) {
+        ptrVal = &valueStruct.max;
+    }
+    //Update value
+    {
+        WriteGuard guard(*this);
+        valueStruct.value.store(*ptrVal);
+        valueStruct.timestamp.store(timestamp, std::memory_order_relaxed);
+    }
+    //Call or defer callback
+    if (!noCallblack) {
+        callbackStr(valueStruct, *ptrVal);
+    }
+
+    return *ptrVal;
+}
+const double* ValueNode::updateFloatArray(
+    ValueHotFloatArray& valueStruct, const double* data,
+    bool noCallblack, int64_t timestamp)
+{
+    checkWritable(valueStruct);
+    //Bound to min/max
+    const double* ptrData = boundFloatArray(valueStruct, data);
+    //Update value
+    {
+        WriteGuard guard(*this);
+        valueStruct.value.store(ptrData);
+        valueStruct.timestamp.store(timestamp, std::memory_order_relaxed);
+    }
+    //Call or defer callback
+    if (!noCallblack) {
+        callbackFloatArray(valueStruct, ptrData);
+    }
+
+    return ptrData;
+}
+
+void ValueNode::callbackBool(
+    ValueHotBool& valueStruct, bool val)
+{
+    if (!valueStruct.hasCallback) {
+        return;
+    }
+    CallbackAccess dispatcher;
+    if (dispatcher.get() != nullptr) {
+        dispatcher.get()->pushBool(this, &valueStruct, val);
+    } else {
+        valueStruct.meta().callback(val);
+    }
+}
+void ValueNode::callbackInt(
+    ValueHotInt& valueStruct, int64_t val)
+{
+    if (!valueStruct.hasCallback) {
+        return;
+    }
+    CallbackAccess dispatcher;
+    if (dispatcher.get() != nullptr) {
+        dispatcher.get()->pushInt(this, &valueStruct, val);
+    } else {
+        valueStruct.meta().callback(val);
+    }
+}
+void ValueNode::callbackFloat(
+    ValueHotFloat& valueStruct, double val)
+{
+    if (!valueStruct.hasCallback) {
+        return;
+    }
+    CallbackAccess dispatcher;
+    if (dispatcher.get() != nullptr) {
+        dispatcher.get()->pushFloat(this, &valueStruct, val);
+    } else {
+        valueStruct.meta().callback(val);
+    }
+}
+void ValueNode::callbackStr(
+    ValueHotStr& valueStruct, const std::string& val)
+{
+    if (!valueStruct.hasCallback) {
+        return;
+    }
+    CallbackAccess dispatcher;
+    if (dispatcher.get() != nullptr) {
+        dispatcher.get()->pushStr(this, &valueStruct, val);
+    } else {
+        valueStruct.meta().callback(val);
+    }
+}
+void ValueNode::callbackFloatArray(
+    ValueHotFloatArray& valueStruct, const double* data)
+{
+    if (!valueStruct.hasCallback) {
+        return;
+    }
+    std::vector<double> val(data, data + valueStruct.value.size());
+    CallbackAccess dispatcher;
+    if (dispatcher.get() != nullptr) {
+        dispatcher.get()->pushFloatArray(this, &valueStruct, val);
+    } else {
+        valueStruct.meta().callback(val);
+    }
+}
+
+void ValueNode::assignBool(
+    ValueHotBool& valueStruct, bool val,
+    bool noCallblack, int64_t timestamp)
+{
+    //Bound, update and call callback
+    val = updateBool(valueStruct, val, noCallblack, timestamp);
+    //Publish value
+    if (isStreamed(valueStruct, val, timestamp)) {
+        if (ServerStream != nullptr) {
+            ServerStream->publishBool(
+                valueStruct.id,
+                val, timestamp,
+                valueStruct.streamFilter.latestOnly);
+        }
+    }
+    //Log value
+    if (ServerLogging != nullptr) {
+        ServerLogging->logBool(
+            valueStruct.id,
+            val, timestamp);
+    }
+}
+void ValueNode::assignInt(
+    ValueHotInt& valueStruct, int64_t val,
+    bool noCallblack, int64_t timestamp)
+{
+    //Bound, update and call callback
+    val = updateInt(valueStruct, val, noCallblack, timestamp);
+    //Publish value
+    if (isStreamed(valueStruct, val, timestamp)) {
+        if (ServerStream != nullptr) {
+            ServerStream->publishInt(
+                valueStruct.id,
+                val, timestamp,
+                valueStruct.streamFilter.latestOnly);
+        }
+    }
+    //Log value
+    if (ServerLogging != nullptr) {
+        ServerLogging->logInt(
+            valueStruct.id,
+            val, timestamp);
+    }
+}
+void ValueNode::assignFloat(
+    ValueHotFloat& valueStruct, double val,
+    bool noCallblack, int64_t timestamp)
+{
+    //Bound, update and call callback
+    val = updateFloat(valueStruct, val, noCallblack, timestamp);
+    //Publish value
+    if (isStreamed(valueStruct, val, timestamp)) {
+        if (ServerStream != nullptr) {
+            ServerStream->publishFloat(
+                valueStruct.id,
+                val, timestamp,
+                valueStruct.streamFilter.latestOnly);
+        }
+    }
+    //Log value
+    if (ServerLogging != nullptr) {
+        ServerLogging->logFloat(
+            valueStruct.id,
+            val, timestamp);
+    }
+}
+void ValueNode::assignStr(
+    ValueHotStr& valueStruct, const std::string& val,
+    bool noCallblack, int64_t timestamp)
+{
+    //Bound, update and call callback
+    const std::string& valBound = updateStr(
+        valueStruct, val, noCallblack, timestamp);
+    //Publish value
+    if (isStreamed(valueStruct, valBound, timestamp)) {
+        if (ServerStream != nullptr) {
+            ServerStream->publishStr(
+                valueStruct.id,
+                valBound, timestamp);
+        }
+    }
+    //Log value
+    if (ServerLogging != nullptr) {
+        ServerLogging->logStr(
+            valueStruct.id,
+            valBound, timestamp);
+    }
+}
+void ValueNode::assignFloatArray(
+    ValueHotFloatArray& valueStruct, const double* data,
+    bool noCallblack, int64_t timestamp)
+{
+    //Bound, update and call callback
+    const double* dataBound = updateFloatArray(
+        valueStruct, data, noCallblack, timestamp);
+    //Publish value
+    if (isStreamed(valueStruct, dataBound, timestamp)) {
+        if (ServerStream != nullptr) {
+            ServerStream->publishFloatArray(
+                valueStruct.id,
+                dataBound, valueStruct.value.size(), timestamp);
+        }
+    }
+    //Log value
+    if (ServerLogging != nullptr) {
+        ServerLogging->logFloatArray(
+            valueStruct.id,
+            dataBound, valueStruct.value.size(), timestamp);
+    }
+}
+void ValueNode::assignReadOnlyInt(
+    ValueHotInt& valueStruct, int64_t val, int64_t timestamp)
+{
+    //Update value
+    {
+        WriteGuard guard(*this);
+        valueStruct.value = val;
+        valueStruct.timestamp.store(timestamp, std::memory_order_relaxed);
+    }
+    //Publish value (never logged)
+    if (isStreamed(valueStruct, val, timestamp)) {
+        if (ServerStream != nullptr) {
+            ServerStream->publishInt(
+                valueStruct.id,
+                val, timestamp,
+                valueStruct.streamFilter.latestOnly);
+        }
+    }
+}
+
+void ValueNode::handleResolve(const std::string& name,
+    ValueNode*& node, ValueHotBool*& ptrValue)
+{
+    //Forward to subtree
+    std::string tmpName;
+    ValueNode* child = BaseNode::forwardFunc(name, tmpName, false);
+    if (child != nullptr) {
+        child->handleResolve(tmpName, node, ptrValue);
+        return;
+    }
+
+    std::lock_guard<std::mutex> lock(_mutex);
+    if (_valuesBool.count(name) == 0) {
+        throw std::logic_error("RhIO unknown value Bool name: '" + name + "' in '"
+            + BaseNode::pwd + "'");
+    } else {
+        node = this;
+        ptrValue = &(_valuesBool.at(name));
+    }
+}
+void ValueNode::handleResolve(const std::string& name,
+    ValueNode*& node, ValueHotInt*& ptrValue)
+{
+    //Forward to subtree
+    std::string tmpName;
+    ValueNode* child = BaseNode::forwardFunc(name, tmpName, false);
+    if (child != nullptr) {
+        child->handleResolve(tmpName, node, ptrValue);
+        return;
+    }
+
+    std::lock_guard<std::mutex> lock(_mutex);
+    if (_valuesInt.count(name) == 0) {
+        throw std::logic_error("RhIO unknown value Int name: '" + name + "' in '"
+            + BaseNode::pwd + "'");
+    } else {
+        node = this;
+        ptrValue = &(_valuesInt.at(name));
+    }
+}
+void ValueNode::handleResolve(const std::string& name,
+    ValueNode*& node, ValueHotFloat*& ptrValue)
+{
+    //Forward to subtree
+    std::string tmpName;
+    ValueNode* child = BaseNode::forwardFunc(name, tmpName, false);
+    if (child != nullptr) {
+        child->handleResolve(tmpName, node, ptrValue);
+        return;
+    }
+
+    std::lock_guard<std::mutex> lock(_mutex);
+    if (_valuesFloat.count(name) == 0) {
+        throw std::logic_error("RhIO unknown value Float name: '" + name + "' in '"
+            + BaseNode::pwd + "'");
+    } else {
+        node = this;
+        ptrValue = &(_valuesFloat.at(name));
+    }
+}
+void ValueNode::handleResolve(const std::string& name,
+    ValueNode*& node, ValueHotStr*& ptrValue)
+{
+    //Forward to subtree
+    std::string tmpName;
+    ValueNode* child = BaseNode::forwardFunc(name, tmpName, false);
+    if (child != nullptr) {
+        child->handleResolve(tmpName, node, ptrValue);
+        return;
+    }
+
+    std::lock_guard<std::mutex> lock(_mutex);
+    if (_valuesStr.count(name) == 0) {
+        throw std::logic_error("RhIO unknown value Str name: '" + name + "' in '"
+            + BaseNode::pwd + "'");
+    } else {
+        node = this;
+        ptrValue = &(_valuesStr.at(name));
+    }
+}
+void ValueNode::handleResolve(const std::string& name,
+    ValueNode*& node, ValueHotFloatArray*& ptrValue)
+{
+    //Forward to subtree
+    std::string tmpName;
+    ValueNode* child = BaseNode::forwardFunc(name, tmpName, false);
+    if (child != nullptr) {
+        child->handleResolve(tmpName, node, ptrValue);
+        return;
+    }
+
+    std::lock_guard<std::mutex> lock(_mutex);
+    if (_valuesFloatArray.count(name) == 0) {
+        throw std::logic_error("RhIO unknown value FloatArray name: '" + name + "' in '"
+            + BaseNode::pwd + "'");
+    } else {
+        node = this;
+        ptrValue = &(_valuesFloatArray.at(name));
+    }
+}
+
+bool ValueNode::handleGet(const ValueHotBool& valueStruct) const
+{
+    return valueStruct.value.load();
+}
+int64_t ValueNode::handleGet(const ValueHotInt& valueStruct) const
+{
+    return valueStruct.value.load();
+}
+double ValueNode::handleGet(const ValueHotFloat& valueStruct) const
+{
+    return valueStruct.value.load();
+}
+std::string ValueNode::handleGet(const ValueHotStr& valueStruct) const
+{
+    return valueStruct.value.load();
+}
+
+void ValueNode::handleSetReadOnly(ValueHotInt& valueStruct, int64_t val,
+    int64_t timestamp)
+{
+    std::lock_guard<std::mutex> lock(_mutex);
+    if (!valueStruct.readOnly) {
+        throw std::logic_error("RhIO not read-only value Int: '" 
+            + PathRegistry::path(valueStruct.id) + "'");
+    }
+    assignReadOnlyInt(valueStruct, val, timestamp);
+}
+
+void ValueNode::handleSet(ValueHotBool& valueStruct, bool val,
+    bool noCallblack, int64_t timestamp)
+{
+    std::lock_guard<std::mutex> lock(_mutex);
+    assignBool(valueStruct, val, noCallblack, timestamp);
+}
+void ValueNode::handleSet(ValueHotInt& valueStruct, int64_t val,
+    bool noCallblack, int64_t timestamp)
+{
+    std::lock_guard<std::mutex> lock(_mutex);
+    assignInt(valueStruct, val, noCallblack, timestamp);
+}
+void ValueNode::handleSet(ValueHotFloat& valueStruct, double val,
+    bool noCallblack, int64_t timestamp)
+{
+    std::lock_guard<std::mutex> lock(_mutex);
+    assignFloat(valueStruct, val, noCallblack, timestamp);
+}
+void ValueNode::handleSet(ValueHotStr& valueStruct, const std::string& val,
+    bool noCallblack, int64_t timestamp)
+{
+    std::lock_guard<std::mutex> lock(_mutex);
+    assignStr(valueStruct, val, noCallblack, timestamp);
+}
 
 }
 
@@ -171,7 +171,7 @@ namespace RhIO
                  * Filed name
                  */
                 char buffer[SLIDER_WIDTH+2];
-                snprintf(buffer, SLIDER_WIDTH+1, " %-10s", value->name.c_str());
+                snprintf(buffer, SLIDER_WIDTH+1, " %-10s", value->getName().c_str());
                 draw(names, SLIDER_WIDTH*(pos-offset), buffer);
                  
                 /**
@@ -33,7 +33,7 @@ namespace RhIO
 
     std::string NodeValue::getName()
     {
-        return node->getPath() + "/" + value->name;
+        return node->getPath() + "/" + value->getName();
     }
 
     std::vector<NodeCommand> Node::getCommands()
@@ -89,6 +89,7 @@ namespace RhIO
         GET_CHILDREN(Float, floats)
         GET_CHILDREN(Int, ints)
         GET_CHILDREN(Str, strings)
+        GET_CHILDREN(FloatArray, floatArrays)
 
         // Commands
         for (auto name : client->listCommands(path)) {
@@ -169,7 +170,7 @@ namespace RhIO
         auto all = getAll();
 
         for (auto entry : all) {
-            if (entry.value->name == name) {
+            if (entry.value->getName() == name) {
                 return entry;
             }
         }
@@ -185,28 +186,49 @@ namespace RhIO
         for (auto &var : ints) values.push_back(NodeValue(this, &var));
         for (auto &var : floats) values.push_back(NodeValue(this, &var));
         for (auto &var : strings) values.push_back(NodeValue(this, &var));
+        for (auto &var : floatArrays) values.push_back(NodeValue(this, &var));
 
         return values;
     }
 
     ValueBool *Node::asBool(ValueBase *value)
     {
-        return dynamic_cast<ValueBool*>(value);
+        if (value == nullptr || value->type != TypeBool) {
+            return nullptr;
+        }
+        return static_cast<ValueBool*>(value);
     }
 
     ValueInt *Node::asInt(ValueBase *value)
     {
-        return dynamic_cast<ValueInt*>(value);
+        if (value == nullptr || value->type != TypeInt) {
+            return nullptr;
+        }
+        return static_cast<ValueInt*>(value);
     }
 
     ValueFloat *Node::asFloat(ValueBase *value)
     {
-        return dynamic_cast<ValueFloat*>(value);
+        if (value == nullptr || value->type != TypeFloat) {
+            return nullptr;
+        }
+        return static_cast<ValueFloat*>(value);
     }
 
     ValueStr *Node::asString(ValueBase *value)
     {
-        return dynamic_cast<ValueStr*>(value);
+        if (value == nullptr || value->type != TypeStr) {
+            return nullptr;
+        }
+        return static_cast<ValueStr*>(value);
+    }
+
+    ValueFloatArray *Node::asFloatArray(ValueBase *value)
+    {
+        if (value == nullptr || value->type != TypeFloatArray) {
+            return nullptr;
+        }
+        return static_cast<ValueFloatArray*>(value);
     }
 
     std::string Node::toString(ValueBase *value)
@@ -223,6 +245,10 @@ namespace RhIO
             return ss.str();
         } else if (auto val = asString(value)) {
             return val->value;
+        } else if (auto val = asFloatArray(value)) {
+            std::stringstream ss;
+            ss << std::setprecision(14) << val->value;
+            return ss.str();
         } else {
             return "?";
         }
@@ -251,6 +277,8 @@ namespace RhIO
             return "float";
         } else if (asString(value)) {
             return "string";
+        } else if (asFloatArray(value)) {
+            return "float[]";
         } else {
             return "?";
         }
@@ -270,6 +298,15 @@ namespace RhIO
             return ss.str();
         } else if (auto val = asString(value)) {
             return val->valuePersisted;
+        } else if (auto val = asFloatArray(value)) {
+            std::stringstream ss;
+            ss << "[";
+            for (size_t i=0;i<val->valuePersisted.size();i++) {
+                if (i > 0) ss << " ";
+                ss << val->valuePersisted[i];
+            }
+            ss << "]";
+            return ss.str();
         } else {
             return "?";
         }
@@ -285,6 +322,17 @@ namespace RhIO
             return fabs(val->value-val->valuePersisted) >= 1e-4;
         } else if (auto val = asString(value)) {
             return val->value != val->valuePersisted;
+        } else if (auto val = asFloatArray(value)) {
+            std::vector<double> data = val->value.load();
+            if (data.size() != val->valuePersisted.size()) {
+                return true;
+            }
+            for (size_t i=0;i<data.size();i++) {
+                if (fabs(data[i]-val->valuePersisted[i]) >= 1e-4) {
+                    return true;
+                }
+            }
+            return false;
         } else {
             return false;
         }
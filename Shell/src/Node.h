@@ -99,6 +99,7 @@ namespace RhIO
             static ValueInt *asInt(ValueBase *value);
             static ValueFloat *asFloat(ValueBase *value);
             static ValueStr *asString(ValueBase *value);
+            static ValueFloatArray *asFloatArray(ValueBase *value);
 
             /**
              * Converts a value base to a string representing it
@@ -134,6 +135,7 @@ namespace RhIO
             std::vector<ValueInt> ints;
             std::vector<ValueFloat> floats;
             std::vector<ValueStr> strings;
+            std::vector<ValueFloatArray> floatArrays;
             std::map<std::string, Node*> children;
             std::vector<NodeCommand> commands;
             std::vector<NodeStream> streams;
@@ -29,11 +29,11 @@ namespace RhIO
             auto val = nodeVal.value;
 
             std::cout << std::left;
-            Terminal::setColor("white", val->persisted);
+            Terminal::setColor("white", val->isPersisted());
             if (fullName) {
                 std::cout << std::setw(45) << nodeVal.getName();
             } else {
-                std::cout << std::setw(30) << nodeVal.value->name;
+                std::cout << std::setw(30) << nodeVal.value->getName();
             }
             std::cout << " ";
 
@@ -45,10 +45,10 @@ namespace RhIO
 
             std::cout << " ";
             Terminal::setColor("magenta", false);
-            std::cout << std::setw(30) << val->comment;
+            std::cout << std::setw(30) << val->getComment();
             Terminal::clear();
 
-            if (val->persisted) {
+            if (val->isPersisted()) {
                 Terminal::setColor("magenta", false);
                 std::cout << " persisted: ";
                 Terminal::clear();
@@ -1288,7 +1288,7 @@ namespace RhIO
         if (auto node = getNode(prefix)) {
             // Adding children
             for (NodeValue nodeValue : node->getAll()) {
-                auto name = prefix+nodeValue.value->name;
+                auto name = prefix+nodeValue.value->getName();
                 possibilities.push_back(name);
             }
 
@@ -1332,6 +1332,8 @@ namespace RhIO
             val->value = client->getFloat(name);
         } else if (auto val = Node::asString(value)) {
             val->value = client->getStr(name);
+        } else if (auto val = Node::asFloatArray(value)) {
+            val->value = client->getFloatArray(name);
         }
     }
 
@@ -1348,6 +1350,8 @@ namespace RhIO
             client->setFloat(name, val->value);
         } else if (auto val = Node::asString(value)) {
             client->setStr(name, val->value);
+        } else if (auto val = Node::asFloatArray(value)) {
+            client->setFloatArray(name, val->value.load());
         }
     }
 
@@ -1364,6 +1368,21 @@ namespace RhIO
             val->value = atof(str.c_str());
         } else if (auto val = Node::asString(value)) {
             val->value = str;
+        } else if (auto val = Node::asFloatArray(value)) {
+            //Elements separated by spaces or 
+            //commas, optionally within brackets
+            for (auto& c : str) {
+                if (c == ',' || c == '[' || c == ']') {
+                    c = ' ';
+                }
+            }
+            std::vector<double> data;
+            std::stringstream ss(str);
+            double element;
+            while (ss >> element) {
+                data.push_back(element);
+            }
+            val->value = data;
         }
 
         setToServer(nodeValue);
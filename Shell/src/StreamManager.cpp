@@ -17,6 +17,7 @@ namespace RhIO
         clientSub->setHandlerInt(std::bind(&StreamManager::intHandler, this, _1, _2, _3));
         clientSub->setHandlerFloat(std::bind(&StreamManager::floatHandler, this, _1, _2, _3));
         clientSub->setHandlerStr(std::bind(&StreamManager::stringHandler, this, _1, _2, _3));
+        clientSub->setHandlerFloatArray(std::bind(&StreamManager::floatArrayHandler, this, _1, _2, _3));
         clientSub->setHandlerStream(std::bind(&StreamManager::streamHandler, this, _1, _2, _3));
         clientSub->setHandlerFrame(std::bind(&StreamManager::frameHandler, this, _1, _2, _3, _4, _5, _6));
 
@@ -117,6 +118,23 @@ namespace RhIO
         }
         mutex.unlock();
     }
+
+    void StreamManager::floatArrayHandler(const std::string &name, uint64_t timestamp, const std::vector<double> &val)
+    {
+        mutex.lock();
+        for (auto& pool : pools) {
+            for (auto& node : *pool) {
+                if (const auto& var = Node::asFloatArray(node.value)) {
+                    if (node.getName() == name) {
+                        var->value = val;
+                        pool->dirty = true;
+                        pool->timestamp = timestamp;
+                    }
+                }
+            }
+        }
+        mutex.unlock();
+    }
             
     void StreamManager::streamHandler(const std::string &name, uint64_t timestamp, const std::string &str)
     {
@@ -39,6 +39,7 @@ namespace RhIO
             void intHandler(const std::string &name, uint64_t timestamp, int val);
             void floatHandler(const std::string &name, uint64_t timestamp, float val);
             void stringHandler(const std::string &name, uint64_t timestamp, const std::string &val);
+            void floatArrayHandler(const std::string &name, uint64_t timestamp, const std::vector<double> &val);
             void streamHandler(const std::string &name, uint64_t timestamp, const std::string &str);
             void frameHandler(const std::string &name, uint64_t timestamp, 
                 size_t width, size_t height, unsigned char* data, size_t size);
@@ -37,7 +37,7 @@ namespace RhIO
 
         for (auto nodeVal : node->getAll()) {
             auto value = nodeVal.value;
-            if (value->persisted && Node::isDiff(value)) {
+            if (value->isPersisted() && Node::isDiff(value)) {
                 Terminal::clear();
                 diff++;
                 std::string name = std::string("/") + nodeVal.getName() + ":";
@@ -56,7 +56,7 @@ namespace RhIO
                 std::cout << left << "├── ";
             }
             Terminal::setColor("white", false);
-            std::cout << nodeVal.value->name << std::endl;
+            std::cout << nodeVal.value->getName() << std::endl;
         }
     }
 }
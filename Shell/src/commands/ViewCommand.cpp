@@ -52,6 +52,15 @@ namespace RhIO
                 auto nodeFrame = shell->getNodeFrame(args[i]);
                 client->disableStreamingFrame(nodeFrame.getName());
                 _viewers[i].second.stop();
+                //Display reception statistics
+                auto stats = shell->getClientSub()->getFrameStats(
+                    nodeFrame.getName());
+                std::cout << nodeFrame.getName() << ": " 
+                    << stats.countFrames << " frames received, " 
+                    << stats.countDropped << " dropped (" 
+                    << stats.countChunksLost << "/" 
+                    << stats.countChunks + stats.countChunksLost 
+                    << " chunks lost)" << std::endl;
             }
         }
     }
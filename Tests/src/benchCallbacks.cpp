@@ -0,0 +1,97 @@
+#include <iostream>
+#include <cassert>
+#include <thread>
+#include <chrono>
+#include <vector>
+#include <algorithm>
+#include "RhIO.hpp"
+
+/**
+ * Number of value updates per mode
+ */
+static const size_t CountUpdates = 2000;
+
+/**
+ * Simulated user callback work in microseconds
+ */
+static const int64_t CallbackWork = 20;
+
+/**
+ * Callback latencies in microseconds
+ */
+static std::vector<double> latencies;
+
+static int64_t nowNs()
+{
+    return std::chrono::duration_cast<std::chrono::nanoseconds>(
+        std::chrono::steady_clock::now().time_since_epoch()).count();
+}
+
+void callback(int64_t val)
+{
+    latencies.push_back((nowNs() - val)/1000.0);
+    //Busy user work
+    int64_t tsEnd = nowNs() + CallbackWork*1000;
+    while (nowNs() < tsEnd) {
+    }
+}
+
+void bench(RhIO::CallbackMode mode, const std::string& name)
+{
+    latencies.clear();
+    latencies.reserve(CountUpdates);
+    std::vector<double> setTimes;
+    setTimes.reserve(CountUpdates);
+
+    RhIO::setCallbackMode(mode);
+    for (size_t i=0;i<CountUpdates;i++) {
+        int64_t ts1 = nowNs();
+        RhIO::Root.setInt("bench/value", ts1);
+        int64_t ts2 = nowNs();
+        setTimes.push_back((ts2 - ts1)/1000.0);
+        //User loop
+        if (mode == RhIO::CallbackDeferred) {
+            RhIO::dispatchCallbacks();
+        }
+        std::this_thread::sleep_for(std::chrono::microseconds(50));
+    }
+    RhIO::setCallbackMode(RhIO::CallbackInline);
+    assert(latencies.size() == CountUpdates);
+
+    double setMean = 0.0;
+    for (double t : setTimes) {
+        setMean += t;
+    }
+    setMean /= setTimes.size();
+    double latencyMean = 0.0;
+    for (double t : latencies) {
+        latencyMean += t;
+    }
+    latencyMean /= latencies.size();
+    std::sort(setTimes.begin(), setTimes.end());
+    std::sort(latencies.begin(), latencies.end());
+    std::cout << "Mode: " << name
+        << " Set mean: " << setMean << " us"
+        << " max: " << setTimes.back() << " us"
+        << " Latency mean: " << latencyMean << " us"
+        << " p99: " << latencies[latencies.size()*99/100] << " us"
+        << std::endl;
+}
+
+int main()
+{
+    if (!RhIO::started()) {
+        RhIO::start();
+    }
+    assert(RhIO::started());
+
+    RhIO::Root.newInt("bench/value");
+    RhIO::Root.setCallbackInt("bench/value", callback);
+
+    std::cout << "Callback work: " << CallbackWork << " us" << std::endl;
+    bench(RhIO::CallbackInline, "inline");
+    bench(RhIO::CallbackDeferred, "deferred");
+    bench(RhIO::CallbackThread, "thread");
+
+    return 0;
+}
@@ -0,0 +1,105 @@
+#include <iostream>
+#include <iomanip>
+#include <vector>
+#include <string>
+#include <thread>
+#include <atomic>
+#include <chrono>
+#include <algorithm>
+#include "rhio_common/LockFreeDoubleQueue.hpp"
+#include "rhio_common/LockFreeRingQueue.hpp"
+
+/**
+ * Number of values appended by each writer
+ * and buffers size
+ */
+static const size_t AppendCount = 200000;
+static const size_t BufferSize = 10000;
+
+/**
+ * Appended value (same layout
+ * than published float values)
+ */
+struct Value {
+    size_t id;
+    double value;
+    int64_t timestamp;
+};
+
+/**
+ * Append from given number of writer threads
+ * into given queue while one reader drains it
+ * and print throughput, append latency
+ * percentiles and dropped values
+ */
+template <typename Queue>
+static void bench(const std::string& name,
+    Queue& queue, size_t countWriters)
+{
+    std::atomic<bool> isOver(false);
+    uint64_t countRead = 0;
+    std::thread reader([&queue, &isOver, &countRead]() {
+        while (!isOver.load()) {
+            queue.swapBufferFromReader();
+            countRead += queue.getSizeFromReader();
+            std::this_thread::sleep_for(std::chrono::microseconds(100));
+        }
+        //Drain remaining values
+        for (size_t k=0;k<2;k++) {
+            queue.swapBufferFromReader();
+            countRead += queue.getSizeFromReader();
+        }
+    });
+
+    std::vector<std::vector<int64_t>> latencies(countWriters);
+    std::vector<std::thread> writers;
+    auto time1 = std::chrono::steady_clock::now();
+    for (size_t k=0;k<countWriters;k++) {
+        latencies[k].resize(AppendCount);
+        writers.push_back(std::thread([&queue, &latencies, k]() {
+            for (size_t i=0;i<AppendCount;i++) {
+                auto t1 = std::chrono::steady_clock::now();
+                queue.appendFromWriter({k, (double)i, (int64_t)i});
+                auto t2 = std::chrono::steady_clock::now();
+                latencies[k][i] = std::chrono::duration_cast<
+                    std::chrono::nanoseconds>(t2 - t1).count();
+            }
+        }));
+    }
+    for (size_t k=0;k<countWriters;k++) {
+        writers[k].join();
+    }
+    auto time2 = std::chrono::steady_clock::now();
+    isOver.store(true);
+    reader.join();
+
+    std::vector<int64_t> sorted;
+    for (size_t k=0;k<countWriters;k++) {
+        sorted.insert(sorted.end(),
+            latencies[k].begin(), latencies[k].end());
+    }
+    std::sort(sorted.begin(), sorted.end());
+    std::chrono::duration<double> dur = time2 - time1;
+    std::cout << std::setw(6) << name
+        << " writers=" << std::setw(2) << countWriters
+        << " throughput: " << std::setw(6)
+        << (size_t)(sorted.size()/dur.count()/1000.0) << " k/s"
+        << " p50: " << std::setw(5) << sorted[sorted.size()/2] << " ns"
+        << " p99: " << std::setw(6) << sorted[(sorted.size()*99)/100] << " ns"
+        << " read: " << countRead
+        << " dropped: " << queue.getCountDropped()
+        << std::endl;
+}
+
+int main()
+{
+    for (size_t countWriters : {2, 4, 8, 16}) {
+        RhIO::LockFreeDoubleQueue<Value> queueDouble(BufferSize);
+        bench("Double", queueDouble, countWriters);
+        RhIO::LockFreeRingQueue<Value> queueRing(BufferSize);
+        bench("Ring", queueRing, countWriters);
+    }
+
+    return 0;
+}
+
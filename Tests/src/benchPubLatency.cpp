@@ -0,0 +1,112 @@
+#include <iostream>
+#include <iomanip>
+#include <vector>
+#include <string>
+#include <mutex>
+#include <thread>
+#include <chrono>
+#include <algorithm>
+#include "RhIO.hpp"
+#include "RhIOClient.hpp"
+
+/**
+ * Number of published samples
+ * and time between two samples
+ * (low rate streaming)
+ */
+static const size_t SampleCount = 500;
+static const int64_t SamplePeriod = 3000;
+
+/**
+ * Latency histogram bucket upper
+ * bounds in microseconds
+ */
+static const std::vector<int64_t> Buckets = {
+    100, 250, 500, 1000, 2000, 5000, 10000, 20000, 50000};
+
+/**
+ * Measured end to end latencies
+ */
+static std::mutex mutexLatencies;
+static std::vector<int64_t> latencies;
+
+/**
+ * Stream low rate samples with given publisher
+ * mode and print the latency histogram
+ */
+static void bench(const std::string& name,
+    RhIO::PublishMode mode)
+{
+    RhIO::setPublishMode(mode, 1000);
+    std::this_thread::sleep_for(std::chrono::milliseconds(100));
+    {
+        std::lock_guard<std::mutex> lock(mutexLatencies);
+        latencies.clear();
+    }
+    for (size_t i=0;i<SampleCount;i++) {
+        RhIO::Root.setFloat("bench/latency", i);
+        std::this_thread::sleep_for(
+            std::chrono::microseconds(SamplePeriod));
+    }
+    std::this_thread::sleep_for(std::chrono::milliseconds(100));
+
+    std::lock_guard<std::mutex> lock(mutexLatencies);
+    std::vector<int64_t> sorted = latencies;
+    std::sort(sorted.begin(), sorted.end());
+    std::cout << name << ": " << sorted.size()
+        << "/" << SampleCount << " received" << std::endl;
+    if (sorted.size() == 0) {
+        return;
+    }
+    std::cout << "    p50: " << sorted[sorted.size()/2] << " us"
+        << " p99: " << sorted[(sorted.size()*99)/100] << " us"
+        << " max: " << sorted.back() << " us" << std::endl;
+    size_t index = 0;
+    for (size_t i=0;i<=Buckets.size();i++) {
+        size_t count = 0;
+        while (
+            index < sorted.size() &&
+            (i == Buckets.size() || sorted[index] < Buckets[i])
+        ) {
+            count++;
+            index++;
+        }
+        std::cout << "    ";
+        if (i == Buckets.size()) {
+            std::cout << ">= " << std::setw(6) << Buckets.back();
+        } else {
+            std::cout << " < " << std::setw(6) << Buckets[i];
+        }
+        std::cout << " us: " << std::setw(5) << count << " "
+            << std::string((60*count)/sorted.size(), '#') << std::endl;
+    }
+}
+
+int main()
+{
+    RhIO::start();
+    RhIO::Root.newFloat("bench/latency");
+    RhIO::Root.enableStreamingValue("bench/latency");
+
+    RhIO::ClientSub client(
+        std::string("udp://")
+        + RhIO::AddressMulticast
+        + std::string(":")
+        + std::to_string(RhIO::PortServerPub));
+    client.setHandlerFloat(
+        [](const std::string& name, int64_t timestamp, double val)
+        {
+            (void)name;
+            (void)val;
+            int64_t latency = RhIO::getRhIOTime() - timestamp;
+            std::lock_guard<std::mutex> lock(mutexLatencies);
+            latencies.push_back(latency);
+        });
+
+    bench("Periodic", RhIO::PublishPeriodic);
+    bench("Event", RhIO::PublishEvent);
+    RhIO::setPublishMode(RhIO::PublishPeriodic);
+
+    return 0;
+}
+
@@ -0,0 +1,61 @@
+#include <iostream>
+#include <fstream>
+#include <string>
+#include <thread>
+#include <chrono>
+#include "RhIO.hpp"
+
+/**
+ * Return the process resident and
+ * virtual memory size in kB
+ */
+static void memoryUsage(size_t& rss, size_t& vsz)
+{
+    rss = 0;
+    vsz = 0;
+    std::ifstream file("/proc/self/status");
+    std::string key;
+    while (file >> key) {
+        if (key == "VmRSS:") {
+            file >> rss;
+        } else if (key == "VmSize:") {
+            file >> vsz;
+        }
+    }
+}
+
+/**
+ * Print memory usage with given label
+ */
+static void printMemory(const std::string& name)
+{
+    size_t rss;
+    size_t vsz;
+    memoryUsage(rss, vsz);
+    std::cout << name << ": RSS " << rss/1024 << " MB"
+        << " VSZ " << vsz/1024 << " MB" << std::endl;
+}
+
+int main()
+{
+    printMemory("Before start");
+    auto time1 = std::chrono::steady_clock::now();
+    RhIO::start();
+    auto time2 = std::chrono::steady_clock::now();
+    std::chrono::duration<double, std::milli> dur = time2 - time1;
+    std::cout << "Start time: " << dur.count() << " ms" << std::endl;
+    printMemory("After start");
+
+    //Log values at 1kHz during one second
+    RhIO::Root.newFloat("bench/value");
+    RhIO::Root.newStr("bench/str");
+    for (size_t i=0;i<1000;i++) {
+        RhIO::Root.setFloat("bench/value", 0.1*i);
+        RhIO::Root.setStr("bench/str", "value");
+        std::this_thread::sleep_for(std::chrono::milliseconds(1));
+    }
+    printMemory("After logging");
+
+    return 0;
+}
+
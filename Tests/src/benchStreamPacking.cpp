@@ -0,0 +1,81 @@
+#include <iostream>
+#include <cassert>
+#include <chrono>
+#include <vector>
+#include <string>
+#include "RhIO.hpp"
+#include "rhio_server/ServerPub.hpp"
+#include "rhio_server/PathRegistry.hpp"
+
+/**
+ * Number of watched values published 
+ * each tick and publisher frequency
+ */
+static const size_t ValueCount = 2000;
+static const double Frequency = 50.0;
+static const size_t TickCount = 100;
+
+/**
+ * Per datagram IPv4, UDP and 
+ * ZMQ group header bytes
+ */
+static const size_t HeaderSize = 20 + 8 + 1 + 4;
+
+/**
+ * Publish all values for several ticks 
+ * with given datagram packing size, number 
+ * of updates per value between two ticks 
+ * and coalescing mode and print network load
+ */
+static void bench(const std::string& name, size_t packetSize,
+    const std::vector<size_t>& ids, 
+    size_t updates = 1, bool isLatest = false)
+{
+    RhIO::ServerPub server("udp://127.0.0.1:9997", packetSize);
+    auto time1 = std::chrono::steady_clock::now();
+    for (size_t k=0;k<TickCount;k++) {
+        for (size_t j=0;j<updates;j++) {
+            for (size_t i=0;i<ids.size();i++) {
+                server.publishFloat(ids[i], 0.1*k, k, isLatest);
+            }
+        }
+        server.sendToClient();
+    }
+    auto time2 = std::chrono::steady_clock::now();
+    std::chrono::duration<double, std::micro> dur = time2 - time1;
+
+    double packets = (double)server.getSentPackets()/TickCount;
+    double bytes = (double)server.getSentBytes()/TickCount;
+    std::cout << name << ": " 
+        << packets*Frequency << " packets/s " 
+        << (bytes + packets*HeaderSize)*Frequency/1000.0 << " kB/s "
+        << bytes/ids.size() << " payload bytes/value "
+        << dur.count()/TickCount << " us/tick" << std::endl;
+    //Datagrams also include the 
+    //value dictionary announcements
+    if (packetSize == 0 && updates == 1) {
+        assert(packets >= ids.size());
+    } else if (updates == 1 || isLatest) {
+        assert(packets < ids.size()/10);
+    }
+}
+
+int main()
+{
+    std::vector<size_t> ids;
+    for (size_t i=0;i<ValueCount;i++) {
+        ids.push_back(RhIO::PathRegistry::intern(
+            "bench/packing/value" + std::to_string(i)));
+    }
+
+    std::cout << ValueCount << " float values at " 
+        << Frequency << " Hz" << std::endl;
+    bench("OneSamplePerDatagram", 0, ids);
+    bench("PackedDatagrams", RhIO::StreamPacketSize, ids);
+
+    std::cout << "Updated at 1000 Hz" << std::endl;
+    bench("FullRate", RhIO::StreamPacketSize, ids, 20, false);
+    bench("Latest", RhIO::StreamPacketSize, ids, 20, true);
+
+    return 0;
+}
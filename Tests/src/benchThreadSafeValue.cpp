@@ -0,0 +1,90 @@
+#include <iostream>
+#include <cassert>
+#include <thread>
+#include <chrono>
+#include <atomic>
+#include <vector>
+#include "RhIO.hpp"
+
+/**
+ * Number of get per reader thread
+ */
+static const size_t CountReads = 1000000;
+
+/**
+ * Stop flag for writer thread
+ */
+static std::atomic<bool> isOver;
+
+void functionReader()
+{
+    volatile double val;
+    for (size_t i=0;i<CountReads;i++) {
+        val = RhIO::Root.getFloat("bench/float");
+        (void)val;
+    }
+}
+
+void functionWriter()
+{
+    size_t count = 0;
+    while (!isOver.load()) {
+        RhIO::Root.setFloat("bench/float", count);
+        count++;
+    }
+}
+
+void benchReaders(size_t countReaders, bool withWriter)
+{
+    isOver.store(false);
+    std::thread writer;
+    if (withWriter) {
+        writer = std::thread(functionWriter);
+    }
+    auto time1 = std::chrono::steady_clock::now();
+    std::vector<std::thread> readers;
+    for (size_t i=0;i<countReaders;i++) {
+        readers.push_back(std::thread(functionReader));
+    }
+    for (size_t i=0;i<countReaders;i++) {
+        readers[i].join();
+    }
+    auto time2 = std::chrono::steady_clock::now();
+    isOver.store(true);
+    if (withWriter) {
+        writer.join();
+    }
+    std::chrono::duration<double, std::milli> dur = time2 - time1;
+    std::cout << "Readers: " << countReaders
+        << " Writer: " << (withWriter ? "yes" : "no")
+        << " Time (x" << CountReads << " per reader): "
+        << dur.count() << " ms"
+        << " Throughput: "
+        << (countReaders*CountReads)/(dur.count()*1000.0)
+        << " Mget/s" << std::endl;
+}
+
+int main()
+{
+    if (!RhIO::started()) {
+        RhIO::start();
+    }
+    assert(RhIO::started());
+
+    RhIO::Root.newFloat("bench/float");
+    RhIO::Root.newFloat("bench/other");
+    RhIO::Root.newInt("bench/int");
+    RhIO::Root.newStr("bench/str");
+
+    std::cout << "Hardware threads: "
+        << std::thread::hardware_concurrency() << std::endl;
+    for (size_t count : {1, 2, 4, 8}) {
+        benchReaders(count, false);
+    }
+    for (size_t count : {1, 2, 4, 8}) {
+        benchReaders(count, true);
+    }
+
+    return 0;
+}
+
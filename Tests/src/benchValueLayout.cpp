@@ -0,0 +1,172 @@
+#include <iostream>
+#include <fstream>
+#include <sstream>
+#include <vector>
+#include <string>
+#include <random>
+#include <algorithm>
+#include <chrono>
+#include <cstring>
+#include <unistd.h>
+#include <sys/ioctl.h>
+#include <sys/syscall.h>
+#include <linux/perf_event.h>
+#include "RhIO.hpp"
+
+/**
+ * Number of created values
+ * spread over NodeCount nodes
+ */
+static const size_t ValueCount = 100000;
+static const size_t NodeCount = 1000;
+
+/**
+ * Return current process resident
+ * memory in bytes
+ */
+static size_t residentBytes()
+{
+    std::ifstream file("/proc/self/statm");
+    size_t size = 0;
+    size_t resident = 0;
+    file >> size >> resident;
+    return resident*(size_t)sysconf(_SC_PAGESIZE);
+}
+
+/**
+ * Open a hardware cache miss counter
+ * for this thread. Return -1 if not available.
+ */
+static int openCacheMissCounter()
+{
+    struct perf_event_attr attr;
+    std::memset(&attr, 0, sizeof(attr));
+    attr.type = PERF_TYPE_HARDWARE;
+    attr.size = sizeof(attr);
+    attr.config = PERF_COUNT_HW_CACHE_MISSES;
+    attr.disabled = 1;
+    attr.exclude_kernel = 1;
+    attr.exclude_hv = 1;
+    return syscall(__NR_perf_event_open, &attr, 0, -1, -1, 0);
+}
+
+/**
+ * Time given function over all values
+ * and print time per access and cache misses
+ */
+template <typename Func>
+static void measure(const std::string& name, size_t count, Func func)
+{
+    int fd = openCacheMissCounter();
+    if (fd != -1) {
+        ioctl(fd, PERF_EVENT_IOC_RESET, 0);
+        ioctl(fd, PERF_EVENT_IOC_ENABLE, 0);
+    }
+    auto time1 = std::chrono::steady_clock::now();
+    func();
+    auto time2 = std::chrono::steady_clock::now();
+    long long misses = -1;
+    if (fd != -1) {
+        ioctl(fd, PERF_EVENT_IOC_DISABLE, 0);
+        if (read(fd, &misses, sizeof(misses)) != sizeof(misses)) {
+            misses = -1;
+        }
+        close(fd);
+    }
+    std::chrono::duration<double, std::nano> dur = time2 - time1;
+    std::cout << name << ": "
+        << dur.count()/count << " ns/value";
+    if (misses >= 0) {
+        std::cout << " cache-misses/value: "
+            << (double)misses/count;
+    } else {
+        std::cout << " cache-misses/value: n/a";
+    }
+    std::cout << std::endl;
+}
+
+int main()
+{
+    std::cout << "sizeof(ValueHotFloat): "
+        << sizeof(RhIO::ValueHotFloat) << " bytes" << std::endl;
+    std::cout << "sizeof(ValueHotInt): "
+        << sizeof(RhIO::ValueHotInt) << " bytes" << std::endl;
+    std::cout << "sizeof(ValueHotBool): "
+        << sizeof(RhIO::ValueHotBool) << " bytes" << std::endl;
+    std::cout << "sizeof(ValueMeta<double>): "
+        << sizeof(RhIO::ValueMeta<double>) << " bytes" << std::endl;
+
+    //Build names before measuring memory
+    std::vector<std::string> names;
+    names.reserve(ValueCount);
+    for (size_t i=0;i<ValueCount;i++) {
+        std::ostringstream ss;
+        ss << "bench/layout/n" << (i%NodeCount) << "/v" << (i/NodeCount);
+        names.push_back(ss.str());
+    }
+
+    //Values creation memory footprint
+    size_t rss1 = residentBytes();
+    for (size_t i=0;i<ValueCount;i++) {
+        RhIO::Root.newFloat(names[i])
+            ->minimum(-1.0)->maximum(1.0);
+    }
+    size_t rss2 = residentBytes();
+    std::cout << "Memory for " << ValueCount << " values: "
+        << (rss2-rss1)/1024 << " KiB ("
+        << (double)(rss2-rss1)/ValueCount << " bytes/value)" << std::endl;
+
+    //Bind handles for direct access
+    std::vector<RhIO::ValueHandleFloat> handles(ValueCount);
+    for (size_t i=0;i<ValueCount;i++) {
+        handles[i].bind(RhIO::Root, names[i]);
+    }
+
+    //Random visiting order
+    std::vector<size_t> order(ValueCount);
+    for (size_t i=0;i<ValueCount;i++) {
+        order[i] = i;
+    }
+    std::mt19937 gen(42);
+    std::shuffle(order.begin(), order.end(), gen);
+
+    volatile double sum = 0.0;
+    measure("RandomGetHandle", ValueCount, [&](){
+        double tmp = 0.0;
+        for (size_t i=0;i<ValueCount;i++) {
+            tmp += handles[order[i]].get();
+        }
+        sum = tmp;
+    });
+    measure("RandomSetHandle", ValueCount, [&](){
+        for (size_t i=0;i<ValueCount;i++) {
+            handles[order[i]].set(0.5);
+        }
+    });
+    measure("SequentialGetHandle", ValueCount, [&](){
+        double tmp = 0.0;
+        for (size_t i=0;i<ValueCount;i++) {
+            tmp += handles[i].get();
+        }
+        sum = tmp;
+    });
+    measure("NodeOrderGetHandle", ValueCount, [&](){
+        double tmp = 0.0;
+        for (size_t n=0;n<NodeCount;n++) {
+            for (size_t i=n;i<ValueCount;i+=NodeCount) {
+                tmp += handles[i].get();
+            }
+        }
+        sum = tmp;
+    });
+    measure("RandomGetPath", ValueCount, [&](){
+        double tmp = 0.0;
+        for (size_t i=0;i<ValueCount;i++) {
+            tmp += RhIO::Root.getFloat(names[order[i]]);
+        }
+        sum = tmp;
+    });
+    (void)sum;
+
+    return 0;
+}
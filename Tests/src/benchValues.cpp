@@ -71,6 +71,81 @@ void funcGetRT()
     std::cout << "TimeGetRTRoot (x10000): " << dur.count() << " ms" << std::endl;
 }
 
+void funcSetHandle()
+{
+    RhIO::ValueHandleInt handle(RhIO::Root, "/path/to/child/val");
+    auto time1 = std::chrono::steady_clock::now();
+    for (size_t i=0;i<10000;i++) {
+        handle.set(42);
+    }
+    auto time2 = std::chrono::steady_clock::now();
+    std::chrono::duration<double, std::milli> dur = time2 - time1;
+    std::cout << "TimeSetHandle (x10000): " << dur.count() << " ms" << std::endl;
+}
+void funcSetBatch()
+{
+    RhIO::ValueHandleInt handle(RhIO::Root, "/path/to/child/val");
+    RhIO::ValueBatch batch = RhIO::Root.batch();
+    auto time1 = std::chrono::steady_clock::now();
+    for (size_t i=0;i<1000;i++) {
+        for (size_t j=0;j<10;j++) {
+            batch.setInt(handle, 42);
+        }
+        batch.commit();
+    }
+    auto time2 = std::chrono::steady_clock::now();
+    std::chrono::duration<double, std::milli> dur = time2 - time1;
+    std::cout << "TimeSetBatch (x10000): " << dur.count() << " ms" << std::endl;
+}
+void funcSetCycle()
+{
+    RhIO::ValueHandleInt handle(RhIO::Root, "/path/to/child/val");
+    auto time1 = std::chrono::steady_clock::now();
+    for (size_t i=0;i<1000;i++) {
+        RhIO::beginRhIOCycle();
+        for (size_t j=0;j<10;j++) {
+            handle.set(42);
+        }
+    }
+    RhIO::clearRhIOCycleTime();
+    auto time2 = std::chrono::steady_clock::now();
+    std::chrono::duration<double, std::milli> dur = time2 - time1;
+    std::cout << "TimeSetCycle (x10000): " << dur.count() << " ms" << std::endl;
+}
+void funcGetTime()
+{
+    const RhIO::TimeSource sources[3] = 
+        {RhIO::TimeSteady, RhIO::TimeCoarse, RhIO::TimeTSC};
+    const char* names[3] = {"Steady", "Coarse", "TSC"};
+    for (size_t k=0;k<3;k++) {
+        RhIO::setRhIOTimeSource(sources[k]);
+        auto time1 = std::chrono::steady_clock::now();
+        volatile int64_t val;
+        for (size_t i=0;i<100000;i++) {
+            val = RhIO::getRhIOTime();
+        }
+        (void)val;
+        auto time2 = std::chrono::steady_clock::now();
+        std::chrono::duration<double, std::milli> dur = time2 - time1;
+        std::cout << "TimeGetTime" << names[k] 
+            << " (x100000): " << dur.count() << " ms" << std::endl;
+    }
+    RhIO::setRhIOTimeSource(RhIO::TimeSteady);
+}
+void funcGetHandle()
+{
+    RhIO::ValueHandleInt handle(RhIO::Root, "/path/to/child/val");
+    auto time1 = std::chrono::steady_clock::now();
+    volatile int val;
+    for (size_t i=0;i<10000;i++) {
+        val = handle.get();
+        assert(val == 42);
+    }
+    auto time2 = std::chrono::steady_clock::now();
+    std::chrono::duration<double, std::milli> dur = time2 - time1;
+    std::cout << "TimeGetHandle (x10000): " << dur.count() << " ms" << std::endl;
+}
+
 int main()
 {
     if (!RhIO::started()) {
@@ -104,6 +179,12 @@ int main()
         t1.join();
         t2.join();
     }
+    {
+        std::thread t1(funcGetHandle);
+        std::thread t2(funcGetHandle);
+        t1.join();
+        t2.join();
+    }
     {
         std::thread t1(funcSetChild);
         std::thread t2(funcSetChild);
@@ -122,6 +203,24 @@ int main()
         t1.join();
         t2.join();
     }
+    {
+        std::thread t1(funcSetHandle);
+        std::thread t2(funcSetHandle);
+        t1.join();
+        t2.join();
+    }
+    {
+        std::thread t1(funcSetBatch);
+        std::thread t2(funcSetBatch);
+        t1.join();
+        t2.join();
+    }
+    {
+        std::thread t1(funcSetCycle);
+        std::thread t2(funcSetCycle);
+        t1.join();
+        t2.join();
+    }
     
     std::cout << "==== with threads, no streaming" << std::endl;
     RhIO::Root.disableStreamingValue("/path/to/child/val");
@@ -144,6 +243,12 @@ int main()
         t1.join();
         t2.join();
     }
+    {
+        std::thread t1(funcGetHandle);
+        std::thread t2(funcGetHandle);
+        t1.join();
+        t2.join();
+    }
     {
         std::thread t1(funcSetChild);
         std::thread t2(funcSetChild);
@@ -162,6 +267,27 @@ int main()
         t1.join();
         t2.join();
     }
+    {
+        std::thread t1(funcSetHandle);
+        std::thread t2(funcSetHandle);
+        t1.join();
+        t2.join();
+    }
+    {
+        std::thread t1(funcSetBatch);
+        std::thread t2(funcSetBatch);
+        t1.join();
+        t2.join();
+    }
+    {
+        std::thread t1(funcSetCycle);
+        std::thread t2(funcSetCycle);
+        t1.join();
+        t2.join();
+    }
+
+    std::cout << "==== clock sources" << std::endl;
+    funcGetTime();
 
     return 0;
 }
@@ -2,6 +2,7 @@
 #include <cassert>
 #include <thread>
 #include <chrono>
+#include <vector>
 #include "RhIO.hpp"
 
 int main()
@@ -151,5 +152,63 @@ int main()
         std::chrono::duration<double, std::milli> dur = time2 - time1;
         std::cout << "Time setRTFloat wrapper (6x10000): " << dur.count() << " ms" << std::endl;
     }
+
+    //Bulk access on a block of floats
+    //and on a native float array
+    RhIO::Root.newFloatArray("/path/to/child/array", 6);
+    std::vector<double> buffer(6, 0.0);
+    {
+        RhIO::WrapperFloatArray w(RhIO::Root.child("/path/to/child"), 
+            {"val1", "val2", "val3", "val4", "val5", "val6"});
+        assert(w.size() == 6);
+        buffer = {1.0, 2.0, 3.0, 4.0, 5.0, 6.0};
+        w.copyIn(buffer);
+        assert(RhIO::Root.getFloat("/path/to/child/val4") == 4.0);
+        assert(w[5] == 6.0);
+        auto time1 = std::chrono::steady_clock::now();
+        for (size_t i=0;i<10000;i++) {
+            w.get(buffer.data());
+        }
+        auto time2 = std::chrono::steady_clock::now();
+        std::chrono::duration<double, std::milli> dur = time2 - time1;
+        std::cout << "Time get block wrapper (6x10000): " << dur.count() << " ms" << std::endl;
+        time1 = std::chrono::steady_clock::now();
+        for (size_t i=0;i<10000;i++) {
+            w.set(buffer.data());
+        }
+        time2 = std::chrono::steady_clock::now();
+        dur = time2 - time1;
+        std::cout << "Time set block wrapper (6x10000): " << dur.count() << " ms" << std::endl;
+    }
+    {
+        RhIO::WrapperFloatArray w(RhIO::Root.child("/path/to/child"), "array");
+        assert(w.size() == 6);
+        buffer = {6.0, 5.0, 4.0, 3.0, 2.0, 1.0};
+        w.copyIn(buffer);
+        assert(RhIO::Root.getFloatArray("/path/to/child/array") == buffer);
+        assert(w[0] == 6.0);
+        auto time1 = std::chrono::steady_clock::now();
+        for (size_t i=0;i<10000;i++) {
+            w.get(buffer.data());
+        }
+        auto time2 = std::chrono::steady_clock::now();
+        std::chrono::duration<double, std::milli> dur = time2 - time1;
+        std::cout << "Time get array wrapper (6x10000): " << dur.count() << " ms" << std::endl;
+        time1 = std::chrono::steady_clock::now();
+        for (size_t i=0;i<10000;i++) {
+            w.set(buffer.data());
+        }
+        time2 = std::chrono::steady_clock::now();
+        dur = time2 - time1;
+        std::cout << "Time set array wrapper (6x10000): " << dur.count() << " ms" << std::endl;
+        bool isThrown = false;
+        try {
+            std::vector<double> tooShort(3, 0.0);
+            w.copyOut(tooShort);
+        } catch (const std::logic_error& e) {
+            isThrown = true;
+        }
+        assert(isThrown);
+    }
 }
 
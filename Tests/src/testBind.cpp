@@ -1,5 +1,8 @@
 #include <iostream>
 #include <cassert>
+#include <chrono>
+#include <vector>
+#include <sstream>
 #include "RhIO.hpp"
 
 class Test
@@ -44,6 +47,31 @@ class Test
             _bind.bindFunc("command5", "test command5", &Test::command5, *this);
             assert(RhIO::Root.call("test/command5", {}) == "");
             
+            _bind.bindFunc("command6", "test command6", &Test::command6, *this);
+            assert(RhIO::Root.call("test/command6", {"[1.0, 2.0, 3.0]", "2"}) == "12.000000");
+            assert(RhIO::Root.commandBinaryExist("test/command6"));
+            assert(RhIO::CommandResult<double>::unpack(
+                RhIO::Root.callBinary("test/command6", 
+                RhIO::commandArgsPack(std::vector<double>({1.0, 2.0, 3.0}), 2)))
+                == 12.0);
+            bool isThrown = false;
+            try {
+                RhIO::Root.callBinary("test/command6", RhIO::commandArgsPack(2.0));
+            } catch (const std::runtime_error& e) {
+                isThrown = true;
+            }
+            assert(isThrown);
+            isThrown = false;
+            try {
+                RhIO::Root.callBinary("test/command6", 
+                    RhIO::commandArgsPack(std::string("toto"), 2));
+            } catch (const std::runtime_error& e) {
+                isThrown = true;
+            }
+            assert(isThrown);
+            RhIO::CommandResult<void>::unpack(
+                RhIO::Root.callBinary("test/command5", RhIO::commandArgsPack()));
+            
             _bind3.bindNew("root3", _valueFloat3);
         }
 
@@ -94,6 +122,14 @@ class Test
         inline void command5()
         {
         }
+        inline double command6(const std::vector<double>& a, int b)
+        {
+            double sum = 0.0;
+            for (size_t i=0;i<a.size();i++) {
+                sum += a[i];
+            }
+            return b*sum;
+        }
 
     private:
 
@@ -109,6 +145,70 @@ class Test
         RhIO::Bind _bind3;
 };
 
+/**
+ * Compare bound variables pull/push 
+ * throughput against name based get/set
+ */
+void benchBind()
+{
+    const size_t count = 200;
+    const size_t cycles = 1000;
+    std::vector<double> vars(count, 0.0);
+    std::vector<std::string> names;
+    RhIO::Bind bind("bench");
+    for (size_t i=0;i<count;i++) {
+        std::ostringstream ss;
+        ss << "value" << i;
+        names.push_back("bench/" + ss.str());
+        bind.bindNew(ss.str(), vars[i]);
+    }
+
+    auto time1 = std::chrono::steady_clock::now();
+    for (size_t k=0;k<cycles;k++) {
+        for (size_t i=0;i<count;i++) {
+            vars[i] = RhIO::Root.getFloat(names[i]);
+        }
+        for (size_t i=0;i<count;i++) {
+            vars[i] += 1.0;
+            RhIO::Root.setFloat(names[i], vars[i]);
+        }
+    }
+    auto time2 = std::chrono::steady_clock::now();
+    for (size_t k=0;k<cycles;k++) {
+        bind.pull();
+        for (size_t i=0;i<count;i++) {
+            vars[i] += 1.0;
+        }
+        bind.push();
+    }
+    auto time3 = std::chrono::steady_clock::now();
+    assert(RhIO::Root.getFloat(names[0]) == 2.0*cycles);
+    std::chrono::duration<double, std::milli> durName = time2 - time1;
+    std::chrono::duration<double, std::milli> durBind = time3 - time2;
+    std::cout << "TimeNamePullPush (" << count << " values x" 
+        << cycles << "): " << durName.count() << " ms" << std::endl;
+    std::cout << "TimeBindPullPush (" << count << " values x" 
+        << cycles << "): " << durBind.count() << " ms" << std::endl;
+
+    //Unchanged variables are not pushed
+    bind.setPushOnChange(true);
+    bind.pull();
+    RhIO::Root.setFloat(names[0], -1.0);
+    vars[1] += 1.0;
+    bind.push();
+    assert(RhIO::Root.getFloat(names[0]) == -1.0);
+    assert(RhIO::Root.getFloat(names[1]) == vars[1]);
+
+    //Push on change compares against the default value
+    RhIO::Bind bindDefault("bench/default");
+    double varDefault = 0.0;
+    bindDefault.setPushOnChange(true);
+    bindDefault.bindNew("value", varDefault)->defaultValue(5.0);
+    assert(RhIO::Root.getFloat("bench/default/value") == 5.0);
+    bindDefault.push();
+    assert(RhIO::Root.getFloat("bench/default/value") == 0.0);
+}
+
 int main()
 {
     if (!RhIO::started()) {
@@ -138,6 +238,8 @@ int main()
     
     assert(RhIO::Root.childExist("root3") == false);
 
+    benchBind();
+
     return 0;
 }
 
@@ -2,6 +2,7 @@
 #include <cassert>
 #include <chrono>
 #include <thread>
+#include <cmath>
 #include "RhIO.hpp"
 #include "RhIOClient.hpp"
 
@@ -31,12 +32,25 @@ int main()
         assert(name == "test/test3/paramInt");
         assert(val == 2);
     });
+    double lastFiltered = -1.0;
     client.setHandlerFloat(
-        [](const std::string name, int64_t timestamp, double val) 
+        [&lastFiltered](const std::string name, int64_t timestamp, double val) 
     {
         std::cout << "Receiving Float:" << std::endl;
         std::cout << name << " " 
             << timestamp << " " << val << std::endl;
+        if (name == "test/paramFiltered") {
+            //Deadband streaming filter
+            assert(lastFiltered < 0.0 || val - lastFiltered > 0.45);
+            lastFiltered = val;
+            return;
+        }
+        if (name == "test/paramLatest") {
+            //Only the last of the ten
+            //updates per period is streamed
+            assert(std::fabs(val - std::floor(val) - 0.9) < 1e-6);
+            return;
+        }
         assert(name == "test/paramFloat");
         assert(val == 3.0);
     });
@@ -68,15 +82,21 @@ int main()
         std::cout << name << " " << timestamp << " " 
             << width << "x" << height << " size=" << size << std::endl;
         assert(name == "test/frame1");
-        assert(width == 300);
-        assert(height == 200);
-        assert(size == 3*300*200);
+        assert(width == 640);
+        assert(height == 480);
+        assert(size == 3*640*480);
     });
     
     std::cout << "Waiting" << std::endl;
     std::this_thread::sleep_for(
         std::chrono::milliseconds(5000));
 
+    RhIO::ClientSub::FrameStats stats = 
+        client.getFrameStats("test/frame1");
+    std::cout << "Frames received: " << stats.countFrames 
+        << " dropped: " << stats.countDropped 
+        << " chunks lost: " << stats.countChunksLost << std::endl;
+
     return 0;
 }
 
@@ -18,6 +18,9 @@ void printTree(const RhIO::IONode& node, std::string prefix = "")
     for (const auto& param : node.listValuesStr()) {
         std::cout << prefix << "(str) " << param << std::endl;
     }
+    for (const auto& param : node.listValuesFloatArray()) {
+        std::cout << prefix << "(float[]) " << param << std::endl;
+    }
     for (const auto& child : node.listChildren()) {
         printTree(node.child(child), prefix + "  ");
     }
@@ -32,11 +35,14 @@ int main()
     assert(RhIO::Root.getValueType("test/paramInt") == RhIO::TypeInt);
     assert(RhIO::Root.getValueType("test/paramFloat") == RhIO::TypeFloat);
     assert(RhIO::Root.getValueType("test2/test3/paramStr") == RhIO::TypeStr);
+    assert(RhIO::Root.getValueType("test/paramFloatArray") == RhIO::TypeFloatArray);
 
     assert(RhIO::Root.getBool("paramBool") == true);
     assert(RhIO::Root.getInt("test/paramInt") == 42);
     assert(RhIO::Root.getFloat("test/paramFloat") == 3.14);
     assert(RhIO::Root.getStr("test2/test3/paramStr") == "off");
+    assert(RhIO::Root.getFloatArray("test/paramFloatArray") 
+        == std::vector<double>({1.0, 2.5, -3.0}));
     
     assert(RhIO::Root.getValueBool("paramBool").name == "paramBool");
     assert(RhIO::Root.getValueInt("test/paramInt").name == "paramInt");
@@ -26,6 +26,9 @@ int main()
         ->comment("str parameter")
         ->persisted(true)
         ->defaultValue("off");
+    RhIO::Root.newFloatArray("test/paramFloatArray", 3)
+        ->persisted(true)
+        ->defaultValue({1.0, 2.5, -3.0});
     
     RhIO::Root.setFloat("test/paramFloat", 3.14);
     assert(RhIO::Root.getValueFloat("test/paramFloat").valuePersisted == 0.0);
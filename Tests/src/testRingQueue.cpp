@@ -0,0 +1,113 @@
+#include <cassert>
+#include <thread>
+#include <atomic>
+#include <vector>
+#include "rhio_common/LockFreeRingQueue.hpp"
+#include "rhio_common/LockFreeLatestSlots.hpp"
+
+int main()
+{
+    //Per writer thread rings accounting and ordering
+    RhIO::LockFreeRingQueue<int> rings(20, 10);
+    std::atomic<int> countStarted(0);
+    auto writer = [&rings, &countStarted](int offset) {
+        //Both writers are alive at the same time
+        rings.appendFromWriter(offset);
+        countStarted++;
+        while (countStarted.load() < 2) {
+        }
+        for (int i=1;i<15;i++) {
+            rings.appendFromWriter(offset + i);
+        }
+    };
+    std::thread thread1(writer, 0);
+    std::thread thread2(writer, 100);
+    thread1.join();
+    thread2.join();
+    assert(rings.getCountRings() == 2);
+    assert(rings.getCountDropped() == 10);
+    rings.swapBufferFromReader();
+    assert(rings.getSizeFromReader() == 20);
+    int last1 = -1;
+    int last2 = 99;
+    for (size_t i=0;i<rings.getSizeFromReader();i++) {
+        int val = rings.getBufferFromReader()[i];
+        int& last = (val < 100) ? last1 : last2;
+        assert(val == last + 1);
+        last = val;
+    }
+    assert(rings.getCountAppended() == 20);
+    assert(rings.getHighWater() == 20);
+    assert(rings.getCapacity() == 20);
+
+    //Rings of exited threads are reused
+    std::thread thread3(writer, 200);
+    thread3.join();
+    assert(rings.getCountRings() == 2);
+    rings.swapBufferFromReader();
+    assert(rings.getSizeFromReader() == 10);
+    assert(rings.getBufferFromReader()[0] == 200);
+
+    //Rings grown by the reader ahead of
+    //the rate (no drop within capacity)
+    RhIO::LockFreeRingQueue<int> lazy(100000, 100000, 5000);
+    size_t counts[] = {5000, 9000, 15000, 25000, 40000, 40000, 30000};
+    for (size_t count : counts) {
+        for (size_t i=0;i<count;i++) {
+            lazy.appendFromWriter(i);
+        }
+        lazy.swapBufferFromReader();
+        assert(lazy.getSizeFromReader() == count);
+        if (count == 5000) {
+            assert(lazy.getCountAllocated() < 20000);
+        }
+    }
+    assert(lazy.getCountDropped() == 0);
+    assert(lazy.getCountAllocated() <= 100000 + 2*1024);
+
+    //Latest slots updated while the reader swaps
+    //are never lost (every slot is announced again)
+    RhIO::LockFreeLatestSlots<int64_t> slots(64);
+    std::atomic<bool> isOver(false);
+    auto writerSlots = [&slots, &isOver](size_t offset) {
+        int64_t k = 0;
+        while (!isOver.load()) {
+            for (size_t id=offset;id<64;id+=2) {
+                slots.writeFromWriter(id, k, k);
+            }
+            k++;
+        }
+    };
+    auto readSlots = [&slots](std::vector<bool>& isRead) {
+        slots.swapBufferFromReader();
+        for (size_t i=0;i<slots.getSizeFromReader();i++) {
+            size_t id;
+            int64_t val;
+            int64_t timestamp;
+            slots.readFromReader(i, id, val, timestamp);
+            assert(val == timestamp);
+            isRead[id] = true;
+        }
+    };
+    std::vector<bool> isRead(64, false);
+    std::thread threadSlots1(writerSlots, 0);
+    std::thread threadSlots2(writerSlots, 1);
+    for (size_t i=0;i<20000;i++) {
+        readSlots(isRead);
+    }
+    isOver.store(true);
+    threadSlots1.join();
+    threadSlots2.join();
+    readSlots(isRead);
+    isRead.assign(64, false);
+    for (size_t id=0;id<64;id++) {
+        assert(slots.writeFromWriter(id, -1, -1));
+    }
+    readSlots(isRead);
+    for (size_t id=0;id<64;id++) {
+        assert(isRead[id]);
+    }
+
+    return 0;
+}
+
@@ -22,6 +22,11 @@ int main()
         ->defaultValue(42.0)
         ->persisted(true);
     RhIO::Root.child("test/test3").newStr("paramStr");
+    RhIO::Root.newFloat("test/paramFiltered")
+        ->streamDeadband(0.45)
+        ->streamMaxRate(100.0);
+    RhIO::Root.newFloat("test/paramLatest")
+        ->streamLatest(true);
 
     RhIO::Root.newStream("test/stream1", "stream1");
     
@@ -38,6 +43,13 @@ int main()
         RhIO::Root.setInt("test/test3/paramInt", 2);
         RhIO::Root.setFloat("test/paramFloat", 3.0);
         RhIO::Root.setStr("test/test3/paramStr", "4");
+        //Only published every five iterations
+        RhIO::Root.setFloat("test/paramFiltered", 0.1*k);
+        RhIO::Root.setFloat("test/paramFiltered", 0.1*k);
+        //Only the last update is published
+        for (size_t i=0;i<10;i++) {
+            RhIO::Root.setFloat("test/paramLatest", k + 0.1*i);
+        }
         RhIO::Root.out("test/stream1") << "test stream1" << std::endl;
         std::this_thread::sleep_for(
             std::chrono::milliseconds(100));
@@ -48,6 +60,8 @@ int main()
         if (k == 30) {
             RhIO::Root.enableStreamingValue("test/test3/paramInt");
             RhIO::Root.enableStreamingValue("test/paramFloat");
+            RhIO::Root.enableStreamingValue("test/paramFiltered");
+            RhIO::Root.enableStreamingValue("test/paramLatest");
             RhIO::Root.enableStreamingValue("test/test3/paramStr");
             RhIO::Root.disableStreamingStream("test/stream1");
         }
@@ -61,15 +75,26 @@ int main()
         if (k == 47) {
             RhIO::Root.disableStreamingFrame("test/frame1");
         }
-        if (RhIO::Root.frameIsStreaming("test/frame1")) {
-            unsigned char* data = new unsigned char[3*300*200];
-            for (size_t i=0;i<3*300*200;i++) {
+        if (RhIO::Root.frameIsStreaming("test/frame1") && k%2 == 0) {
+            unsigned char* data = new unsigned char[3*640*480];
+            for (size_t i=0;i<3*640*480;i++) {
                 data[i] = 0;
             }
             RhIO::Root.framePush("/test/frame1", 
-                300, 200, data, 3*300*200);
+                640, 480, data, 3*640*480);
             delete[] data;
         }
+        if (RhIO::Root.frameIsStreaming("test/frame1") && k%2 == 1) {
+            //Write in place into a pooled buffer
+            RhIO::FrameBuffer* buffer = 
+                RhIO::Root.frameLease("test/frame1", 640, 480);
+            if (buffer != nullptr) {
+                for (size_t i=0;i<3*640*480;i++) {
+                    buffer->data[i] = 0;
+                }
+                RhIO::Root.framePublish(buffer);
+            }
+        }
     }
 
     return 0;
@@ -0,0 +1,89 @@
+#include <iostream>
+#include <cassert>
+#include <thread>
+#include "RhIO.hpp"
+#include "rhio_server/ServerPub.hpp"
+#include "rhio_server/Stats.hpp"
+#include "rhio_common/LockFreeDoubleQueue.hpp"
+#include "rhio_common/LockFreeCounters.hpp"
+
+int main()
+{
+    //Queue accounting
+    RhIO::LockFreeDoubleQueue<int> queue(10);
+    for (int i=0;i<15;i++) {
+        queue.appendFromWriter(i);
+    }
+    queue.swapBufferFromReader();
+    assert(queue.getSizeFromReader() == 10);
+    assert(queue.getCountAppended() == 10);
+    assert(queue.getCountDropped() == 5);
+    assert(queue.getHighWater() == 10);
+    for (int i=0;i<3;i++) {
+        queue.appendFromWriter(i);
+    }
+    assert(!queue.appendBlockFromWriter(20, 
+        [](size_t i, int& cell) { cell = i; }));
+    queue.swapBufferFromReader();
+    assert(queue.getCountAppended() == 13);
+    assert(queue.getCountDropped() == 25);
+    assert(queue.getHighWater() == 10);
+    assert(queue.getCapacity() == 10);
+
+    //Per id counters grown by the reader
+    RhIO::LockFreeCounters counters(10);
+    assert(counters.size() == RhIO::LockFreeCounters::ChunkSize);
+    counters.add(3);
+    counters.add(20000, 2);
+    assert(counters.get(3) == 1);
+    assert(counters.get(20000) == 0);
+    assert(counters.getOther() == 2);
+    counters.reserve(100000);
+    assert(counters.size() >= 100000);
+    counters.add(20000, 2);
+    assert(counters.get(3) == 1);
+    assert(counters.get(20000) == 2);
+    assert(counters.getOther() == 2);
+
+    //Publisher statistics exported in the tree
+    RhIO::Root.newFloat("test/stats");
+    size_t id = RhIO::PathRegistry::intern("test/stats");
+    RhIO::ServerPub server("udp://127.0.0.1:9997");
+    for (size_t i=0;i<10005;i++) {
+        server.publishFloat(id, 0.1*i, i);
+    }
+    server.sendToClient();
+    server.updateStats();
+    std::string path = RhIO::StatsPath + "/";
+    assert(RhIO::Root.getInt(path + "pub/float/appended") == 10000);
+    assert(RhIO::Root.getInt(path + "pub/float/dropped") == 5);
+    assert(RhIO::Root.getInt(path + "pub/float/highWater") == 10000);
+    assert(RhIO::Root.getInt(path + "pub/float/capacity") == 10000);
+    assert(RhIO::Root.getInt(path + "pub/int/appended") == 0);
+    assert(RhIO::Root.getInt(path + "values/test/stats/droppedPub") == 5);
+    assert(RhIO::Root.getInt(path + "pub/droppedOther") == 0);
+    for (size_t i=0;i<10005;i++) {
+        server.publishStream("test/stream", "text", i);
+    }
+    server.sendToClient();
+    server.updateStats();
+    assert(RhIO::Root.getInt(path + "pub/droppedStream") == 5);
+    //Statistics are read only
+    try {
+        RhIO::Root.setInt(path + "pub/float/dropped", 0);
+        assert(false);
+    } catch (const std::logic_error& e) {
+    }
+    try {
+        RhIO::Root.setRTInt(path + "pub/float/dropped", 0);
+        assert(false);
+    } catch (const std::logic_error& e) {
+    }
+    assert(RhIO::Root.getInt(path + "pub/float/dropped") == 5);
+    std::cout << "Dropped samples of test/stats: " 
+        << RhIO::Root.getInt(path + "values/test/stats/droppedPub") 
+        << std::endl;
+
+    return 0;
+}
+
@@ -104,6 +104,25 @@ void function5()
     }
 }
 
+void function6()
+{
+    for (size_t i=0;i<100;i++) {
+        std::string path = "deep/d" + std::to_string(i%10) + "/dd/ddd";
+        RhIO::Root.newFloat(path + "/val" + std::to_string(i));
+        RhIO::Root.setFloat(path + "/val" + std::to_string(i), i);
+        assert(RhIO::Root.getFloat(path + "/val" + std::to_string(i)) == i);
+    }
+}
+
+void function7()
+{
+    for (size_t i=0;i<100;i++) {
+        std::string path = "/deep/d" + std::to_string(i%10) + "/dd/ddd";
+        RhIO::Root.newChild(path + "/node" + std::to_string(i));
+        assert(RhIO::Root.childExist(path + "/node" + std::to_string(i)));
+    }
+}
+
 int main()
 {
     if (!RhIO::started()) {
@@ -116,12 +135,26 @@ int main()
     std::thread t3(function3);
     std::thread t4(function4);
     std::thread t5(function5);
+    std::thread t6(function6);
+    std::thread t7(function7);
     
     t1.join();
     t2.join();
     t3.join();
     t4.join();
     t5.join();
+    t6.join();
+    t7.join();
+
+    assert(RhIO::Root.child("deep").listChildren().size() == 10);
+    for (size_t i=0;i<10;i++) {
+        const RhIO::IONode& node = RhIO::Root.child(
+            "deep/d" + std::to_string(i) + "/dd/ddd");
+        assert(node.listChildren().size() == 10);
+        assert(node.listValuesFloat().size() == 10);
+        assert(&node == &(RhIO::Root.child("deep").child(
+            "d" + std::to_string(i)).child("dd").child("ddd")));
+    }
     
     std::cout << "Display Tree" << std::endl;
     printTree(RhIO::Root); 
@@ -20,6 +20,68 @@ void function2()
     }
 }
 
+void function3()
+{
+    RhIO::IONode& node = RhIO::Root.child("/test");
+    for (size_t i=0;i<10000;i++) {
+        if (i%2 == 0) {
+            node.setRTStr("str", "this is a long enough status string: on");
+        } else {
+            node.setRTStr("str", "this is a long enough status string: off");
+        }
+    }
+}
+
+void function4()
+{
+    RhIO::IONode& node = RhIO::Root.child("/test");
+    std::string strRT;
+    strRT.reserve(64);
+    for (size_t i=0;i<10000;i++) {
+        node.getRTStr("str", strRT);
+        assert(
+            strRT == "" || 
+            strRT == "this is a long enough status string: on" ||
+            strRT == "this is a long enough status string: off");
+        std::string str = node.getRTStr("str");
+        assert(
+            str == "" || 
+            str == "this is a long enough status string: on" ||
+            str == "this is a long enough status string: off");
+        str = RhIO::Root.getStr("test/str");
+        assert(
+            str == "" || 
+            str == "this is a long enough status string: on" ||
+            str == "this is a long enough status string: off");
+    }
+}
+
+void function5()
+{
+    RhIO::ValueBatch batch = RhIO::Root.batch();
+    for (size_t i=0;i<10000;i++) {
+        batch.setInt("test/a/pair", i);
+        batch.setInt("test/b/pair", i);
+        batch.commit();
+    }
+}
+
+void function6()
+{
+    for (size_t i=0;i<1000;i++) {
+        RhIO::Snapshot snapshot = RhIO::Root.snapshot("test");
+        int64_t pairA = -1;
+        int64_t pairB = -1;
+        for (const RhIO::SnapshotInt& val : snapshot.valuesInt) {
+            if (val.name == "test/a/pair") pairA = val.value;
+            if (val.name == "test/b/pair") pairB = val.value;
+        }
+        if (snapshot.isConsistent) {
+            assert(pairA == pairB);
+        }
+    }
+}
+
 int main()
 {
     if (!RhIO::started()) {
@@ -30,12 +92,27 @@ int main()
     RhIO::Root.newChild("test");
     RhIO::Root.newInt("test/int");
     RhIO::Root.setInt("test/int", 0);
+    RhIO::Root.newStr("test/str");
+    RhIO::Root.newInt("test/a/pair");
+    RhIO::Root.newInt("test/b/pair");
 
     std::thread t1(function1);
     std::thread t2(function2);
+    std::thread t3(function3);
+    std::thread t4(function4);
+    std::thread t5(function4);
+    std::thread t6(function5);
+    std::thread t7(function6);
     
     t1.join();
     t2.join();
+    t3.join();
+    t4.join();
+    t5.join();
+    t6.join();
+    t7.join();
+    assert(RhIO::Root.getStr("test/str") == 
+        "this is a long enough status string: off");
     
     std::cout << RhIO::Root.getInt("/test/int") << std::endl;
 
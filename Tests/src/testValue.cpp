@@ -1,6 +1,12 @@
 #include <iostream>
 #include <cassert>
+#include <vector>
+#include <map>
+#include <thread>
+#include <chrono>
+#include <fstream>
 #include "RhIO.hpp"
+#include "rhio_common/Logging.hpp"
 
 void printTree(const RhIO::IONode& node, std::string prefix = "")
 {
@@ -92,6 +98,10 @@ int main()
     assert(RhIO::Root.getStr("test/test3/paramStr") == "");
     RhIO::Root.setStr("test/test3/paramStr", "cool!");
     assert(RhIO::Root.getStr("test/test3/paramStr") == "cool!");
+    RhIO::Root.child("test/test3").setRTStr("paramStr", "realtime");
+    assert(RhIO::Root.child("test/test3").getRTStr("paramStr") == "realtime");
+    assert(RhIO::Root.getStr("test/test3/paramStr") == "realtime");
+    RhIO::Root.setStr("test/test3/paramStr", "cool!");
 
     std::cout << "Printing tree:" << std::endl;
     printTree(RhIO::Root); 
@@ -130,6 +140,319 @@ int main()
     RhIO::Root.setFloat("test/paramFloat", 5.0);
     assert(isSet == true);
 
+    RhIO::ValueHandleInt handleInt(RhIO::Root, "test/test3/paramInt");
+    RhIO::ValueHandleFloat handleFloat(RhIO::Root.child("test"), "paramFloat");
+    RhIO::ValueHandleStr handleStr(RhIO::Root, "/test/test3/paramStr");
+    assert(handleInt.get() == 5);
+    assert(handleFloat.path() == "test/paramFloat");
+    handleInt.set(20);
+    assert(handleInt.get() == 10);
+    assert(RhIO::Root.getInt("test/test3/paramInt") == 10);
+    isSet = false;
+    handleInt.set(5, true);
+    assert(isSet == false);
+    handleInt = 5;
+    assert(isSet == true);
+    isSet = false;
+    handleFloat.set(5.0);
+    assert(isSet == true);
+    assert(RhIO::Root.getFloat("test/paramFloat") == 5.0);
+    handleStr.set("handle");
+    assert(handleStr.get() == "handle");
+    assert(RhIO::Root.getStr("test/test3/paramStr") == "handle");
+    try {
+        RhIO::ValueHandleBool handleError(RhIO::Root, "test/paramInt");
+        assert(false);
+    } catch (const std::logic_error& e) {
+    }
+
+    RhIO::ValueBatch batch = RhIO::Root.batch();
+    batch.setInt("test/test3/paramInt", 42);
+    batch.setFloat(handleFloat, 2.0);
+    batch.setStr("/test/test3/paramStr", "batch");
+    batch.setBool("test/paramBool", true);
+    assert(batch.size() == 4);
+    assert(RhIO::Root.getInt("test/test3/paramInt") == 5);
+    isSet = false;
+    batch.commit(false, 1234);
+    assert(batch.size() == 0);
+    assert(isSet == true);
+    assert(RhIO::Root.getInt("test/test3/paramInt") == 10);
+    assert(RhIO::Root.getFloat("test/paramFloat") == 2.0);
+    assert(RhIO::Root.getStr("test/test3/paramStr") == "batch");
+    assert(RhIO::Root.getBool("test/paramBool") == true);
+    assert(RhIO::Root.getValueInt("test/test3/paramInt").timestamp == 1234);
+    assert(RhIO::Root.getValueFloat("test/paramFloat").timestamp == 1234);
+    assert(RhIO::Root.getValueStr("test/test3/paramStr").timestamp == 1234);
+    assert(RhIO::Root.getValueBool("test/paramBool").timestamp == 1234);
+    batch.setFloat("test/paramFloat", 3.0);
+    batch.clear();
+    batch.commit();
+    assert(RhIO::Root.getFloat("test/paramFloat") == 2.0);
+    try {
+        batch.setInt("test/paramFloat", 1);
+        assert(false);
+    } catch (const std::logic_error& e) {
+    }
+    //Throwing callbacks do not leave nodes writing
+    RhIO::Root.newInt("test/paramThrow");
+    RhIO::Root.setCallbackInt("test/paramThrow", [](int64_t val) {
+        if (val == 1) throw std::runtime_error("callback");
+    });
+    //The update of a throwing callback and the updates
+    //applied before are published and logged and 
+    //the batch is cleared
+    RhIO::Root.newInt("test/test3/paramApplied");
+    batch.setInt("test/test3/paramApplied", 1);
+    batch.setInt("test/paramThrow", 1);
+    try {
+        batch.commit(false, 500);
+        assert(false);
+    } catch (const std::runtime_error& e) {
+    }
+    assert(batch.size() == 0);
+    assert(RhIO::Root.snapshot("test").isConsistent);
+    assert(RhIO::Root.getInt("test/test3/paramApplied") == 1);
+    RhIO::Root.setInt("test/test3/paramApplied", 2);
+    batch.setInt("test/paramThrow", 2);
+    batch.commit();
+    assert(RhIO::Root.getInt("test/test3/paramApplied") == 2);
+    assert(RhIO::Root.getInt("test/paramThrow") == 2);
+
+    std::vector<int64_t> deferredValues;
+    RhIO::Root.newInt("test/paramDeferred");
+    RhIO::Root.setCallbackInt("test/paramDeferred", 
+        [&deferredValues](int64_t val) {
+            //Deferred callbacks may use RhIO
+            assert(RhIO::Root.getInt("test/paramDeferred") == 3);
+            deferredValues.push_back(val);
+        });
+    RhIO::setCallbackMode(RhIO::CallbackDeferred);
+    RhIO::Root.setInt("test/paramDeferred", 1);
+    RhIO::Root.setInt("test/paramDeferred", 2);
+    RhIO::Root.setInt("test/paramDeferred", 3);
+    RhIO::Root.setInt("test/paramDeferred", 4, true);
+    RhIO::Root.setInt("test/paramDeferred", 3, true);
+    assert(deferredValues.size() == 0);
+    assert(RhIO::dispatchCallbacks() == 3);
+    assert(deferredValues.size() == 3);
+    assert(deferredValues[0] == 1);
+    assert(deferredValues[1] == 2);
+    assert(deferredValues[2] == 3);
+    assert(RhIO::dispatchCallbacks() == 0);
+    //Calls beyond the queue capacity are counted
+    for (size_t i=0;i<10010;i++) {
+        RhIO::Root.setInt("test/paramDeferred", 3);
+    }
+    assert(RhIO::dispatchCallbacks() == 10000);
+    assert(RhIO::countDroppedCallbacks() == 10);
+    deferredValues.clear();
+    RhIO::Root.setInt("test/paramDeferred", 3);
+    RhIO::setCallbackMode(RhIO::CallbackInline);
+    assert(deferredValues.size() == 1);
+
+    //Logged values are resolved from their interned id
+    RhIO::Root.newFloat("test/test3/paramLogged");
+    RhIO::Root.setFloat("test/test3/paramLogged", 1.0, false, 10);
+    RhIO::Root.child("test/test3").setRTFloat("paramLogged", 3.0, 30);
+    std::this_thread::sleep_for(std::chrono::milliseconds(100));
+    RhIO::writeLogs("/tmp/testValueLog");
+    std::ifstream file("/tmp/testValueLog");
+    std::map<std::string, std::vector<RhIO::LogValBool>> logsBool;
+    std::map<std::string, std::vector<RhIO::LogValInt>> logsInt;
+    std::map<std::string, std::vector<RhIO::LogValFloat>> logsFloat;
+    std::map<std::string, std::vector<RhIO::LogValStr>> logsStr;
+    assert(RhIO::RhIOReadBinaryLog(
+        file, logsBool, logsInt, logsFloat, logsStr));
+    assert(logsFloat.count("test/test3/paramLogged") == 1);
+    assert(logsFloat.at("test/test3/paramLogged").size() == 2);
+    assert(logsFloat.at("test/test3/paramLogged")[0].value == 1.0);
+    assert(logsFloat.at("test/test3/paramLogged")[0].timestamp == 10);
+    assert(logsFloat.at("test/test3/paramLogged")[1].value == 3.0);
+    assert(logsFloat.at("test/test3/paramLogged")[1].timestamp == 30);
+    assert(logsInt.count("test/paramDeferred") == 1);
+    assert(logsInt.count("test/test3/paramApplied") == 1);
+    assert(logsInt.at("test/test3/paramApplied")[0].timestamp == 500);
+    assert(logsInt.count("test/paramThrow") == 1);
+    assert(logsInt.at("test/paramThrow").size() == 2);
+    assert(logsInt.at("test/paramThrow")[0].value == 1);
+    assert(logsInt.at("test/paramThrow")[0].timestamp == 500);
+
+    RhIO::Snapshot snapshot = RhIO::Root.snapshot("test/test3");
+    assert(snapshot.isConsistent);
+    assert(snapshot.valuesBool.size() == 0);
+    bool isFoundInt = false;
+    for (const RhIO::SnapshotInt& val : snapshot.valuesInt) {
+        if (val.name == "test/test3/paramInt") {
+            assert(val.value == 10);
+            assert(val.timestamp == 1234);
+            isFoundInt = true;
+        }
+    }
+    assert(isFoundInt);
+    bool isFoundFloat = false;
+    for (const RhIO::SnapshotFloat& val : snapshot.valuesFloat) {
+        if (val.name == "test/test3/paramLogged") {
+            assert(val.value == 3.0);
+            assert(val.timestamp == 30);
+            isFoundFloat = true;
+        }
+    }
+    assert(isFoundFloat);
+    assert(snapshot.valuesStr.size() == 1);
+    assert(snapshot.valuesStr[0].value == "batch");
+    assert(RhIO::Root.snapshot().valuesBool.size() > 0);
+
+    //Fixed length float arrays
+    RhIO::Root.newFloatArray("test/arrays/paramArray", 3)
+        ->minimum({-1.0, -1.0, -1.0})
+        ->maximum({1.0, 1.0, 10.0});
+    assert(RhIO::Root.getValueType("test/arrays/paramArray") 
+        == RhIO::TypeFloatArray);
+    assert(RhIO::Root.getFloatArray("test/arrays/paramArray") 
+        == std::vector<double>({0.0, 0.0, 0.0}));
+    std::vector<double> arrayCallback;
+    RhIO::Root.setCallbackFloatArray("test/arrays/paramArray", 
+        [&arrayCallback](std::vector<double> val) {
+            arrayCallback = val;
+        });
+    RhIO::Root.setFloatArray("test/arrays/paramArray", 
+        {0.5, -2.0, 2.0}, false, 100);
+    assert(RhIO::Root.getFloatArray("test/arrays/paramArray") 
+        == std::vector<double>({0.5, -1.0, 2.0}));
+    assert(arrayCallback == std::vector<double>({0.5, -1.0, 2.0}));
+    try {
+        RhIO::Root.setFloatArray("test/arrays/paramArray", {1.0, 2.0});
+        assert(false);
+    } catch (const std::logic_error& e) {
+    }
+    try {
+        RhIO::Root.newFloatArray("test/arrays/paramArray", 4);
+        assert(false);
+    } catch (const std::logic_error& e) {
+    }
+    //Builder parameters never change the array length
+    try {
+        RhIO::Root.newFloatArray("test/paramArrayLen", 3)
+            ->defaultValue({1.0});
+        assert(false);
+    } catch (const std::logic_error& e) {
+    }
+    assert(RhIO::Root.getFloatArray("test/paramArrayLen").size() == 3);
+    RhIO::Root.setFloatArray("test/paramArrayLen", {1.0, 2.0, 3.0});
+    RhIO::Root.newFloatArray("test/paramArrayLen", 3)
+        ->defaultValue({4.0, 5.0, 6.0});
+    assert(RhIO::Root.getFloatArray("test/paramArrayLen")
+        == std::vector<double>({1.0, 2.0, 3.0}));
+    try {
+        RhIO::Root.newFloatArray("test/paramArrayLen", 3)
+            ->minimum({0.0, 0.0});
+        assert(false);
+    } catch (const std::logic_error& e) {
+    }
+    try {
+        RhIO::Root.newFloatArray("test/paramArrayLen", 3)
+            ->maximum({0.0, 0.0, 0.0, 0.0});
+        assert(false);
+    } catch (const std::logic_error& e) {
+    }
+    RhIO::LockFreeFloatArray arrayFixed(std::vector<double>({1.0, 2.0}));
+    try {
+        arrayFixed.store(std::vector<double>({1.0}));
+        assert(false);
+    } catch (const std::logic_error& e) {
+    }
+    assert(arrayFixed == std::vector<double>({1.0, 2.0}));
+    double arrayRT[3] = {0.1, 0.2, 20.0};
+    RhIO::Root.child("test/arrays").setRTFloatArray(
+        "paramArray", arrayRT, 200);
+    double arrayRead[3];
+    RhIO::Root.child("test/arrays").getRTFloatArray(
+        "paramArray", arrayRead);
+    assert(arrayRead[0] == 0.1 && arrayRead[1] == 0.2);
+    assert(arrayRead[2] == 10.0);
+    RhIO::Snapshot snapshotArray = RhIO::Root.snapshot("test/arrays");
+    assert(snapshotArray.valuesFloatArray.size() == 1);
+    assert(snapshotArray.valuesFloatArray[0].name == "test/arrays/paramArray");
+    assert(snapshotArray.valuesFloatArray[0].timestamp == 200);
+    assert(snapshotArray.valuesFloatArray[0].value 
+        == std::vector<double>({0.1, 0.2, 10.0}));
+    //Arrays are logged as one record
+    std::this_thread::sleep_for(std::chrono::milliseconds(100));
+    RhIO::writeLogs("/tmp/testValueLogArray");
+    std::ifstream fileArray("/tmp/testValueLogArray");
+    std::map<std::string, std::vector<RhIO::LogValFloatArray>> logsFloatArray;
+    assert(RhIO::RhIOReadBinaryLog(
+        fileArray, logsBool, logsInt, logsFloat, logsStr, logsFloatArray));
+    assert(logsFloat.count("test/test3/paramLogged") == 1);
+    assert(logsFloatArray.count("test/arrays/paramArray") == 1);
+    assert(logsFloatArray.at("test/arrays/paramArray").size() == 2);
+    assert(logsFloatArray.at("test/arrays/paramArray")[0].timestamp == 100);
+    assert(logsFloatArray.at("test/arrays/paramArray")[1].value 
+        == std::vector<double>({0.1, 0.2, 10.0}));
+    //Arrays in batches
+    batch.setFloatArray("test/arrays/paramArray", {0.3, 0.4, 0.5});
+    batch.setFloat("test/paramFloat", 4.0);
+    assert(batch.size() == 2);
+    batch.commit(false, 300);
+    assert(RhIO::Root.getFloatArray("test/arrays/paramArray")
+        == std::vector<double>({0.3, 0.4, 0.5}));
+    assert(RhIO::Root.getValueFloatArray("test/arrays/paramArray").timestamp
+        == 300);
+    assert(arrayCallback == std::vector<double>({0.3, 0.4, 0.5}));
+    batch.setFloatArray("test/arrays/paramArray", {-5.0, 0.0, 0.0});
+    batch.commit(true, 400);
+    assert(RhIO::Root.getFloatArray("test/arrays/paramArray")
+        == std::vector<double>({-1.0, 0.0, 0.0}));
+    try {
+        batch.setFloatArray("test/arrays/paramArray", {1.0});
+        assert(false);
+    } catch (const std::logic_error& e) {
+    }
+
+    //Samples suppressed by the stream max rate
+    //are flushed once the period is elapsed
+    RhIO::Root.newFloat("test/paramRate")
+        ->streamOnChange(true)
+        ->streamMaxRate(0.001);
+    RhIO::Root.enableStreamingValue("test/paramRate");
+    int64_t timeRate = RhIO::getRhIOTime();
+    RhIO::Root.setFloat("test/paramRate", 1.0, false, timeRate);
+    assert(RhIO::Root.flushStreamingValue("test/paramRate", timeRate + 2));
+    RhIO::Root.setFloat("test/paramRate", 2.0, false, timeRate + 1);
+    assert(!RhIO::Root.flushStreamingValue("test/paramRate", timeRate + 2));
+    assert(RhIO::Root.flushStreamingValue(
+        "test/paramRate", timeRate + 2000000000));
+    RhIO::Root.setFloat("test/paramRate", 2.0, false, timeRate + 3);
+    assert(RhIO::Root.flushStreamingValue("test/paramRate", timeRate + 4));
+    RhIO::Root.disableStreamingValue("test/paramRate");
+
+    //Per thread cycle time is reused by setters
+    RhIO::setRhIOCycleTime(5000);
+    RhIO::Root.setInt("test/test3/paramInt", 1);
+    assert(RhIO::Root.getValueInt("test/test3/paramInt").timestamp == 5000);
+    std::thread threadCycle([](){
+        assert(RhIO::getRhIOTime() != 5000);
+    });
+    threadCycle.join();
+    RhIO::clearRhIOCycleTime();
+    assert(RhIO::getRhIOTime() != 5000);
+    int64_t timeCycle = RhIO::beginRhIOCycle();
+    assert(RhIO::getRhIOTime() == timeCycle);
+    RhIO::clearRhIOCycleTime();
+    //Clock sources
+    RhIO::setRhIOTimeFunc([]() -> int64_t { return 42; });
+    assert(RhIO::getRhIOTime() == 42);
+    for (RhIO::TimeSource source : 
+        {RhIO::TimeCoarse, RhIO::TimeTSC, RhIO::TimeSteady}
+    ) {
+        RhIO::setRhIOTimeSource(source);
+        int64_t time1 = RhIO::getRhIOTime();
+        std::this_thread::sleep_for(std::chrono::milliseconds(50));
+        int64_t time2 = RhIO::getRhIOTime();
+        assert(time2 - time1 > 30000 && time2 - time1 < 200000);
+    }
+
     return 0;
 }
 